@@ -19,3 +19,13 @@ if ( Boost_FOUND )
    SET(DGtalLibInc ${Boost_INCLUDE_DIRS})
 endif( Boost_FOUND )
 
+# -----------------------------------------------------------------------------
+# Look for librt (clock_gettime in Clock, before glibc 2.17)
+# -----------------------------------------------------------------------------
+INCLUDE(CheckLibraryExists)
+CHECK_LIBRARY_EXISTS(rt clock_gettime "time.h" HAVE_LIBRT)
+if ( HAVE_LIBRT )
+  message(STATUS "librt found.")
+  SET(DGtalLibDependencies ${DGtalLibDependencies} rt)
+endif( HAVE_LIBRT )
+
@@ -19,6 +19,7 @@ OPTION(WITH_MAGICK "With GraphicsMagick++." OFF)
 OPTION(WITH_ITK "With Insight Toolkit ITK." OFF)
 OPTION(WITH_CAIRO "With CairoGraphics." OFF)
 OPTION(WITH_COIN3D-SOQT "With COIN3D & SOQT for 3D visualization (Qt required)." OFF)
+OPTION(WITH_OPENMP "With OpenMP (compiler multithreading features)." OFF)
 
 IF(WITH_C11)
 SET (LIST_OPTION ${LIST_OPTION} [c++11]\ )
@@ -69,6 +70,13 @@ ELSE(WITH_MAGICK)
 message(STATUS "      WITH_MAGICK       false")
 ENDIF(WITH_MAGICK)
 
+IF(WITH_OPENMP)
+SET (LIST_OPTION ${LIST_OPTION} [OPENMP]\ )
+message(STATUS "      WITH_OPENMP       true")
+ELSE(WITH_OPENMP)
+message(STATUS "      WITH_OPENMP       false")
+ENDIF(WITH_OPENMP)
+
 message(STATUS "")
 message(STATUS "Checking the dependencies: ")
 
@@ -127,6 +135,25 @@ IF(WITH_GMP)
   ENDIF(GMP_FOUND)
 ENDIF(WITH_GMP)
 
+# -----------------------------------------------------------------------------
+# Look for OpenMP
+# (They are not compulsory).
+# -----------------------------------------------------------------------------
+SET(OPENMP_FOUND_DGTAL 0)
+IF(WITH_OPENMP)
+  FIND_PACKAGE(OpenMP REQUIRED)
+  IF(OPENMP_FOUND)
+    SET(CMAKE_C_FLAGS "${CMAKE_C_FLAGS} ${OpenMP_C_FLAGS}")
+    SET(CMAKE_CXX_FLAGS "${CMAKE_CXX_FLAGS} ${OpenMP_CXX_FLAGS}")
+    SET(CMAKE_EXE_LINKER_FLAGS "${CMAKE_EXE_LINKER_FLAGS} ${OpenMP_EXE_LINKER_FLAGS}")
+    SET(OPENMP_FOUND_DGTAL 1)
+    message(STATUS "OpenMP found." )
+    ADD_DEFINITIONS("-DWITH_OPENMP ")
+  ELSE(OPENMP_FOUND)
+    message(FATAL_ERROR "OpenMP not found. Check the cmake variables associated to this package or disable it." )
+  ENDIF(OPENMP_FOUND)
+ENDIF(WITH_OPENMP)
+
 # -----------------------------------------------------------------------------
 # Look for GraphicsMagic
 # (They are not compulsory).
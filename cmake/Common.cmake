@@ -59,6 +59,14 @@ if ( ${CMAKE_BUILD_TYPE} MATCHES "Debug" )
   ENDIF(DEBUG_VERBOSE)
 endif( ${CMAKE_BUILD_TYPE} MATCHES "Debug" )
 
+OPTION(WITH_PROFILING "Record the Trace blocks and the DGTAL_PROFILE_SCOPE scopes in DGtal::profiler." OFF)
+SET(PROFILING_DGTAL 0)
+IF (WITH_PROFILING)
+  ADD_DEFINITIONS(-DWITH_PROFILING)
+  SET(PROFILING_DGTAL 1)
+  MESSAGE(STATUS "Profiling activated")
+ENDIF(WITH_PROFILING)
+
 # Functions are INLINE only in Release mode
 if ( ${CMAKE_BUILD_TYPE} MATCHES "Release" )
     ADD_DEFINITIONS(-DINLINE=inline)
@@ -0,0 +1,344 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file ConcurrentSternBrocot.h
+ * @author Jacques-Olivier Lachaud (\c jacques-olivier.lachaud@univ-savoie.fr )
+ * Laboratory of Mathematics (CNRS, UMR 5127), University of Savoie, France
+ *
+ * @date 2026/10/19
+ *
+ * Header file for module ConcurrentSternBrocot.cpp
+ *
+ * This file is part of the DGtal library.
+ *
+ * @see testConcurrentSternBrocot.cpp
+ */
+
+#if defined(ConcurrentSternBrocot_RECURSES)
+#error Recursive header files inclusion detected in ConcurrentSternBrocot.h
+#else // defined(ConcurrentSternBrocot_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define ConcurrentSternBrocot_RECURSES
+
+#if !defined ConcurrentSternBrocot_h
+/** Prevents repeated inclusion of headers. */
+#define ConcurrentSternBrocot_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/InputIteratorWithRankOnSequence.h"
+#include "DGtal/kernel/CInteger.h"
+#include "DGtal/kernel/CSignedInteger.h"
+#include "DGtal/kernel/NumberTraits.h"
+#include "DGtal/arithmetic/SternBrocotFraction.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class ConcurrentSternBrocot
+  /**
+   Description of template class 'ConcurrentSternBrocot' <p> \brief Aim: The
+   Stern-Brocot tree is the tree of irreducible fractions. This class
+   allows to construct it progressively and to navigate within
+   fractions in O(1) time for most operations. It is well known that
+   the structure of this tree is a coding of the continued fraction
+   representation of fractions.
+
+   This class has the same services as SternBrocot, but the tree may
+   be shared by several threads, e.g. to compute DSS with
+   StandardDSLQ0<ConcurrentSternBrocot::Fraction> in parallel:
+
+   - the nodes are allocated by chunks of 2^ChunkBits nodes in an
+     arena owned by the tree, instead of one by one with new;
+
+   - a new child (and its inverse) is built privately and published
+     with one compare-and-swap on the pointer to the left child of its
+     father. When two threads create the same child simultaneously,
+     the loser's nodes are simply left unused in the arena. The right
+     child of a node is the inverse of the left child of its inverse,
+     so that it needs no separate publication.
+
+   Existing nodes are never modified, apart from the publication of
+   their children, so that navigating the tree needs no
+   synchronization. The atomic operations are the GCC builtins, or an
+   OpenMP critical section with other compilers.
+
+   This class is not to be instantiated, since it is useless to
+   duplicate it. Use static method ConcurrentSternBrocot::fraction to obtain
+   your fractions.
+
+   @param TInteger the integral type chosen for the fractions.
+
+   @param TQuotient the integral type chosen for the
+   quotients/coefficients or depth (may be "smaller" than TInteger,
+   since they are generally much smaller than the fraction itself).
+  */
+  template <typename TInteger, typename TQuotient = int32_t>
+  class ConcurrentSternBrocot
+  {
+  public:
+    typedef TInteger Integer;
+    typedef TQuotient Quotient;
+    typedef ConcurrentSternBrocot<Integer,Quotient> Self;
+    
+    BOOST_CONCEPT_ASSERT(( CInteger< Integer > ));
+    BOOST_CONCEPT_ASSERT(( CSignedInteger< Quotient > ));
+
+  public:
+
+    /**
+       Represents a node in the Stern-Brocot. The node stores
+       information on the irreducible fraction itself (p/q, the
+       partial quotient u, the depth k), but also pointers to
+       ascendants, descendants and inverse in the Stern-Brocot tree.
+       Nodes are constructed on demand, when the user ask for
+       descendant or for a specific fraction.
+
+       @see ConcurrentSternBrocot::fraction
+
+       Essentially a backport from <a
+       href="https://gforge.liris.cnrs.fr/projects/imagene">ImaGene</a>.
+    */
+    struct Node {
+
+      /**
+         Constructor for node.
+
+         @param p1 the numerator.
+         @param q1 the denominator.
+         @param u1 the quotient (last coefficient of its continued fraction).
+         @param k1 the depth (1+number of coefficients of its continued fraction).
+         @param ascendant_left1 the node that is the left ascendant.
+         @param ascendant_right1 the node that is the right ascendant.
+         @param descendant_left1 the node that is the left descendant or 0 (if none exist).
+         @param descendant_right1 the node that is the right descendant or 0 (if none exist).
+         @param inverse1 the node that is its inverse.
+       */
+      Node( Integer p1, Integer q1, Quotient u1, Quotient k1, 
+	    Node* ascendant_left1, Node* ascendant_right1, 
+	    Node* descendant_left1, Node* descendant_right1,
+	    Node* inverse1 );
+
+      /// the numerator;
+      Integer p;
+      /// the denominator;
+      Integer q;
+      /// the quotient (last coefficient of its continued fraction).
+      Quotient u;
+      /// the depth (1+number of coefficients of its continued fraction).
+      Quotient k;
+      /// the node that is the left ascendant.
+      Node* ascendantLeft;
+      /// the node that is the right ascendant.
+      Node* ascendantRight;
+      /// the node that is the left descendant or 0 (if none exist).
+      Node* volatile descendantLeft;
+      /// the node that is the right descendant or 0 (if none exist).
+      Node* volatile descendantRight;
+      /// the node that is its inverse.
+      Node* inverse;
+    };
+
+    /**
+       The fractions of this tree, a model of CPositiveIrreducibleFraction.
+    */
+    typedef SternBrocotFraction<Self> Fraction;
+    friend class SternBrocotFraction<Self>;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Destructor.
+     */
+    ~ConcurrentSternBrocot();
+
+    /**
+       @return the (only) instance of ConcurrentSternBrocot.
+    */
+    static ConcurrentSternBrocot & instance();
+
+    /** The fraction 0/1 */
+    static Fraction zeroOverOne();
+
+    /** The fraction 1/0 */
+    static Fraction oneOverZero();
+
+    /** 
+	Any fraction p/q. Complexity is in \f$ \sum_i
+	u_i \f$, where u_i are the partial quotients of p/q.
+
+	@param p the numerator (>=0)
+	@param q the denominator (>=0)
+
+	@param ancestor (optional) any ancestor of p/q in the tree
+	(for speed-up).
+	
+	@return the corresponding fraction in the Stern-Brocot tree.
+
+        NB: Complexity is bounded by \f$ 2 \sum_i u_i \f$, where u_i
+        are the partial quotients of p/q.
+    */
+    static Fraction fraction( Integer p, Integer q,
+                              Fraction ancestor = zeroOverOne() );
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the fraction on an output stream.
+     * @param out the output stream where the object is written.
+     * @param f the fraction to display.
+     */
+    static void display ( std::ostream & out, const Fraction & f );
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    /// @return the number of nodes taken in the arena (fractions,
+    /// nodes lost in concurrent creations, and nodes whose
+    /// construction has failed).
+    DGtal::uint64_t nbNodes() const;
+
+    /// The total number of fractions in the current tree.
+    volatile DGtal::uint64_t nbFractions;
+
+    /// Log2 of the number of nodes of a chunk of the arena.
+    static const unsigned int ChunkBits = 14;
+    /// Maximal number of chunks of the arena.
+    static const unsigned int MaxChunks = 1 << 16;
+
+    // ------------------------- Protected Datas ------------------------------
+  private:
+    // ------------------------- Private Datas --------------------------------
+  private:
+    /// Singleton class.
+    static ConcurrentSternBrocot* volatile singleton;
+
+    Node* myZeroOverOne;
+    Node* myOneOverZero;
+    Node* myOneOverOne;
+
+    /// The chunks of the arena (MaxChunks pointers, 0 when not allocated).
+    Node* volatile * myChunks;
+    /// The number of nodes taken in the arena.
+    volatile DGtal::uint64_t myNbNodes;
+
+    // ------------------------- Hidden services ------------------------------
+  private:
+
+    /**
+     * Constructor. Hidden since singleton class.
+     */
+    ConcurrentSternBrocot();
+
+    /**
+     * Copy constructor.
+     * @param other the object to clone.
+     * Forbidden by default.
+     */
+    ConcurrentSternBrocot ( const ConcurrentSternBrocot & other );
+
+    /**
+     * Assignment.
+     * @param other the object to copy.
+     * @return a reference on 'this'.
+     * Forbidden by default.
+     */
+    ConcurrentSternBrocot & operator= ( const ConcurrentSternBrocot & other );
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+     * Constructs a node in the arena. May be called concurrently.
+     * Same parameters as the constructor of Node.
+     * @return a pointer to the new node.
+     */
+    Node* newNode( Integer p1, Integer q1, Quotient u1, Quotient k1,
+                   Node* ascendant_left1, Node* ascendant_right1,
+                   Node* descendant_left1, Node* descendant_right1,
+                   Node* inverse1 );
+
+    /**
+     * Publishes [n] as the left descendant of [father], and the
+     * inverse of [n] as the right descendant of the inverse of
+     * [father], unless another thread has published them first. May
+     * be called concurrently.
+     * @param father a node.
+     * @param n its new left descendant, whose inverse is set.
+     */
+    void setLeftDescendant( Node* father, Node* n );
+
+    /**
+     * @param chunk a chunk of the arena.
+     * @return the flags of its nodes, 1 when the node is constructed.
+     */
+    static volatile char* builtFlags( Node* chunk );
+
+    /**
+     * Atomically replaces [*address] by [desired] if it is [expected].
+     * @return the value of [*address] before the operation.
+     */
+    template <typename T>
+    static T* compareAndSwap( T* volatile * address, T* expected, T* desired );
+
+    /**
+     * Atomically adds [value] to [*address].
+     * @return the value of [*address] before the operation.
+     */
+    static DGtal::uint64_t fetchAndAdd( volatile DGtal::uint64_t * address,
+                                        DGtal::uint64_t value );
+
+  }; // end of class ConcurrentSternBrocot
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'ConcurrentSternBrocot'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'ConcurrentSternBrocot' to write.
+   * @return the output stream after the writing.
+   */
+  // template <typename TInteger, typename TQuotient>
+  // std::ostream&
+  // operator<< ( std::ostream & out, 
+  //              const typename ConcurrentSternBrocot<TInteger, TQuotient>::Fraction & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/arithmetic/ConcurrentSternBrocot.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined ConcurrentSternBrocot_h
+
+#undef ConcurrentSternBrocot_RECURSES
+#endif // else defined(ConcurrentSternBrocot_RECURSES)
@@ -43,6 +43,7 @@
 #include <iostream>
 #include "DGtal/base/Common.h"
 #include "DGtal/kernel/NumberTraits.h"
+#include "DGtal/kernel/HybridInteger.h"
 #include "DGtal/kernel/CUnsignedInteger.h"
 #include "DGtal/kernel/CInteger.h"
 #include "DGtal/kernel/SpaceND.h"
@@ -75,7 +76,10 @@ It is a backport of <a
 href="https://gforge.liris.cnrs.fr/projects/imagene">ImaGene</a>.
 
 @tparam TInteger any model of integer (CInteger), like \c int, \c long int,
-\c int64_t, \c BigInteger (when GMP is installed).
+\c int64_t, \c BigInteger or \c HybridInteger (when GMP is
+installed). With \c HybridInteger, gcd, floorDiv, ceilDiv and the
+euclidean division are computed on 64 bits integers as long as the
+operands fit in, and with GMP otherwise.
    
    */
   template <typename TInteger>
@@ -0,0 +1,331 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file PatternCache.h
+ * @author Jacques-Olivier Lachaud (\c jacques-olivier.lachaud@univ-savoie.fr )
+ * Laboratory of Mathematics (CNRS, UMR 5127), University of Savoie, France
+ *
+ * @date 2026/10/19
+ *
+ * Header file for module PatternCache.cpp
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(PatternCache_RECURSES)
+#error Recursive header files inclusion detected in PatternCache.h
+#else // defined(PatternCache_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define PatternCache_RECURSES
+
+#if !defined PatternCache_h
+/** Prevents repeated inclusion of headers. */
+#define PatternCache_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <string>
+#include <vector>
+#include <list>
+#include <map>
+#include <utility>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/CountedPtr.h"
+#include "DGtal/arithmetic/IntegerComputer.h"
+#include "DGtal/arithmetic/Pattern.h"
+#include "DGtal/arithmetic/StandardDSLQ0.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class PatternCache
+  /**
+     Description of template class 'PatternCache' <p> \brief Aim: A
+     bounded cache of precomputed pattern descriptors, and a fast
+     rasterizer of digital straight lines built on it.
+
+     Pattern computes everything from its fraction at each call: rE()
+     builds the Christoffel word by recursive string concatenations,
+     posL(), L() or bezout() go up in the Stern-Brocot tree. When the
+     same slopes are used over and over (e.g. digitizing many parallel
+     lines), a PatternCache::Descriptor stores once for all:
+     - the Christoffel word of the pattern, packed 64 letters per word
+       (bit i is 1 iff the i-th step is along y);
+     - the number of 1's before each word, so that the point reached
+       after i steps is obtained with one popcount;
+     - the position and coordinates of the first lower leaning point,
+       the Bezout vector, and the inverse of p modulo p+q, which gives
+       the position of a point of a DSL within its pattern.
+
+     The letter i of the pattern p/q is 1 iff (i p mod (p+q)) >= q,
+     so a descriptor is built in O(p+q) without any recursion.
+
+     The cache keeps at most a given number of descriptors, the least
+     recently used one being evicted. Descriptors are shared through
+     CountedPtr, so that an evicted descriptor remains valid as long
+     as it is used. Patterns longer than a given length are not
+     cached.
+
+     A PatternCache is not thread-safe: each thread must have its own.
+
+     @code
+     typedef SternBrocot<DGtal::int64_t,DGtal::int32_t>::Fraction Fraction;
+     PatternCache<Fraction> cache;
+     StandardDSLQ0<Fraction> D( 5, 13, 0 );
+     std::vector< PatternCache<Fraction>::Point2I > points;
+     cache.rasterize( std::back_inserter( points ), D, D.U(), 1000000 );
+     @endcode
+
+     @tparam TFraction the type chosen to represent fractions, a model
+     of CPositiveIrreducibleFraction (e.g. SternBrocot::Fraction).
+
+     @see Pattern, StandardDSLQ0
+  */
+  template <typename TFraction>
+  class PatternCache
+  {
+  public:
+    typedef TFraction Fraction;
+    typedef PatternCache<TFraction> Self;
+    typedef typename Fraction::Integer Integer;
+    typedef typename Fraction::Quotient Quotient;
+    typedef IntegerComputer<Integer> IC;
+    typedef typename IC::IntegerParamType IntegerParamType;
+    typedef typename IC::Point2I Point2I;
+    typedef typename IC::Vector2I Vector2I;
+    typedef DGtal::uint64_t Word;
+    typedef DGtal::uint64_t Size;
+
+    /**
+       The precomputed descriptor of the pattern of some slope p/q.
+       Its length n=p+q must be lower than 2^31.
+    */
+    class Descriptor
+    {
+    public:
+      /// Computes the descriptor of the pattern of slope @a f.
+      Descriptor( const Fraction & f );
+
+      /// @return the slope of this pattern.
+      Fraction slope() const;
+      /// @return the digital length of the pattern, i.e. p + q.
+      Size length() const;
+      /// @return 'true' iff the step @a i (in [0,length()[) is along y.
+      bool letter( Size i ) const;
+      /// @return the number of steps along y among the @a i first
+      /// ones, @a i in [0,length()].
+      Size nbOnes( Size i ) const;
+      /// @return the point reached after @a i steps from U(0), @a i
+      /// in [0,length()].
+      Point2I point( Size i ) const;
+      /// @return the position of the point of remainder r (mod p+q)
+      /// within the pattern, i.e. the i such that i p = r mod p+q.
+      Size position( IntegerParamType r ) const;
+
+      /// Same as Pattern::rE(), built from the packed word.
+      std::string rE() const;
+      /// Same as Pattern::posU( k ).
+      Integer posU( Quotient k ) const;
+      /// Same as Pattern::posL( k ).
+      Integer posL( Quotient k ) const;
+      /// Same as Pattern::U( k ).
+      Point2I U( Quotient k ) const;
+      /// Same as Pattern::L( k ).
+      Point2I L( Quotient k ) const;
+      /// Same as Pattern::bezout().
+      Vector2I bezout() const;
+      /// Same as Pattern::v().
+      Vector2I v() const;
+      /// @return the packed Christoffel word.
+      const std::vector<Word> & bits() const;
+
+    private:
+      /// The slope of the pattern.
+      Fraction mySlope;
+      /// p, q and p + q.
+      Size myP;
+      Size myQ;
+      Size myLength;
+      /// The letters, 64 per word, the first one in the lowest bit.
+      std::vector<Word> myBits;
+      /// Number of 1's in the words before each word.
+      std::vector<Size> myRanks;
+      /// The position and the coordinates of L(0).
+      Integer myPosL0;
+      Point2I myL0;
+      /// The Bezout vector.
+      Vector2I myBezout;
+      /// The inverse of p modulo p+q.
+      Size myInvP;
+    };
+
+    /// Descriptors are shared between the cache and its users.
+    typedef CountedPtr<Descriptor> DescriptorPtr;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+       Destructor.
+     */
+    ~PatternCache();
+
+    /**
+       Constructor.
+       @param maxNbDescriptors the maximal number of cached descriptors.
+       @param maxLength the patterns longer than this are not cached
+       (their descriptor take about length/4 bytes).
+     */
+    PatternCache( Size maxNbDescriptors = 256, Size maxLength = 1 << 24 );
+
+    // ----------------------- Cache services ---------------------------------
+  public:
+
+    /**
+       @param f any fraction, p+q < 2^31.
+       @return the descriptor of the pattern of slope f, from the
+       cache or computed and inserted in the cache.
+    */
+    DescriptorPtr descriptor( const Fraction & f );
+
+    /// @return the number of cached descriptors.
+    Size size() const;
+    /// @return the number of calls to descriptor() answered by the cache.
+    Size nbHits() const;
+    /// @return the number of calls to descriptor() that computed the
+    /// descriptor.
+    Size nbMisses() const;
+    /// Removes all the descriptors from the cache.
+    void clear();
+
+    // ----------------------- Rasterization ----------------------------------
+  public:
+
+    /**
+       Writes the @a nb consecutive points of the standard DSL of slope
+       @a slope and shift @a mu ( mu <= ax - by < mu + a + b ) from
+       the point @a start, which must belong to it.
+
+       The steps are read from the packed word of the cached pattern,
+       64 at a time. Patterns longer than the maximal cached length
+       are followed with the remainders instead.
+
+       @param out any output iterator on Point2I.
+       @param slope the slope a/b of the DSL.
+       @param mu the shift of the DSL.
+       @param start the first point written.
+       @param nb the number of points written.
+       @return the output iterator after the last written point.
+    */
+    template <typename OutputIterator>
+    OutputIterator rasterize( OutputIterator out, 
+                              const Fraction & slope, IntegerParamType mu,
+                              const Point2I & start, Size nb );
+
+    /**
+       Writes the @a nb consecutive points of the DSL @a dsl from the
+       point @a start, which must belong to it.
+       @see rasterize( OutputIterator, const Fraction &, IntegerParamType, const Point2I &, Size )
+    */
+    template <typename OutputIterator>
+    OutputIterator rasterize( OutputIterator out, 
+                              const StandardDSLQ0<Fraction> & dsl,
+                              const Point2I & start, Size nb );
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+    typedef std::pair<Integer,Integer> Key;
+    typedef std::list< std::pair<Key,DescriptorPtr> > LRUList;
+    typedef std::map< Key, typename LRUList::iterator > Map;
+
+    /// The maximal number of cached descriptors.
+    Size myMaxNbDescriptors;
+    /// The maximal length of cached patterns.
+    Size myMaxLength;
+    /// The cached descriptors, the most recently used first.
+    LRUList myLRU;
+    /// The position of each cached descriptor in myLRU.
+    Map myMap;
+    /// Statistics.
+    Size myNbHits;
+    Size myNbMisses;
+
+    // ------------------------- Hidden services ------------------------------
+  private:
+
+    /**
+     * Copy constructor.
+     * @param other the object to clone.
+     * Forbidden by default.
+     */
+    PatternCache ( const PatternCache & other );
+
+    /**
+     * Assignment.
+     * @param other the object to copy.
+     * @return a reference on 'this'.
+     * Forbidden by default.
+     */
+    PatternCache & operator= ( const PatternCache & other );
+
+  }; // end of class PatternCache
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'PatternCache'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'PatternCache' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TFraction>
+  std::ostream&
+  operator<< ( std::ostream & out, const PatternCache<TFraction> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/arithmetic/PatternCache.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined PatternCache_h
+
+#undef PatternCache_RECURSES
+#endif // else defined(PatternCache_RECURSES)
@@ -43,6 +43,8 @@
 //////////////////////////////////////////////////////////////////////////////
 // Inclusions
 #include <iostream>
+#include <vector>
+#include <utility>
 #include "DGtal/base/Common.h"
 #include "DGtal/arithmetic/IntegerComputer.h"
 #include "DGtal/arithmetic/Pattern.h"
@@ -95,6 +97,10 @@ namespace DGtal
     // Model of CPointPredicate
     typedef typename IC::Point2I Point;
 
+    /// A subsegment query [A,B] for the batch versions of smartDSS
+    /// and reversedSmartDSS.
+    typedef std::pair<Point,Point> Query;
+
     /**
        The iterator to move in the standard digital straight line,
        point by point. To move from A to B on the DSL D, visiting
@@ -357,6 +363,55 @@ namespace DGtal
     */
     Self smartDSS( const Point & A, const Point & B ) const;
 
+    /**
+       Batch version of smartDSS. Computes the exact characteristics
+       of many subsegments of this DSL.
+
+       The DSL is invariant by translation of v(), hence each query is
+       first translated within the first period. The queries are then
+       sorted by their starting point within the pattern and, for a
+       given starting point, by increasing ending point. The queries
+       of a group share the same descent in the Stern-Brocot tree: the
+       descent for [A,B] is resumed for [A,B'] as long as no decision
+       taken so far would have been different for B', so that the
+       cost of a group is about the cost of its longest query.
+       Identical queries are computed once.
+
+       @param results (output) the minimal DSL containing each
+       subsegment, in the order of the queries.
+
+       @param queries the subsegments [A,B], A and B belonging to this
+       DSL, A < B.
+
+       @param parallel when 'true' and OpenMP is enabled, the groups
+       are processed in parallel. The fractions are then created
+       concurrently: the fraction type must be thread-safe, e.g.
+       ConcurrentSternBrocot::Fraction.
+    */
+    void smartDSS( std::vector<Self> & results,
+                   const std::vector<Query> & queries,
+                   bool parallel = false ) const;
+
+    /**
+       Batch version of reversedSmartDSS. The descent of
+       reversedSmartDSS starts from both ends of the subsegment, hence
+       queries cannot share it: the batch only computes the upper
+       leaning point U() once and splits the queries among threads.
+
+       @param results (output) the minimal DSL containing each
+       subsegment, in the order of the queries.
+
+       @param queries the subsegments [A,B], A and B belonging to this
+       DSL, A < B.
+
+       @param parallel when 'true' and OpenMP is enabled, the queries
+       are processed in parallel (with a thread-safe fraction type,
+       e.g. ConcurrentSternBrocot::Fraction).
+    */
+    void reversedSmartDSS( std::vector<Self> & results,
+                           const std::vector<Query> & queries,
+                           bool parallel = false ) const;
+
     // ----------------------- Interface --------------------------------------
   public:
 
@@ -389,6 +444,71 @@ namespace DGtal
     
     // ------------------------- Internals ------------------------------------
   private:
+
+    /**
+       State of the descent of smartDSS in the Stern-Brocot tree. The
+       horizons are the smallest abscissa, ordinate and distance to A
+       of an ending point B for which some decision of the descent
+       would have been different: the descent may be resumed for any
+       farther ending point below the horizons.
+    */
+    struct SmartDSSState
+    {
+      Pattern<Fraction> p;
+      bool ulu;
+      bool lul;
+      Quotient delta;
+      Point2I U;
+      Point2I L;
+      Point2I Up;
+      Point2I Lp;
+      bool hasHorizonX;
+      bool hasHorizonY;
+      bool hasHorizonN;
+      Integer horizonX;
+      Integer horizonY;
+      UnsignedInteger horizonN;
+    };
+
+    /// A query translated within the first period.
+    struct BatchEntry
+    {
+      Point A;
+      Point B;
+      /// the query was translated by -k v().
+      Integer k;
+      /// index of the query.
+      std::size_t index;
+    };
+
+    /// Orders the entries by starting point, then by ending point.
+    struct BatchEntryLess
+    {
+      bool operator()( const BatchEntry & e1, const BatchEntry & e2 ) const;
+    };
+
+    /// Starts the descent of smartDSS for [A,B] (vertical part).
+    void smartDSSStart( SmartDSSState & state,
+                        const Point & A, const Point & B ) const;
+
+    /// Continues the descent of smartDSS for [A,B] up to B.
+    void smartDSSContinue( SmartDSSState & state,
+                           const Point & A, const Point & B ) const;
+
+    /// @return 'true' iff the descent [state] computed for [A,B] is
+    /// also valid for the farther point B'.
+    static bool smartDSSResumable( const SmartDSSState & state,
+                                   const Point & A, const Point & B2 );
+
+    /// Translates the queries within the first period, sorts them and
+    /// computes the first entry of each group of same starting point.
+    void batchEntries( std::vector<BatchEntry> & entries,
+                       std::vector<std::size_t> & groups,
+                       const std::vector<Query> & queries ) const;
+
+    /// @return the DSL [dsl] translated by k v().
+    Self translated( const Self & dsl, IntegerParamType k ) const;
+
     static Fraction deepest( Fraction f1, Fraction f2, Fraction f3 );
     static Fraction deepest( Fraction f1, Fraction f2 );
   }; // end of class StandardDSLQ0
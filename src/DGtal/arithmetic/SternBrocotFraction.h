@@ -0,0 +1,327 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file SternBrocotFraction.h
+ * @author Jacques-Olivier Lachaud (\c jacques-olivier.lachaud@univ-savoie.fr )
+ * Laboratory of Mathematics (CNRS, UMR 5127), University of Savoie, France
+ * @author Xavier Provençal (\c xavier.provencal@univ-savoie.fr )
+ * Laboratory of Mathematics (CNRS, UMR 5127), University of Savoie, France
+ *
+ * @date 2026/10/19
+ *
+ * Header file for template class SternBrocotFraction, the fractions
+ * of SternBrocot and ConcurrentSternBrocot.
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(SternBrocotFraction_RECURSES)
+#error Recursive header files inclusion detected in SternBrocotFraction.h
+#else // defined(SternBrocotFraction_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define SternBrocotFraction_RECURSES
+
+#if !defined SternBrocotFraction_h
+/** Prevents repeated inclusion of headers. */
+#define SternBrocotFraction_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include <utility>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/InputIteratorWithRankOnSequence.h"
+#include "DGtal/kernel/NumberTraits.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class SternBrocotFraction
+  /**
+     @brief This fraction is a model of CPositiveIrreducibleFraction.
+
+     It represents a positive irreducible fraction, i.e. some p/q
+     qith gcd(p,q)=1. It is the type SternBrocot::Fraction (and
+     ConcurrentSternBrocot::Fraction). This representation of a
+     fraction is simply a pointer to the corresponding node in the
+     tree. The nodes are created by left(), with the methods newNode
+     and setLeftDescendant of the tree, which declares this class as
+     a friend.
+
+     @tparam TSternBrocotTree the tree of the fraction (SternBrocot or
+     ConcurrentSternBrocot).
+  */
+  template <typename TSternBrocotTree>
+  class SternBrocotFraction {
+  public:
+    typedef TSternBrocotTree SternBrocotTree;
+    typedef typename SternBrocotTree::Integer Integer;
+    typedef typename SternBrocotTree::Quotient Quotient;
+    typedef typename SternBrocotTree::Node Node;
+    typedef SternBrocotFraction<SternBrocotTree> Fraction;
+    typedef Fraction Self;
+    typedef typename NumberTraits<Integer>::UnsignedVersion UnsignedInteger;
+    typedef std::pair<Quotient, Quotient> Value;
+    typedef std::vector<Quotient> CFracSequence;
+    typedef InputIteratorWithRankOnSequence<CFracSequence,Quotient> ConstIterator;
+
+    // --------------------- std types ------------------------------
+    typedef Value value_type;
+    typedef ConstIterator const_iterator;
+    typedef const value_type & const_reference;
+
+  private:
+    Node* myNode; 
+
+  public:
+    /** 
+        Any fraction p/q. Complexity is in \f$ \sum_i
+        u_i \f$, where u_i are the partial quotients of p/q.
+        
+        @param aP the numerator (>=0)
+        @param aQ the denominator (>=0)
+        
+        @param ancestor (optional) any ancestor of aP/aQ in the tree
+        (for speed-up).
+        
+        @return the corresponding fraction in the Stern-Brocot tree.
+        
+        NB: Complexity is bounded by \f$ 2 \sum_i u_i \f$, where u_i
+        are the partial quotients of aP/aQ.
+    */
+    SternBrocotFraction( Integer aP, Integer aQ,
+                         Fraction ancestor = SternBrocotTree::zeroOverOne() );
+
+    /**
+	 Default constructor.
+       @param sb_node the associated node (or 0 for null fraction).
+    */
+    SternBrocotFraction( Node* sb_node = 0 );
+
+    /**
+       Copy constructor.
+       @param other the object to clone.
+    */
+    SternBrocotFraction( const Self & other );
+
+    /**
+       Assignment
+       @param other the object to clone.
+       @return a reference to 'this'.
+    */
+    Self& operator=( const Self & other );
+
+    /// @return 'true' iff it is the null fraction 0/0.
+    bool null() const;
+    /// @return its numerator;
+    Integer p() const;
+    /// @return its denominator;
+    Integer q() const;
+    /// @return its quotient (last coefficient of its continued fraction).
+    Quotient u() const;
+    /// @return its depth (1+number of coefficients of its continued fraction).
+    Quotient k() const;
+    /// @return its left descendant (construct it if it does not exist yet).
+    Fraction left() const;
+    /// @return its right descendant (construct it if it does not exist yet).
+    Fraction right() const;
+    /// @return 'true' if it is an even fraction, i.e. its depth k() is even.
+    bool even() const; 
+    /// @return 'true' if it is an odd fraction, i.e. its depth k() is odd.
+    bool odd() const; 
+    /**
+	 @return the father of this fraction in O(1), ie [u0,...,uk]
+	 => [u0,...,uk - 1]
+    */
+    Fraction father() const;
+    /**
+       @param m a quotient between 1 and uk-1.
+	 @return a given father of this fraction in O(uk - m), ie [u0,...,uk]
+	 => [u0,...,m]
+
+       @todo Do it in O(1)... but require to change the data structure.
+    */
+    Fraction father( Quotient m ) const;
+    /**
+	 @return the previous partial of this fraction in O(1), ie
+	 [u0,...,u{k-1},uk] => [u0,...,u{k-1}]. Otherwise said, it is
+	 its ascendant with a smaller depth.
+    */
+    Fraction previousPartial() const;
+    /**
+	 @return the inverse of this fraction in O(1), ie [u0,...,uk]
+	 => [0,u0,...,uk] or [0,u0,...,uk] => [u0,...,uk].
+    */
+    Fraction inverse() const;
+    /**
+	 @param kp the chosen depth of the partial fraction (kp <= k()).
+
+	 @return the partial fraction of depth kp, ie. [u0,...,uk] =>
+	 [u0,...,ukp]
+    */
+    Fraction partial( Quotient kp ) const;
+    /**
+	 @param i a positive integer smaller or equal to k()+2.
+
+	 @return the partial fraction of depth k()-i, ie. [u0,...,uk] =>
+	 [u0,...,u{k-i}]
+    */
+    Fraction reduced( Quotient i ) const;
+
+    /**
+       Modifies this fraction \f$[u_0,...,u_k]\f$ to obtain the
+       fraction \f$[u_0,...,u_k,m]\f$. The depth of the quotient
+       must be given, since continued fractions have two writings
+       \f$[u_0,...,u_k]\f$ and \f$[u_0,...,u_k - 1, 1]\f$.
+
+       Useful to create output iterators, for instance with
+
+       @code
+       typedef ... Fraction; 
+       Fraction f;
+       std::back_insert_iterator<Fraction> itout = std::back_inserter( f );
+       @endcode
+
+       @param quotient the pair \f$(m,k+1)\f$.
+    */
+    void push_back( const std::pair<Quotient, Quotient> & quotient );
+
+    /**
+       Modifies this fraction \f$[u_0,...,u_k]\f$ to obtain the
+       fraction \f$[u_0,...,u_k,m]\f$. The depth of the quotient
+       must be given, since continued fractions have two writings
+       \f$[u_0,...,u_k]\f$ and \f$[u_0,...,u_k - 1, 1]\f$.
+
+       See push_back for creating output iterators.
+
+       @param quotient the pair \f$(m,k+1)\f$.
+    */         
+    void pushBack( const std::pair<Quotient, Quotient> & quotient );
+
+    /**
+	 Splitting formula, O(1) time complexity. This fraction should
+	 not be 0/1 or 1/0. NB: 'this' = [f1] \oplus [f2].
+
+	 @param f1 (returns) the left part of the split.
+	 @param f2 (returns) the right part of the split.
+    */
+    void getSplit( Fraction & f1, Fraction & f2 ) const; 
+
+    /**
+	 Berstel splitting formula, O(1) time complexity. This
+	 fraction should not be 0/1 or 1/0. NB: 'this' = nb1*[f1]
+	 \oplus nb2*[f2]. Also, if 'this->k' is even then nb1=1,
+	 otherwise nb2=1.
+
+	 @param f1 (returns) the left part of the split (left pattern).
+	 @param nb1 (returns) the number of repetition of the left pattern
+	 @param f2 (returns) the right part of the split (right pattern).
+	 @param nb2 (returns) the number of repetition of the right pattern
+    */
+    void getSplitBerstel( Fraction & f1, Quotient & nb1, 
+			    Fraction & f2, Quotient & nb2 ) const; 
+
+    /**
+	 @param quotients (returns) the coefficients of the continued
+	 fraction of 'this'.
+    */
+    void getCFrac( std::vector<Quotient> & quotients ) const;
+
+    /**
+       @param p1 a numerator.
+       @param q1 a denominator.
+       @return 'true' if this is the fraction p1/q1.
+    */
+    bool equals( Integer p1, Integer q1 ) const;
+
+    /**
+       @param p1 a numerator.
+       @param q1 a denominator.
+       @return 'true' if this is < to the fraction p/q.
+    */
+    bool lessThan( Integer p1, Integer q1 ) const;
+
+    /**
+       @param p1 a numerator.
+       @param q1 a denominator.
+       @return 'true' if this is > to the fraction p1/q1.
+    */
+    bool moreThan( Integer p1, Integer q1 ) const;
+
+    /**
+       @param other any fraction.
+       @return 'true' iff this is equal to other.
+    */
+    bool operator==( const Fraction & other ) const;
+
+    /**
+       @param other any fraction.
+       @return 'true' iff this is different from other.
+    */
+    bool operator!=( const Fraction & other ) const;
+
+    /**
+       @param other any fraction.
+       @return 'true' iff this is < to other.
+    */
+    bool operator<( const Fraction & other ) const;
+
+    /**
+       @param other any fraction.
+       @return 'true' iff this is > to other.
+    */
+    bool operator>( const Fraction & other ) const;
+
+    /**
+     * Writes/Displays the fraction on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+       @return a const iterator pointing on the beginning of the sequence of quotients of this fraction.
+       NB: \f$ O(\sum_i u_i) \f$ operation. 
+    */
+    ConstIterator begin() const;
+
+    /**
+       @return a const iterator pointing after the end of the sequence of quotients of this fraction.
+       NB: O(1) operation.
+    */
+    ConstIterator end() const;
+    
+  };
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/arithmetic/SternBrocotFraction.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined SternBrocotFraction_h
+
+#undef SternBrocotFraction_RECURSES
+#endif // else defined(SternBrocotFraction_RECURSES)
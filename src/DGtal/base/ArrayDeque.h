@@ -0,0 +1,330 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file ArrayDeque.h
+ * @author Tristan Roussillon (\c tristan.roussillon@liris.cnrs.fr )
+ * Laboratoire d'InfoRmatique en Image et Systèmes d'information - LIRIS (CNRS, UMR 5205), CNRS, France
+ *
+ * @date 2026/10/19
+ *
+ * Header file for module ArrayDeque.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(ArrayDeque_RECURSES)
+#error Recursive header files inclusion detected in ArrayDeque.h
+#else // defined(ArrayDeque_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define ArrayDeque_RECURSES
+
+#if !defined ArrayDeque_h
+/** Prevents repeated inclusion of headers. */
+#define ArrayDeque_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <iterator>
+#include <vector>
+#include "DGtal/base/Common.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class ArrayDeque
+  /**
+   * Description of template class 'ArrayDeque' <p>
+   * \brief Aim: A double-ended queue stored in one contiguous array,
+   * used as a circular buffer.
+   *
+   * Insertions and deletions at both ends are in amortized O(1)
+   * (the array doubles its size when it is full) and do not
+   * allocate anything once the capacity is reached. Contrary to
+   * std::deque, clear() keeps the array, so that the same object
+   * can be filled and emptied many times (e.g. for the consecutive
+   * segments of a curve) without any allocation.
+   *
+   * Only const iterators are provided (random access, invalidated
+   * by any insertion).
+   *
+   * @tparam TValue the type of elements (default constructible and
+   * assignable).
+   *
+   * @see Preimage2D
+   */
+  template <typename TValue>
+  class ArrayDeque
+  {
+    // ----------------------- Types ------------------------------
+  public:
+
+    typedef TValue Value;
+    typedef TValue value_type;
+    typedef std::size_t size_type;
+    typedef std::ptrdiff_t difference_type;
+    typedef TValue & reference;
+    typedef const TValue & const_reference;
+
+    /**
+     * Random access const iterator: a pointer on the deque and the
+     * rank of the element from the front.
+     */
+    class ConstIterator
+      : public std::iterator<std::random_access_iterator_tag,
+                             TValue, std::ptrdiff_t,
+                             const TValue*, const TValue&>
+    {
+    public:
+      ConstIterator() : myDeque( 0 ), myRank( 0 ) {}
+      ConstIterator( const ArrayDeque* aDeque, std::ptrdiff_t aRank )
+        : myDeque( aDeque ), myRank( aRank ) {}
+
+      const TValue & operator*() const { return (*myDeque)[ myRank ]; }
+      const TValue * operator->() const { return &(*myDeque)[ myRank ]; }
+      const TValue & operator[]( std::ptrdiff_t n ) const
+      { return (*myDeque)[ myRank + n ]; }
+
+      ConstIterator & operator++() { ++myRank; return *this; }
+      ConstIterator operator++( int ) { ConstIterator tmp( *this ); ++myRank; return tmp; }
+      ConstIterator & operator--() { --myRank; return *this; }
+      ConstIterator operator--( int ) { ConstIterator tmp( *this ); --myRank; return tmp; }
+      ConstIterator & operator+=( std::ptrdiff_t n ) { myRank += n; return *this; }
+      ConstIterator & operator-=( std::ptrdiff_t n ) { myRank -= n; return *this; }
+      ConstIterator operator+( std::ptrdiff_t n ) const { return ConstIterator( myDeque, myRank + n ); }
+      ConstIterator operator-( std::ptrdiff_t n ) const { return ConstIterator( myDeque, myRank - n ); }
+      std::ptrdiff_t operator-( const ConstIterator & other ) const
+      { return myRank - other.myRank; }
+
+      bool operator==( const ConstIterator & other ) const
+      { return ( myDeque == other.myDeque ) && ( myRank == other.myRank ); }
+      bool operator!=( const ConstIterator & other ) const
+      { return ! ( *this == other ); }
+      bool operator<( const ConstIterator & other ) const
+      { return myRank < other.myRank; }
+      bool operator>( const ConstIterator & other ) const
+      { return myRank > other.myRank; }
+      bool operator<=( const ConstIterator & other ) const
+      { return myRank <= other.myRank; }
+      bool operator>=( const ConstIterator & other ) const
+      { return myRank >= other.myRank; }
+
+    private:
+      const ArrayDeque* myDeque;
+      std::ptrdiff_t myRank;
+    };
+
+    typedef ConstIterator const_iterator;
+    typedef std::reverse_iterator<ConstIterator> ConstReverseIterator;
+    typedef ConstReverseIterator const_reverse_iterator;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Constructor.
+     * @param aCapacity the initial capacity (rounded up to a power of 2).
+     */
+    ArrayDeque( size_type aCapacity = 8 );
+
+    /**
+     * Destructor.
+     */
+    ~ArrayDeque();
+
+    /**
+     * Copy constructor (only the elements are copied).
+     * @param other the object to clone.
+     */
+    ArrayDeque( const ArrayDeque & other );
+
+    /**
+     * Assignment. The array of 'this' is reused if it is large enough.
+     * @param other the object to copy.
+     * @return a reference on 'this'.
+     */
+    ArrayDeque & operator=( const ArrayDeque & other );
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * @return the number of elements.
+     */
+    size_type size() const;
+
+    /**
+     * @return 'true' if there is no element.
+     */
+    bool empty() const;
+
+    /**
+     * @return the number of elements that can be stored without any
+     * allocation.
+     */
+    size_type capacity() const;
+
+    /**
+     * Makes sure that @a n elements can be stored without any
+     * allocation.
+     * @param n the required capacity.
+     */
+    void reserve( size_type n );
+
+    /**
+     * Removes all the elements, but keeps the array.
+     */
+    void clear();
+
+    /**
+     * Inserts an element before the first one.
+     * @param v the value to insert.
+     */
+    void push_front( const Value & v );
+
+    /**
+     * Inserts an element after the last one.
+     * @param v the value to insert.
+     */
+    void push_back( const Value & v );
+
+    /**
+     * Removes the first element.
+     * @pre the deque is not empty.
+     */
+    void pop_front();
+
+    /**
+     * Removes the last element.
+     * @pre the deque is not empty.
+     */
+    void pop_back();
+
+    /**
+     * @param i a rank from the front, less than size().
+     * @return the element of rank @a i.
+     */
+    Value & operator[]( size_type i );
+
+    /**
+     * @param i a rank from the front, less than size().
+     * @return the element of rank @a i.
+     */
+    const Value & operator[]( size_type i ) const;
+
+    /**
+     * @return the first element.
+     */
+    Value & front();
+    /**
+     * @return the first element.
+     */
+    const Value & front() const;
+
+    /**
+     * @return the last element.
+     */
+    Value & back();
+    /**
+     * @return the last element.
+     */
+    const Value & back() const;
+
+    /**
+     * @return an iterator on the first element.
+     */
+    ConstIterator begin() const;
+
+    /**
+     * @return an iterator after the last element.
+     */
+    ConstIterator end() const;
+
+    /**
+     * @return a reverse iterator on the last element.
+     */
+    ConstReverseIterator rbegin() const;
+
+    /**
+     * @return a reverse iterator before the first element.
+     */
+    ConstReverseIterator rend() const;
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    /// The circular array, whose size is a power of 2.
+    std::vector<Value> myData;
+    /// Size of myData minus one.
+    size_type myMask;
+    /// Index of the first element in myData.
+    size_type myFirst;
+    /// Number of elements.
+    size_type mySize;
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+     * Doubles the size of the array (the elements are moved to the
+     * beginning of the new array).
+     */
+    void grow();
+
+  }; // end of class ArrayDeque
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'ArrayDeque'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'ArrayDeque' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TValue>
+  std::ostream&
+  operator<< ( std::ostream & out, const ArrayDeque<TValue> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/base/ArrayDeque.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined ArrayDeque_h
+
+#undef ArrayDeque_RECURSES
+#endif // else defined(ArrayDeque_RECURSES)
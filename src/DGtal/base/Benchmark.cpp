@@ -0,0 +1,508 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file Benchmark.cpp
+ * @author David Coeurjolly (\c david.coeurjolly@liris.cnrs.fr )
+ * Laboratoire d'InfoRmatique en Image et Systèmes d'information - LIRIS (CNRS, UMR 5205), CNRS, France
+ *
+ * @date 2026/10/19
+ *
+ * Implementation of methods defined in Benchmark.h
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include "DGtal/base/Benchmark.h"
+#include "DGtal/base/JSONWriter.h"
+///////////////////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <iomanip>
+
+///////////////////////////////////////////////////////////////////////////////
+// class Benchmark
+///////////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+  /// Name of a clock mode in the JSON output.
+  const char* clockName( DGtal::Clock::Mode mode )
+  {
+    switch ( mode )
+      {
+      case DGtal::Clock::WALL_TIME:        return "wall";
+      case DGtal::Clock::PROCESS_CPU_TIME: return "process-cpu";
+      default:                             return "thread-cpu";
+      }
+  }
+
+  /**
+   * Reader of the JSON written by Benchmark::writeJSON. It accepts
+   * any JSON document, and only interprets the "results" array of the
+   * top-level object.
+   */
+  struct JSONReader
+  {
+    std::istream & in;
+
+    JSONReader( std::istream & anInput ) : in( anInput ) {}
+
+    void error( const std::string & msg )
+    {
+      DGtal::trace.error() << "[Benchmark::readJSON] " << msg << std::endl;
+      throw DGtal::IOException();
+    }
+
+    int peek()
+    {
+      in >> std::ws;
+      return in.peek();
+    }
+
+    void expect( char c )
+    {
+      if ( peek() != c )
+        error( std::string( "expected '" ) + c + "'" );
+      in.get();
+    }
+
+    std::string readString()
+    {
+      expect( '"' );
+      std::string s;
+      for ( ;; )
+        {
+          int c = in.get();
+          if ( c == EOF ) error( "unterminated string" );
+          if ( c == '"' ) return s;
+          if ( c == '\\' )
+            {
+              c = in.get();
+              switch ( c )
+                {
+                case 'n': s += '\n'; break;
+                case 't': s += '\t'; break;
+                case 'r': s += '\r'; break;
+                case 'b': s += '\b'; break;
+                case 'f': s += '\f'; break;
+                case 'u':
+                  {
+                    char hex[ 5 ] = { 0, 0, 0, 0, 0 };
+                    for ( int i = 0; i < 4; ++i ) hex[ i ] = (char) in.get();
+                    s += (char) std::strtol( hex, 0, 16 );
+                    break;
+                  }
+                case EOF: error( "unterminated string" ); break;
+                default: s += (char) c;
+                }
+            }
+          else
+            s += (char) c;
+        }
+    }
+
+    double readNumber()
+    {
+      double v;
+      in >> std::ws >> v;
+      if ( in.fail() ) error( "expected a number" );
+      return v;
+    }
+
+    void readWord( const char* word )
+    {
+      for ( const char* w = word; *w != 0; ++w )
+        if ( in.get() != *w ) error( std::string( "expected " ) + word );
+    }
+
+    void skipValue()
+    {
+      int c = peek();
+      if ( c == '"' ) readString();
+      else if ( c == '{' )
+        {
+          in.get();
+          if ( peek() == '}' ) { in.get(); return; }
+          do
+            {
+              readString();
+              expect( ':' );
+              skipValue();
+            }
+          while ( next( '}' ) );
+        }
+      else if ( c == '[' )
+        {
+          in.get();
+          if ( peek() == ']' ) { in.get(); return; }
+          do skipValue(); while ( next( ']' ) );
+        }
+      else if ( c == 't' ) readWord( "true" );
+      else if ( c == 'f' ) readWord( "false" );
+      else if ( c == 'n' ) readWord( "null" );
+      else readNumber();
+    }
+
+    /// Reads ',' (returns true) or [close] (returns false).
+    bool next( char close )
+    {
+      int c = peek();
+      in.get();
+      if ( c == ',' ) return true;
+      if ( c != close ) error( std::string( "expected ',' or '" ) + close + "'" );
+      return false;
+    }
+
+    void readCounters( DGtal::Benchmark::Result & r )
+    {
+      expect( '{' );
+      if ( peek() == '}' ) { in.get(); return; }
+      do
+        {
+          const std::string key = readString();
+          expect( ':' );
+          const double v = readNumber();
+          for ( unsigned int e = 0; e < DGtal::PerfCounters::NB_EVENTS; ++e )
+            if ( key == DGtal::PerfCounters::name( (DGtal::PerfCounters::Event) e ) )
+              r.counters[ e ] = v;
+        }
+      while ( next( '}' ) );
+    }
+
+    DGtal::Benchmark::Result readResult()
+    {
+      DGtal::Benchmark::Result r;
+      r.size = 0; r.repetitions = 0;
+      r.mean = r.median = r.min = r.max = r.stddev = r.checksum = 0.0;
+      for ( unsigned int e = 0; e < DGtal::PerfCounters::NB_EVENTS; ++e )
+        r.counters[ e ] = 0.0;
+      expect( '{' );
+      if ( peek() == '}' ) { in.get(); return r; }
+      do
+        {
+          const std::string key = readString();
+          expect( ':' );
+          if ( key == "name" )              r.name = readString();
+          else if ( key == "dataset" )      r.dataset = readString();
+          else if ( key == "size" )         r.size = (DGtal::Benchmark::Size) readNumber();
+          else if ( key == "repetitions" )  r.repetitions = (unsigned int) readNumber();
+          else if ( key == "mean_ms" )      r.mean = readNumber();
+          else if ( key == "median_ms" )    r.median = readNumber();
+          else if ( key == "min_ms" )       r.min = readNumber();
+          else if ( key == "max_ms" )       r.max = readNumber();
+          else if ( key == "stddev_ms" )    r.stddev = readNumber();
+          else if ( key == "checksum" )     r.checksum = readNumber();
+          else if ( key == "counters" )     readCounters( r );
+          else skipValue();
+        }
+      while ( next( '}' ) );
+      return r;
+    }
+
+    std::vector<DGtal::Benchmark::Result> readDocument()
+    {
+      std::vector<DGtal::Benchmark::Result> results;
+      expect( '{' );
+      if ( peek() == '}' ) { in.get(); return results; }
+      do
+        {
+          const std::string key = readString();
+          expect( ':' );
+          if ( key == "results" )
+            {
+              expect( '[' );
+              if ( peek() == ']' ) in.get();
+              else
+                do results.push_back( readResult() ); while ( next( ']' ) );
+            }
+          else
+            skipValue();
+        }
+      while ( next( '}' ) );
+      return results;
+    }
+  };
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+DGtal::Benchmark::Benchmark( unsigned int warmup, unsigned int repetitions,
+                             Clock::Mode mode )
+  : myWarmup( warmup ), myRepetitions( repetitions > 0 ? repetitions : 1 ),
+    myMode( mode ), myCounters( 0 )
+{
+}
+
+DGtal::Benchmark::~Benchmark()
+{
+  delete myCounters;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Running services - public :
+
+bool
+DGtal::Benchmark::setCountEvents( bool count )
+{
+  delete myCounters;
+  myCounters = 0;
+  if ( count )
+    {
+      myCounters = new PerfCounters;
+      if ( ! myCounters->isAvailable() )
+        {
+          delete myCounters;
+          myCounters = 0;
+        }
+    }
+  return myCounters != 0;
+}
+
+void
+DGtal::Benchmark::setFilter( const std::string & filter )
+{
+  myFilter = filter;
+}
+
+bool
+DGtal::Benchmark::selected( const std::string & name,
+                            const std::string & dataset ) const
+{
+  return myFilter.empty()
+    || ( name.find( myFilter ) != std::string::npos )
+    || ( dataset.find( myFilter ) != std::string::npos );
+}
+
+void
+DGtal::Benchmark::addResult( const std::string & name,
+                             const std::string & dataset,
+                             Size size, const std::vector<double> & durations,
+                             double checksum )
+{
+  Statistic<double> stat( true );
+  stat.addValues( durations.begin(), durations.end() );
+  stat.terminate();
+  Result r;
+  r.name = name;
+  r.dataset = dataset;
+  r.size = size;
+  r.repetitions = stat.samples();
+  r.mean = stat.mean();
+  r.median = stat.median();
+  r.min = stat.min();
+  r.max = stat.max();
+  r.stddev = ( stat.samples() > 1 ) ? std::sqrt( stat.unbiasedVariance() ) : 0.0;
+  r.checksum = checksum;
+  for ( unsigned int e = 0; e < PerfCounters::NB_EVENTS; ++e )
+    r.counters[ e ] = 0.0;
+  myResults.push_back( r );
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Report services - public :
+
+void
+DGtal::Benchmark::writeJSON( std::ostream & out ) const
+{
+  std::streamsize precision = out.precision();
+  out.precision( 12 );
+  out << "{" << std::endl
+      << "\"dgtal\": \"" << DGTAL_VERSION << "\"," << std::endl
+      << "\"warmup\": " << myWarmup << "," << std::endl
+      << "\"repetitions\": " << myRepetitions << "," << std::endl
+      << "\"clock\": \"" << clockName( myMode ) << "\"," << std::endl
+      << "\"results\": [";
+  for ( Size i = 0; i < myResults.size(); ++i )
+    {
+      const Result & r = myResults[ i ];
+      out << ( i == 0 ? "\n" : ",\n" ) << "{\"name\": ";
+      DGtal::JSONWriter::writeString( out, r.name );
+      out << ", \"dataset\": ";
+      DGtal::JSONWriter::writeString( out, r.dataset );
+      out << ", \"size\": " << r.size
+          << ", \"repetitions\": " << r.repetitions
+          << ", \"mean_ms\": " << r.mean
+          << ", \"median_ms\": " << r.median
+          << ", \"min_ms\": " << r.min
+          << ", \"max_ms\": " << r.max
+          << ", \"stddev_ms\": " << r.stddev
+          << ", \"checksum\": " << r.checksum;
+      if ( myCounters != 0 )
+        {
+          out << ", \"counters\": {";
+          bool first = true;
+          for ( unsigned int e = 0; e < PerfCounters::NB_EVENTS; ++e )
+            if ( myCounters->isAvailable( (PerfCounters::Event) e ) )
+              {
+                out << ( first ? "" : ", " ) << "\""
+                    << PerfCounters::name( (PerfCounters::Event) e )
+                    << "\": " << r.counters[ e ];
+                first = false;
+              }
+          out << "}";
+        }
+      out << "}";
+    }
+  out << std::endl << "]" << std::endl << "}" << std::endl;
+  out.precision( precision );
+}
+
+void
+DGtal::Benchmark::writeTable( std::ostream & out ) const
+{
+  out << "# name dataset size median(ms) mean(ms) min(ms) max(ms) stddev(ms) checksum"
+      << std::endl;
+  for ( Size i = 0; i < myResults.size(); ++i )
+    {
+      const Result & r = myResults[ i ];
+      out << r.name << " " << r.dataset << " " << r.size
+          << " " << r.median << " " << r.mean << " " << r.min
+          << " " << r.max << " " << r.stddev << " " << r.checksum << std::endl;
+    }
+}
+
+std::vector<DGtal::Benchmark::Result>
+DGtal::Benchmark::readJSON( std::istream & in )
+  throw( DGtal::IOException )
+{
+  JSONReader reader( in );
+  return reader.readDocument();
+}
+
+std::vector<DGtal::Benchmark::Result>
+DGtal::Benchmark::readJSON( const std::string & filename )
+  throw( DGtal::IOException )
+{
+  std::ifstream in( filename.c_str() );
+  if ( ! in.good() )
+    {
+      trace.error() << "[Benchmark::readJSON] unable to read "
+                    << filename << std::endl;
+      throw DGtal::IOException();
+    }
+  return readJSON( in );
+}
+
+unsigned int
+DGtal::Benchmark::compare( std::vector<Comparison> & comparisons,
+                           const std::vector<Result> & baseline,
+                           double tolerance ) const
+{
+  comparisons.clear();
+  unsigned int nbFailures = 0;
+  for ( Size i = 0; i < myResults.size(); ++i )
+    {
+      const Result & r = myResults[ i ];
+      Comparison c;
+      c.name = r.name;
+      c.dataset = r.dataset;
+      c.current = r.median;
+      c.baseline = 0.0;
+      c.ratio = 1.0;
+      c.regression = c.improvement = c.checksumChanged = c.missing = false;
+      c.added = true;
+      for ( Size j = 0; c.added && ( j < baseline.size() ); ++j )
+        if ( ( baseline[ j ].name == r.name )
+             && ( baseline[ j ].dataset == r.dataset ) )
+          {
+            const Result & b = baseline[ j ];
+            c.added = false;
+            c.baseline = b.median;
+            c.ratio = ( b.median > 0.0 ) ? r.median / b.median : 1.0;
+            c.regression = c.ratio > 1.0 + tolerance;
+            c.improvement = c.ratio < 1.0 / ( 1.0 + tolerance );
+            c.checksumChanged = std::fabs( r.checksum - b.checksum )
+              > 1e-9 * std::max( 1.0, std::fabs( b.checksum ) );
+          }
+      if ( c.regression ) ++nbFailures;
+      comparisons.push_back( c );
+    }
+  // The cases of the baseline that are not measured any more.
+  for ( Size j = 0; j < baseline.size(); ++j )
+    {
+      const Result & b = baseline[ j ];
+      if ( ! selected( b.name, b.dataset ) ) continue;
+      bool found = false;
+      for ( Size i = 0; ( ! found ) && ( i < myResults.size() ); ++i )
+        found = ( myResults[ i ].name == b.name )
+          && ( myResults[ i ].dataset == b.dataset );
+      if ( found ) continue;
+      Comparison c;
+      c.name = b.name;
+      c.dataset = b.dataset;
+      c.baseline = b.median;
+      c.current = 0.0;
+      c.ratio = 1.0;
+      c.regression = c.improvement = c.checksumChanged = c.added = false;
+      c.missing = true;
+      ++nbFailures;
+      comparisons.push_back( c );
+    }
+  return nbFailures;
+}
+
+void
+DGtal::Benchmark::writeComparisons( std::ostream & out,
+                                    const std::vector<Comparison> & comparisons )
+{
+  out << "# name dataset baseline(ms) current(ms) ratio status" << std::endl;
+  for ( Size i = 0; i < comparisons.size(); ++i )
+    {
+      const Comparison & c = comparisons[ i ];
+      out << c.name << " " << c.dataset << " ";
+      if ( c.added )
+        {
+          out << "- " << c.current << " - NEW" << std::endl;
+          continue;
+        }
+      if ( c.missing )
+        {
+          out << c.baseline << " - - MISSING" << std::endl;
+          continue;
+        }
+      out << c.baseline << " " << c.current << " " << c.ratio << " "
+          << ( c.regression ? "REGRESSION" : c.improvement ? "IMPROVEMENT" : "OK" )
+          << ( c.checksumChanged ? " CHECKSUM-CHANGED" : "" ) << std::endl;
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Interface - public :
+
+void
+DGtal::Benchmark::selfDisplay ( std::ostream & out ) const
+{
+  out << "[Benchmark warmup=" << myWarmup
+      << " repetitions=" << myRepetitions
+      << " clock=" << clockName( myMode )
+      << " results=" << myResults.size();
+  if ( ! myFilter.empty() ) out << " filter=" << myFilter;
+  out << "]";
+}
+
+bool
+DGtal::Benchmark::isValid() const
+{
+  return myRepetitions > 0;
+}
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
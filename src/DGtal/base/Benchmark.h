@@ -0,0 +1,341 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file Benchmark.h
+ * @author David Coeurjolly (\c david.coeurjolly@liris.cnrs.fr )
+ * Laboratoire d'InfoRmatique en Image et Systèmes d'information - LIRIS (CNRS, UMR 5205), CNRS, France
+ *
+ * @date 2026/10/19
+ *
+ * Header file for module Benchmark.cpp
+ *
+ * This file is part of the DGtal library.
+ *
+ * @see testBenchmark.cpp, benchmarkSuite.cpp
+ */
+
+#if defined(Benchmark_RECURSES)
+#error Recursive header files inclusion detected in Benchmark.h
+#else // defined(Benchmark_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define Benchmark_RECURSES
+
+#if !defined Benchmark_h
+/** Prevents repeated inclusion of headers. */
+#define Benchmark_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <string>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/Exceptions.h"
+#include "DGtal/base/Statistic.h"
+#include "DGtal/base/Clock.h"
+#include "DGtal/base/PerfCounters.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // class Benchmark
+  /**
+   * Description of class 'Benchmark' <p>
+   * \brief Aim: Runs timed cases with warmup and repetitions, and
+   * reports their statistics as JSON, possibly compared to a stored
+   * baseline.
+   *
+   * A case is a functor returning a double (a checksum of its result,
+   * so that a change of behavior is detected along with a change of
+   * speed), run on a named dataset. run() calls it warmup() times
+   * without timing it, then repetitions() times, and gathers the
+   * durations in a Statistic: mean, median, min, max and standard
+   * deviation, in milliseconds. The durations are measured with a
+   * Clock, in wall time by default. When setCountEvents() is
+   * enabled, the hardware events of the timed calls are also counted
+   * with PerfCounters (mean per call), if available.
+   *
+   * The results are written by writeJSON() and read back by
+   * readJSON(). compare() matches the results with those of a
+   * baseline by (case,dataset) and flags a regression when the median
+   * time exceeds the baseline one by more than a given tolerance. The
+   * baseline cases selected by the filter but not measured any more
+   * are reported as missing.
+   *
+   * @code
+   * Benchmark bench( 1, 5 );
+   * bench.run( "dt", "ball-r64", nbPoints, MyDTCase( ... ) );
+   * bench.writeJSON( std::cout );
+   * std::vector<Benchmark::Comparison> comparisons;
+   * bench.compare( comparisons, Benchmark::readJSON( "baseline.json" ), 0.1 );
+   * @endcode
+   */
+  class Benchmark
+  {
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    typedef DGtal::uint64_t Size;
+
+    /// The statistics of a case on a dataset.
+    struct Result
+    {
+      std::string name;
+      std::string dataset;
+      /// The size of the dataset (e.g. its number of points).
+      Size size;
+      unsigned int repetitions;
+      double mean;
+      double median;
+      double min;
+      double max;
+      double stddev;
+      /// The value returned by the last call of the case.
+      double checksum;
+      /// The mean numbers of hardware events per timed call (0 when
+      /// not counted).
+      double counters[ PerfCounters::NB_EVENTS ];
+    };
+
+    /// The comparison of a result with the baseline.
+    struct Comparison
+    {
+      std::string name;
+      std::string dataset;
+      /// The median times in the baseline and now (ms).
+      double baseline;
+      double current;
+      /// current / baseline.
+      double ratio;
+      /// Slower than the baseline beyond the tolerance.
+      bool regression;
+      /// Faster than the baseline beyond the tolerance.
+      bool improvement;
+      /// Checksum different from the baseline one.
+      bool checksumChanged;
+      /// The case is not in the baseline.
+      bool added;
+      /// The case of the baseline is not measured any more.
+      bool missing;
+    };
+
+    /**
+     * Constructor.
+     * @param warmup the number of untimed calls before the timed ones.
+     * @param repetitions the number of timed calls (at least 1).
+     * @param mode the time measured by the benchmark.
+     */
+    Benchmark( unsigned int warmup = 1, unsigned int repetitions = 5,
+               Clock::Mode mode = Clock::WALL_TIME );
+
+    /**
+     * Destructor.
+     */
+    ~Benchmark();
+
+    // ----------------------- Running services -------------------------------
+  public:
+
+    /// @return the number of untimed calls.
+    unsigned int warmup() const;
+
+    /// @return the number of timed calls.
+    unsigned int repetitions() const;
+
+    /// @return the time measured by the benchmark.
+    Clock::Mode mode() const;
+
+    /**
+     * Counts (or not) the hardware events of the timed calls, when
+     * PerfCounters are available. The events of the calling thread
+     * only are counted.
+     * @param count when 'true', the events are counted.
+     * @return 'true' if some events are counted.
+     */
+    bool setCountEvents( bool count );
+
+    /**
+     * Only the cases whose name or dataset contains [filter] are run
+     * (all of them when empty).
+     * @param filter any string.
+     */
+    void setFilter( const std::string & filter );
+
+    /**
+     * @param name the name of a case.
+     * @param dataset the name of a dataset.
+     * @return 'true' if the filter selects this case on this dataset.
+     */
+    bool selected( const std::string & name, const std::string & dataset ) const;
+
+    /**
+     * Runs a case on a dataset if the filter selects it, and stores
+     * its result.
+     *
+     * @tparam TFunctor a type with 'double operator()()'.
+     * @param name the name of the case.
+     * @param dataset the name of the dataset.
+     * @param size the size of the dataset.
+     * @param f the case.
+     * @return 'true' if the case was run.
+     */
+    template <typename TFunctor>
+    bool run( const std::string & name, const std::string & dataset,
+              Size size, TFunctor f );
+
+    /// @return the results, in the order of the runs.
+    const std::vector<Result> & results() const;
+
+    /**
+     * Stores a result computed elsewhere.
+     * @param durations the durations of the timed calls (ms).
+     */
+    void addResult( const std::string & name, const std::string & dataset,
+                    Size size, const std::vector<double> & durations,
+                    double checksum );
+
+    // ----------------------- Report services --------------------------------
+  public:
+
+    /**
+     * Writes the results as JSON, one result per line.
+     * @param out the output stream.
+     */
+    void writeJSON( std::ostream & out ) const;
+
+    /**
+     * Writes the results as a table readable by humans.
+     * @param out the output stream.
+     */
+    void writeTable( std::ostream & out ) const;
+
+    /**
+     * Reads results written by writeJSON.
+     * @param in the input stream.
+     * @return the results.
+     */
+    static std::vector<Result> readJSON( std::istream & in )
+      throw( DGtal::IOException );
+
+    /**
+     * Reads results written by writeJSON.
+     * @param filename the name of the file.
+     * @return the results.
+     */
+    static std::vector<Result> readJSON( const std::string & filename )
+      throw( DGtal::IOException );
+
+    /**
+     * Compares the results with a baseline.
+     * @param comparisons (output) one comparison per result, then one
+     * per missing case of the baseline (selected by the filter).
+     * @param baseline the results of the baseline.
+     * @param tolerance the relative tolerance on the median time
+     * (e.g. 0.1 for 10%).
+     * @return the number of regressions and of missing cases.
+     */
+    unsigned int compare( std::vector<Comparison> & comparisons,
+                          const std::vector<Result> & baseline,
+                          double tolerance ) const;
+
+    /**
+     * Writes comparisons as a table readable by humans.
+     * @param out the output stream.
+     * @param comparisons the comparisons.
+     */
+    static void writeComparisons( std::ostream & out,
+                                  const std::vector<Comparison> & comparisons );
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    /// The number of untimed calls.
+    unsigned int myWarmup;
+    /// The number of timed calls.
+    unsigned int myRepetitions;
+    /// The time measured by the benchmark.
+    Clock::Mode myMode;
+    /// The hardware counters (0 when the events are not counted).
+    PerfCounters* myCounters;
+    /// The filter of the cases.
+    std::string myFilter;
+    /// The results.
+    std::vector<Result> myResults;
+
+    // ------------------------- Hidden services ------------------------------
+  private:
+
+    /**
+     * Copy constructor.
+     * @param other the object to clone.
+     * Forbidden by default.
+     */
+    Benchmark ( const Benchmark & other );
+
+    /**
+     * Assignment.
+     * @param other the object to copy.
+     * @return a reference on 'this'.
+     * Forbidden by default.
+     */
+    Benchmark & operator= ( const Benchmark & other );
+
+  }; // end of class Benchmark
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'Benchmark'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'Benchmark' to write.
+   * @return the output stream after the writing.
+   */
+  std::ostream&
+  operator<< ( std::ostream & out, const Benchmark & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/base/Benchmark.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined Benchmark_h
+
+#undef Benchmark_RECURSES
+#endif // else defined(Benchmark_RECURSES)
@@ -44,7 +44,9 @@
 // Inclusions
 #include <iostream>
 #include <cstdlib>
+#include <boost/cstdint.hpp>
 #if ( (defined(UNIX)||defined(unix)||defined(linux)) )
+#include <time.h>
 #include <sys/time.h>
 #elif ( (defined(WIN32)) )
 #include <time.h>
@@ -83,11 +85,42 @@ namespace DGtal
    *   std::cout<< "Duration in ms. : "<< duration <<endl;
    *  \endcode
    *
+   * Each clock keeps its own start time in nanoseconds, so that
+   * clocks can be nested or used concurrently by several threads.
+   * The time is either the wall time (steady clock), the CPU time of
+   * the process (the default, as the former interval timer) or the
+   * CPU time of the calling thread. elapsed() gives the time in
+   * nanoseconds, for kernels too short to be measured in
+   * milliseconds.
+   *
    * @see testClock.cpp
+   * @see TimeAccumulator for scoped timers accumulated per thread.
    */
   class Clock
   {
     // ----------------------- Standard services ------------------------------
+  public:
+
+    /// Time in nanoseconds.
+    typedef boost::uint64_t Time;
+
+    /// The measured time.
+    enum Mode {
+      /// Steady wall time, not affected by changes of the system time.
+      WALL_TIME,
+      /// CPU time of the whole process (all its threads).
+      PROCESS_CPU_TIME,
+      /// CPU time of the calling thread.
+      THREAD_CPU_TIME
+    };
+
+    /**
+     * @param mode the measured time.
+     * @return the current time in nanoseconds, from an arbitrary
+     * origin (only differences are meaningful).
+     */
+    static Time now( Mode mode = WALL_TIME );
+
     // -------------------------- timing services -------------------------------
   public:
     /**
@@ -100,12 +133,24 @@ namespace DGtal
      * @return the time (in ms) since the last 'startClock()'.
      */
     long stopClock();
+
+    /**
+     * @return the time (in ns) since the last 'startClock()'. The
+     * clock is not stopped.
+     */
+    Time elapsed() const;
+
+    /**
+     * @return the measured time.
+     */
+    Mode mode() const;
     
     /**
      * Constructor.
      *
+     * @param mode the measured time (CPU time of the process by default).
      */
-    Clock();
+    Clock( Mode mode = PROCESS_CPU_TIME );
 
     /**
      * Destructor. 
@@ -130,14 +175,10 @@ namespace DGtal
     // ------------------------- Private Datas --------------------------------
   private:
 
-    ///internal timer object;
-#if ( (defined(UNIX)||defined(unix)||defined(linux)) )
-    struct itimerval myTimerInit;
-#elif ( (defined(WIN32)) )
-    clock_t myFirstTick;
-#else
-    struct itimerval myTimerInit;
-#endif
+    ///The measured time.
+    Mode myMode;
+    ///Time (in ns) of the last 'startClock()'.
+    Time myStart;
 
     // ------------------------- Hidden services ------------------------------
   protected:
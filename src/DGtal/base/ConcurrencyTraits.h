@@ -0,0 +1,78 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file ConcurrencyTraits.h
+ * @author Jacques-Olivier Lachaud (\c jacques-olivier.lachaud@univ-savoie.fr )
+ * Laboratory of Mathematics (CNRS, UMR 5127), University of Savoie, France
+ *
+ * @date 2026/10/19
+ *
+ * Traits on the types written concurrently by parallel loops.
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(ConcurrencyTraits_RECURSES)
+#error Recursive header files inclusion detected in ConcurrencyTraits.h
+#else // defined(ConcurrencyTraits_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define ConcurrencyTraits_RECURSES
+
+#if !defined ConcurrencyTraits_h
+/** Prevents repeated inclusion of headers. */
+#define ConcurrencyTraits_h
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  /**
+   * Description of template class 'IsSafeForConcurrentElementWrites' <p>
+   * \brief Aim: Tells whether distinct elements of a std::vector<T>
+   * (e.g. the values of an ImageContainerBySTLVector) may be written
+   * concurrently by several threads.
+   *
+   * It is the case for any type but bool: a std::vector<bool> packs
+   * its elements as bits, and concurrent writes to neighbouring bits
+   * are not safe. A parallel loop writing such elements should be
+   * guarded, e.g. with
+   * @code
+   * #pragma omp parallel for if( IsSafeForConcurrentElementWrites<TValue>::value )
+   * @endcode
+   *
+   * @tparam T the type of the elements.
+   */
+  template <typename T>
+  struct IsSafeForConcurrentElementWrites
+  {
+    static const bool value = true;
+  };
+
+  template <>
+  struct IsSafeForConcurrentElementWrites<bool>
+  {
+    static const bool value = false;
+  };
+
+} // namespace DGtal
+
+#endif // !defined ConcurrencyTraits_h
+
+#undef ConcurrencyTraits_RECURSES
+#endif // else defined(ConcurrencyTraits_RECURSES)
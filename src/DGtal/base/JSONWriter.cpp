@@ -0,0 +1,61 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file JSONWriter.cpp
+ * @author David Coeurjolly (\c david.coeurjolly@liris.cnrs.fr )
+ * Laboratoire d'InfoRmatique en Image et Systèmes d'information - LIRIS (CNRS, UMR 5205), CNRS, France
+ *
+ * @date 2026/10/19
+ *
+ * Implementation of methods defined in JSONWriter.h
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include "DGtal/base/JSONWriter.h"
+///////////////////////////////////////////////////////////////////////////////
+
+#include <cstdio>
+
+///////////////////////////////////////////////////////////////////////////////
+// struct JSONWriter
+///////////////////////////////////////////////////////////////////////////////
+
+void
+DGtal::JSONWriter::writeString( std::ostream & out, const std::string & s )
+{
+  out << '"';
+  for ( std::string::size_type i = 0; i < s.size(); ++i )
+    {
+      const unsigned char c = (unsigned char) s[ i ];
+      if ( ( c == '"' ) || ( c == '\\' ) )
+        out << '\\' << c;
+      else if ( c < 0x20 )
+        {
+          char buf[ 8 ];
+          std::sprintf( buf, "\\u%04x", (unsigned int) c );
+          out << buf;
+        }
+      else
+        out << c;
+    }
+  out << '"';
+}
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,80 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file JSONWriter.h
+ * @author David Coeurjolly (\c david.coeurjolly@liris.cnrs.fr )
+ * Laboratoire d'InfoRmatique en Image et Systèmes d'information - LIRIS (CNRS, UMR 5205), CNRS, France
+ *
+ * @date 2026/10/19
+ *
+ * Header file for module JSONWriter.cpp
+ *
+ * This file is part of the DGtal library.
+ *
+ * @see Profiler.cpp, Benchmark.cpp
+ */
+
+#if defined(JSONWriter_RECURSES)
+#error Recursive header files inclusion detected in JSONWriter.h
+#else // defined(JSONWriter_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define JSONWriter_RECURSES
+
+#if !defined JSONWriter_h
+/** Prevents repeated inclusion of headers. */
+#define JSONWriter_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <string>
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // struct JSONWriter
+  /**
+   * Description of struct 'JSONWriter' <p>
+   * \brief Aim: Groups the helpers shared by the classes writing
+   * JSON files (Profiler, Benchmark).
+   */
+  struct JSONWriter
+  {
+    /**
+     * Writes a string as a JSON string: it is quoted, the quotes and
+     * backslashes are escaped, and the control characters are written
+     * as \\uXXXX.
+     *
+     * @param out the output stream where the string is written.
+     * @param s any string.
+     */
+    static void writeString( std::ostream & out, const std::string & s );
+  }; // end of struct JSONWriter
+
+} // namespace DGtal
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined JSONWriter_h
+
+#undef JSONWriter_RECURSES
+#endif // else defined(JSONWriter_RECURSES)
@@ -0,0 +1,185 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/** 
+ * @file PerfCounters.cpp
+ * @author David Coeurjolly (\c david.coeurjolly@liris.cnrs.fr )
+ * Laboratoire d'InfoRmatique en Image et Systèmes d'information - LIRIS (CNRS, UMR 5205), CNRS, France
+ *
+ * @date 2026/10/19
+ *
+ * Implementation of methods defined in PerfCounters.h
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include "DGtal/base/PerfCounters.h"
+#include <cstring>
+#if defined(__linux__)
+#include <unistd.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <linux/perf_event.h>
+#endif
+///////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////////
+// class PerfCounters
+///////////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+#if defined(__linux__) && defined(__NR_perf_event_open)
+  /// perf_event configuration of each event of PerfCounters.
+  const unsigned long long theConfigs[ DGtal::PerfCounters::NB_EVENTS ] = {
+    PERF_COUNT_HW_CPU_CYCLES,
+    PERF_COUNT_HW_INSTRUCTIONS,
+    PERF_COUNT_HW_CACHE_REFERENCES,
+    PERF_COUNT_HW_CACHE_MISSES,
+    PERF_COUNT_HW_BRANCH_MISSES
+  };
+
+  /// Opens a disabled user space counter of the calling thread.
+  int openCounter( unsigned long long config )
+  {
+    struct perf_event_attr attr;
+    memset( &attr, 0, sizeof( attr ) );
+    attr.type = PERF_TYPE_HARDWARE;
+    attr.size = sizeof( attr );
+    attr.config = config;
+    attr.disabled = 1;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    return (int) syscall( __NR_perf_event_open, &attr, 0, -1, -1, 0 );
+  }
+#endif
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+DGtal::PerfCounters::PerfCounters()
+{
+  for ( unsigned int i = 0; i < NB_EVENTS; ++i )
+    {
+#if defined(__linux__) && defined(__NR_perf_event_open)
+      myFds[ i ] = openCounter( theConfigs[ i ] );
+#else
+      myFds[ i ] = -1;
+#endif
+      myValues[ i ] = 0;
+    }
+}
+
+DGtal::PerfCounters::~PerfCounters()
+{
+#if defined(__linux__)
+  for ( unsigned int i = 0; i < NB_EVENTS; ++i )
+    if ( myFds[ i ] >= 0 )
+      close( myFds[ i ] );
+#endif
+}
+
+const char*
+DGtal::PerfCounters::name( Event event )
+{
+  switch ( event )
+    {
+    case CYCLES:           return "cycles";
+    case INSTRUCTIONS:     return "instructions";
+    case CACHE_REFERENCES: return "cache-references";
+    case CACHE_MISSES:     return "cache-misses";
+    case BRANCH_MISSES:    return "branch-misses";
+    default:               return "unknown";
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Counting services - public :
+
+bool
+DGtal::PerfCounters::isAvailable() const
+{
+  for ( unsigned int i = 0; i < NB_EVENTS; ++i )
+    if ( myFds[ i ] >= 0 ) return true;
+  return false;
+}
+
+void
+DGtal::PerfCounters::start()
+{
+#if defined(__linux__) && defined(__NR_perf_event_open)
+  for ( unsigned int i = 0; i < NB_EVENTS; ++i )
+    if ( myFds[ i ] >= 0 )
+      {
+        ioctl( myFds[ i ], PERF_EVENT_IOC_RESET, 0 );
+        ioctl( myFds[ i ], PERF_EVENT_IOC_ENABLE, 0 );
+      }
+#endif
+}
+
+void
+DGtal::PerfCounters::stop()
+{
+  for ( unsigned int i = 0; i < NB_EVENTS; ++i )
+    {
+      myValues[ i ] = 0;
+#if defined(__linux__) && defined(__NR_perf_event_open)
+      if ( myFds[ i ] >= 0 )
+        {
+          ioctl( myFds[ i ], PERF_EVENT_IOC_DISABLE, 0 );
+          Value v;
+          if ( read( myFds[ i ], &v, sizeof( v ) ) == (ssize_t) sizeof( v ) )
+            myValues[ i ] = v;
+        }
+#endif
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Interface - public :
+
+void
+DGtal::PerfCounters::selfDisplay ( std::ostream & out ) const
+{
+  out << "[PerfCounters";
+  if ( ! isAvailable() )
+    out << " unavailable";
+  for ( unsigned int i = 0; i < NB_EVENTS; ++i )
+    if ( myFds[ i ] >= 0 )
+      out << " " << name( (Event) i ) << "=" << myValues[ i ];
+  out << "]";
+}
+
+bool
+DGtal::PerfCounters::isValid() const
+{
+  return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Implementation of inline functions                                        //
+
+std::ostream&
+DGtal::operator<< ( std::ostream & out, const PerfCounters & object )
+{
+  object.selfDisplay( out );
+  return out;
+}
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
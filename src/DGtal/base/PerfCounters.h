@@ -0,0 +1,207 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file PerfCounters.h
+ * @author David Coeurjolly (\c david.coeurjolly@liris.cnrs.fr )
+ * Laboratoire d'InfoRmatique en Image et Systèmes d'information - LIRIS (CNRS, UMR 5205), CNRS, France
+ *
+ * @date 2026/10/19
+ *
+ * Header file for module PerfCounters.cpp
+ *
+ * This file is part of the DGtal library.
+ *
+ * @see testPerfCounters.cpp
+ */
+
+#if defined(PerfCounters_RECURSES)
+#error Recursive header files inclusion detected in PerfCounters.h
+#else // defined(PerfCounters_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define PerfCounters_RECURSES
+
+#if !defined PerfCounters_h
+/** Prevents repeated inclusion of headers. */
+#define PerfCounters_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <boost/cstdint.hpp>
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // class PerfCounters
+  /**
+   * Description of class 'PerfCounters' <p>
+   * \brief Aim: Counts hardware events (cycles, instructions, cache
+   * and branch misses) of the calling thread between start() and
+   * stop(), with the perf_event interface of Linux.
+   *
+   * The counters are optional: on other systems, or when the kernel
+   * forbids them (see /proc/sys/kernel/perf_event_paranoid), or in
+   * virtual machines, isAvailable() is false and the values are 0.
+   * Only the user space events of the thread which constructed the
+   * object are counted.
+   *
+   * @code
+   * PerfCounters counters;
+   * counters.start();
+   * ... // measured code
+   * counters.stop();
+   * if ( counters.isAvailable( PerfCounters::INSTRUCTIONS ) )
+   *   trace.info() << counters << std::endl;
+   * @endcode
+   *
+   * @see Clock, Benchmark.
+   */
+  class PerfCounters
+  {
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    typedef boost::uint64_t Value;
+
+    /// The counted events.
+    enum Event {
+      CYCLES,
+      INSTRUCTIONS,
+      CACHE_REFERENCES,
+      CACHE_MISSES,
+      BRANCH_MISSES,
+      NB_EVENTS
+    };
+
+    /**
+     * Constructor. Opens the counters of the calling thread.
+     */
+    PerfCounters();
+
+    /**
+     * Destructor. Closes the counters.
+     */
+    ~PerfCounters();
+
+    /**
+     * @param event an event.
+     * @return its name.
+     */
+    static const char* name( Event event );
+
+    // ----------------------- Counting services ------------------------------
+  public:
+
+    /**
+     * @return 'true' if at least one event is counted.
+     */
+    bool isAvailable() const;
+
+    /**
+     * @param event an event.
+     * @return 'true' if this event is counted.
+     */
+    bool isAvailable( Event event ) const;
+
+    /**
+     * Resets and starts the counters.
+     */
+    void start();
+
+    /**
+     * Stops the counters and reads their values.
+     */
+    void stop();
+
+    /**
+     * @param event an event.
+     * @return the number of events between the last start() and stop(),
+     * 0 when the event is not counted.
+     */
+    Value value( Event event ) const;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    /// The file descriptors of the counters (-1 when not counted).
+    int myFds[ NB_EVENTS ];
+    /// The values of the counters at the last stop().
+    Value myValues[ NB_EVENTS ];
+
+    // ------------------------- Hidden services ------------------------------
+  private:
+
+    /**
+     * Copy constructor.
+     * @param other the object to clone.
+     * Forbidden by default.
+     */
+    PerfCounters ( const PerfCounters & other );
+
+    /**
+     * Assignment.
+     * @param other the object to copy.
+     * @return a reference on 'this'.
+     * Forbidden by default.
+     */
+    PerfCounters & operator= ( const PerfCounters & other );
+
+  }; // end of class PerfCounters
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'PerfCounters'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'PerfCounters' to write.
+   * @return the output stream after the writing.
+   */
+  std::ostream&
+  operator<< ( std::ostream & out, const PerfCounters & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/base/PerfCounters.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined PerfCounters_h
+
+#undef PerfCounters_RECURSES
+#endif // else defined(PerfCounters_RECURSES)
@@ -0,0 +1,433 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file Profiler.cpp
+ * @author David Coeurjolly (\c david.coeurjolly@liris.cnrs.fr )
+ * Laboratoire d'InfoRmatique en Image et Systèmes d'information - LIRIS (CNRS, UMR 5205), CNRS, France
+ *
+ * @date 2026/10/19
+ *
+ * Implementation of methods defined in Profiler.h
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include "DGtal/base/Profiler.h"
+#include "DGtal/base/JSONWriter.h"
+///////////////////////////////////////////////////////////////////////////////
+
+#include <cstdlib>
+#include <fstream>
+#include <algorithm>
+#ifdef WITH_OPENMP
+#include <omp.h>
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+// class Profiler
+///////////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+  /// Number of profilers created, gives their serial numbers.
+  volatile boost::uint64_t theNbProfilers = 0;
+
+#if defined(__GNUC__)
+  /// Number of threads that used a profiler.
+  volatile boost::uint64_t theNbThreads = 0;
+  /// Identifier of the calling thread (0 before its first use).
+  __thread boost::uint64_t theThreadId = 0;
+  /// Serial number of the last profiler used by the calling thread...
+  __thread boost::uint64_t theCachedProfiler = 0;
+  /// ... and its buffer for the calling thread.
+  __thread void* theCachedBuffer = 0;
+#elif defined(WITH_OPENMP)
+  struct ProfilerLock
+  {
+    omp_lock_t lock;
+    ProfilerLock() { omp_init_lock( &lock ); }
+    ~ProfilerLock() { omp_destroy_lock( &lock ); }
+  };
+  ProfilerLock theProfilerLock;
+#endif
+
+  /// @return an identifier of the calling thread.
+  boost::uint64_t threadId()
+  {
+#if defined(__GNUC__)
+    if ( theThreadId == 0 )
+      theThreadId = __sync_add_and_fetch( &theNbThreads, 1 );
+    return theThreadId;
+#elif defined(WITH_OPENMP)
+    return omp_get_thread_num() + 1;
+#else
+    return 1;
+#endif
+  }
+
+  /// Writes [s] as a CSV field.
+  void writeCSVString( std::ostream & out, const std::string & s )
+  {
+    if ( s.find_first_of( ",\"\n" ) == std::string::npos )
+      {
+        out << s;
+        return;
+      }
+    out << '"';
+    for ( std::string::size_type i = 0; i < s.size(); ++i )
+      {
+        if ( s[ i ] == '"' ) out << '"';
+        out << s[ i ];
+      }
+    out << '"';
+  }
+
+  /// Orders the records by decreasing total time.
+  bool greaterTotal( const DGtal::Profiler::Record & r1,
+                     const DGtal::Profiler::Record & r2 )
+  {
+    return ( r1.total > r2.total )
+      || ( ( r1.total == r2.total ) && ( r1.name < r2.name ) );
+  }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+DGtal::Profiler::Profiler( Size bufferSize )
+  : myBufferSize( bufferSize ), myOrigin( now() ), myLock( 0 ),
+    myDumpFormat( CSV )
+{
+#if defined(__GNUC__)
+  mySerial = __sync_add_and_fetch( &theNbProfilers, 1 );
+#else
+  mySerial = ++theNbProfilers;
+#endif
+}
+
+DGtal::Profiler::~Profiler()
+{
+  if ( ! myDumpFile.empty() && ! write( myDumpFile, myDumpFormat ) )
+    std::cerr << "[Profiler] unable to write " << myDumpFile << std::endl;
+  for ( Size i = 0; i < myBuffers.size(); ++i )
+    delete myBuffers[ i ];
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Recording services - public :
+
+DGtal::Profiler::SiteId
+DGtal::Profiler::site( const std::string & name )
+{
+  lock();
+  std::map<std::string, SiteId>::const_iterator it = mySites.find( name );
+  SiteId id;
+  if ( it != mySites.end() )
+    id = it->second;
+  else
+    {
+      id = (SiteId) myNames.size();
+      myNames.push_back( name );
+      mySites[ name ] = id;
+    }
+  unlock();
+  return id;
+}
+
+std::string
+DGtal::Profiler::name( SiteId id ) const
+{
+  Profiler & self = const_cast<Profiler &>( *this );
+  self.lock();
+  std::string n = ( id < myNames.size() ) ? myNames[ id ] : std::string( "?" );
+  self.unlock();
+  return n;
+}
+
+void
+DGtal::Profiler::clear( Size bufferSize )
+{
+  lock();
+  myBufferSize = bufferSize;
+  for ( Size i = 0; i < myBuffers.size(); ++i )
+    {
+      ThreadBuffer & b = *myBuffers[ i ];
+      b.ring.assign( bufferSize, Event() );
+      b.nbEvents = 0;
+      b.stack.clear();
+      b.stats.clear();
+    }
+  myOrigin = now();
+  unlock();
+}
+
+void
+DGtal::Profiler::clear()
+{
+  clear( myBufferSize );
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Report services - public :
+
+DGtal::Profiler::Size
+DGtal::Profiler::nbThreads() const
+{
+  return myBuffers.size();
+}
+
+DGtal::Profiler::Size
+DGtal::Profiler::nbEvents() const
+{
+  Size nb = 0;
+  for ( Size i = 0; i < myBuffers.size(); ++i )
+    nb += myBuffers[ i ]->nbEvents;
+  return nb;
+}
+
+DGtal::Profiler::Size
+DGtal::Profiler::nbDropped() const
+{
+  Size nb = 0;
+  for ( Size i = 0; i < myBuffers.size(); ++i )
+    {
+      const ThreadBuffer & b = *myBuffers[ i ];
+      if ( b.nbEvents > b.ring.size() )
+        nb += b.nbEvents - b.ring.size();
+    }
+  return nb;
+}
+
+void
+DGtal::Profiler::getEvents( std::vector<Event> & events, Size thread ) const
+{
+  events.clear();
+  if ( thread >= myBuffers.size() ) return;
+  const ThreadBuffer & b = *myBuffers[ thread ];
+  const Size capacity = b.ring.size();
+  const Size n = std::min( b.nbEvents, capacity );
+  for ( Size i = b.nbEvents - n; i < b.nbEvents; ++i )
+    events.push_back( b.ring[ i % capacity ] );
+}
+
+void
+DGtal::Profiler::aggregate( std::vector<Record> & records ) const
+{
+  records.clear();
+  std::vector<Stats> all;
+  for ( Size i = 0; i < myBuffers.size(); ++i )
+    {
+      const std::vector<Stats> & stats = myBuffers[ i ]->stats;
+      if ( stats.size() > all.size() )
+        {
+          Stats zero = { 0, 0, 0 };
+          all.resize( stats.size(), zero );
+        }
+      for ( Size j = 0; j < stats.size(); ++j )
+        {
+          all[ j ].calls += stats[ j ].calls;
+          all[ j ].total += stats[ j ].total;
+          all[ j ].self += stats[ j ].self;
+        }
+    }
+  for ( Size j = 0; j < all.size(); ++j )
+    if ( all[ j ].calls != 0 )
+      {
+        Record r;
+        r.name = name( (SiteId) j );
+        r.calls = all[ j ].calls;
+        r.total = all[ j ].total;
+        r.self = all[ j ].self;
+        records.push_back( r );
+      }
+  std::sort( records.begin(), records.end(), greaterTotal );
+}
+
+void
+DGtal::Profiler::writeChromeTrace( std::ostream & out ) const
+{
+  std::vector<Event> events;
+  std::ios_base::fmtflags flags = out.flags();
+  std::streamsize precision = out.precision();
+  out.setf( std::ios_base::fixed, std::ios_base::floatfield );
+  out.precision( 3 );
+  out << "{\"traceEvents\":[";
+  bool first = true;
+  for ( Size t = 0; t < myBuffers.size(); ++t )
+    {
+      getEvents( events, t );
+      for ( Size i = 0; i < events.size(); ++i )
+        {
+          const Event & e = events[ i ];
+          out << ( first ? "\n" : ",\n" ) << "{\"name\":";
+          DGtal::JSONWriter::writeString( out, name( e.site ) );
+          out << ",\"cat\":\"DGtal\",\"ph\":\"X\",\"pid\":0,\"tid\":" << t
+              << ",\"ts\":"
+              << ( (double) e.begin - (double) myOrigin ) / 1000.0
+              << ",\"dur\":" << (double) ( e.end - e.begin ) / 1000.0
+              << "}";
+          first = false;
+        }
+    }
+  out << "\n],\"displayTimeUnit\":\"ns\"}" << std::endl;
+  out.flags( flags );
+  out.precision( precision );
+}
+
+void
+DGtal::Profiler::writeCSV( std::ostream & out ) const
+{
+  std::vector<Record> records;
+  aggregate( records );
+  out << "name,calls,total_ns,self_ns,mean_ns" << std::endl;
+  for ( Size i = 0; i < records.size(); ++i )
+    {
+      const Record & r = records[ i ];
+      writeCSVString( out, r.name );
+      out << "," << r.calls << "," << r.total << "," << r.self
+          << "," << r.total / r.calls << std::endl;
+    }
+}
+
+bool
+DGtal::Profiler::write( const std::string & filename, Format format ) const
+{
+  std::ofstream out( filename.c_str() );
+  if ( ! out.good() ) return false;
+  if ( format == CHROME_TRACE ) writeChromeTrace( out );
+  else                          writeCSV( out );
+  return out.good();
+}
+
+void
+DGtal::Profiler::dumpAtExit( const std::string & filename, Format format )
+{
+  myDumpFile = filename;
+  myDumpFormat = format;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Interface - public :
+
+void
+DGtal::Profiler::selfDisplay ( std::ostream & out ) const
+{
+  out << "[Profiler sites=" << myNames.size()
+      << " threads=" << nbThreads()
+      << " events=" << nbEvents()
+      << " dropped=" << nbDropped()
+      << " bufferSize=" << myBufferSize << "]";
+}
+
+bool
+DGtal::Profiler::isValid() const
+{
+  return myNames.size() == mySites.size();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Internals - private :
+
+DGtal::Profiler::ThreadBuffer &
+DGtal::Profiler::buffer()
+{
+#if defined(__GNUC__)
+  if ( theCachedProfiler == mySerial )
+    return *static_cast<ThreadBuffer*>( theCachedBuffer );
+  ThreadBuffer* b = findBuffer();
+  theCachedProfiler = mySerial;
+  theCachedBuffer = b;
+  return *b;
+#else
+  return *findBuffer();
+#endif
+}
+
+DGtal::Profiler::ThreadBuffer*
+DGtal::Profiler::findBuffer()
+{
+  const Size thread = threadId();
+  lock();
+  ThreadBuffer* b = 0;
+  for ( Size i = 0; ( b == 0 ) && ( i < myBuffers.size() ); ++i )
+    if ( myBuffers[ i ]->thread == thread )
+      b = myBuffers[ i ];
+  if ( b == 0 )
+    {
+      b = new ThreadBuffer;
+      b->index = myBuffers.size();
+      b->thread = thread;
+      b->ring.resize( myBufferSize );
+      b->nbEvents = 0;
+      b->stack.reserve( 64 );
+      myBuffers.push_back( b );
+    }
+  unlock();
+  return b;
+}
+
+void
+DGtal::Profiler::lock()
+{
+#if defined(__GNUC__)
+  while ( __sync_lock_test_and_set( &myLock, 1 ) )
+    while ( myLock ) ;
+#elif defined(WITH_OPENMP)
+  omp_set_lock( &theProfilerLock.lock );
+#endif
+}
+
+void
+DGtal::Profiler::unlock()
+{
+#if defined(__GNUC__)
+  __sync_lock_release( &myLock );
+#elif defined(WITH_OPENMP)
+  omp_unset_lock( &theProfilerLock.lock );
+#endif
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// DGtal global profiler
+
+namespace DGtal
+{
+  Profiler profiler;
+}
+
+namespace
+{
+  /// Writes DGtal::profiler at exit to the file named by DGTAL_PROFILE.
+  struct ProfilerEnvironment
+  {
+    ProfilerEnvironment()
+    {
+      const char* filename = std::getenv( "DGTAL_PROFILE" );
+      if ( ( filename == 0 ) || ( *filename == 0 ) ) return;
+      const std::string f( filename );
+      const bool json = ( f.size() >= 5 )
+        && ( f.compare( f.size() - 5, 5, ".json" ) == 0 );
+      DGtal::profiler.dumpAtExit( f, json ? DGtal::Profiler::CHROME_TRACE
+                                         : DGtal::Profiler::CSV );
+    }
+  };
+  ProfilerEnvironment theProfilerEnvironment;
+}
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
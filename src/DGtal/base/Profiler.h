@@ -0,0 +1,416 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file Profiler.h
+ * @author David Coeurjolly (\c david.coeurjolly@liris.cnrs.fr )
+ * Laboratoire d'InfoRmatique en Image et Systèmes d'information - LIRIS (CNRS, UMR 5205), CNRS, France
+ *
+ * @date 2026/10/19
+ *
+ * Header file for module Profiler.cpp
+ *
+ * This file is part of the DGtal library.
+ *
+ * @see testProfiler.cpp
+ */
+
+#if defined(Profiler_RECURSES)
+#error Recursive header files inclusion detected in Profiler.h
+#else // defined(Profiler_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define Profiler_RECURSES
+
+#if !defined Profiler_h
+/** Prevents repeated inclusion of headers. */
+#define Profiler_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <string>
+#include <vector>
+#include <map>
+#include <boost/cstdint.hpp>
+#include "DGtal/base/Clock.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // class Profiler
+  /**
+   * Description of class 'Profiler' <p>
+   * \brief Aim: Records named scopes with nanosecond timestamps, with
+   * no output during the measured computation, and reports them as a
+   * Chrome trace or as a flat table.
+   *
+   * A scope is identified by a site, obtained once from its name with
+   * site(). begin() and end() only read the clock and write to the
+   * buffer of the calling thread:
+   * - the completed scopes are stored in a ring buffer of fixed size
+   *   per thread (the oldest ones are overwritten when it is full);
+   * - the number of calls, the total time and the self time (total
+   *   time minus the time of the nested scopes) of each site are
+   *   accumulated per thread, so that they are exact even when the
+   *   ring buffer overflows.
+   *
+   * The reports (writeChromeTrace(), writeCSV(), aggregate()) must be
+   * made when no thread is inside a scope.
+   *
+   * The global object DGtal::profiler is always available. The macro
+   * DGTAL_PROFILE_SCOPE and the recording of the Trace blocks are
+   * compiled only when the flag WITH_PROFILING is set (cmake option
+   * WITH_PROFILING), and cost nothing otherwise. When the environment
+   * variable DGTAL_PROFILE is set to a file name, the profile is
+   * written there at exit, as a Chrome trace if the name ends with
+   * ".json", as CSV otherwise.
+   *
+   * @code
+   * void f()
+   * {
+   *   DGTAL_PROFILE_SCOPE( "f" );
+   *   ...
+   * }
+   * ...
+   * profiler.dumpAtExit( "profile.json", Profiler::CHROME_TRACE );
+   * @endcode
+   *
+   * The Chrome trace may be opened with chrome://tracing or Perfetto.
+   */
+  class Profiler
+  {
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /// Times in nanoseconds, as measured by Clock.
+    typedef Clock::Time Time;
+    typedef boost::uint64_t Size;
+    /// Identifier of a named scope.
+    typedef boost::uint32_t SiteId;
+
+    /// Output formats.
+    enum Format { CHROME_TRACE, CSV };
+
+    /// A completed scope.
+    struct Event
+    {
+      SiteId site;
+      boost::uint32_t depth;
+      Time begin;
+      Time end;
+    };
+
+    /// Aggregated statistics of a site, over all the threads.
+    struct Record
+    {
+      std::string name;
+      Size calls;
+      Time total;
+      Time self;
+    };
+
+    /**
+     * Constructor.
+     * @param bufferSize the number of events kept per thread.
+     */
+    Profiler( Size bufferSize = 1 << 16 );
+
+    /**
+     * Destructor. Writes the profile if dumpAtExit() was called or if
+     * DGTAL_PROFILE is set.
+     */
+    ~Profiler();
+
+    // ----------------------- Recording services -----------------------------
+  public:
+
+    /**
+     * @return the current time in nanoseconds, i.e.
+     * Clock::now( Clock::WALL_TIME ).
+     */
+    static Time now();
+
+    /**
+     * @param name the name of a scope.
+     * @return its identifier, the same for the same name. Thread-safe.
+     */
+    SiteId site( const std::string & name );
+
+    /**
+     * @param id the identifier of a scope.
+     * @return its name.
+     */
+    std::string name( SiteId id ) const;
+
+    /**
+     * Enters the scope [id] in the calling thread.
+     * @param id the identifier returned by site().
+     */
+    void begin( SiteId id );
+
+    /**
+     * Leaves the last scope entered in the calling thread.
+     */
+    void end();
+
+    /**
+     * Removes all the recorded events and statistics, and sets the
+     * size of the ring buffers.
+     * @param bufferSize the number of events kept per thread.
+     */
+    void clear( Size bufferSize );
+
+    /**
+     * Removes all the recorded events and statistics.
+     */
+    void clear();
+
+    // ----------------------- Report services --------------------------------
+  public:
+
+    /// @return the number of threads that recorded scopes.
+    Size nbThreads() const;
+
+    /// @return the number of completed scopes, over all the threads.
+    Size nbEvents() const;
+
+    /// @return the number of events overwritten in the ring buffers.
+    Size nbDropped() const;
+
+    /**
+     * Gets the events still in the ring buffers.
+     * @param events (output) the events of the thread [thread], from
+     * the oldest one.
+     * @param thread a thread index in [0,nbThreads()[.
+     */
+    void getEvents( std::vector<Event> & events, Size thread ) const;
+
+    /**
+     * Aggregates the statistics of all the threads.
+     * @param records (output) one record per site with at least one
+     * call, by decreasing total time.
+     */
+    void aggregate( std::vector<Record> & records ) const;
+
+    /**
+     * Writes the events in the Chrome trace event format (JSON).
+     * @param out the output stream.
+     */
+    void writeChromeTrace( std::ostream & out ) const;
+
+    /**
+     * Writes the aggregated statistics as CSV, one site per line:
+     * name,calls,total_ns,self_ns,mean_ns.
+     * @param out the output stream.
+     */
+    void writeCSV( std::ostream & out ) const;
+
+    /**
+     * Writes the profile to a file.
+     * @param filename the name of the file.
+     * @param format the format of the file.
+     * @return 'true' if the file could be written.
+     */
+    bool write( const std::string & filename, Format format ) const;
+
+    /**
+     * Asks the profile to be written when the profiler is destroyed,
+     * i.e. at the exit of the program for DGtal::profiler.
+     * @param filename the name of the file.
+     * @param format the format of the file.
+     */
+    void dumpAtExit( const std::string & filename, Format format );
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    /// An open scope.
+    struct Frame
+    {
+      SiteId site;
+      Time begin;
+      Time children;
+    };
+
+    /// Statistics of a site in one thread.
+    struct Stats
+    {
+      Size calls;
+      Time total;
+      Time self;
+    };
+
+    /// The data of one thread, only written by this thread.
+    struct ThreadBuffer
+    {
+      /// The index of the buffer in myBuffers.
+      Size index;
+      /// The identifier of the thread.
+      Size thread;
+      /// The ring of completed scopes.
+      std::vector<Event> ring;
+      /// The number of completed scopes since the last clear.
+      Size nbEvents;
+      /// The open scopes.
+      std::vector<Frame> stack;
+      /// The statistics, indexed by site.
+      std::vector<Stats> stats;
+    };
+
+    /// A number identifying this profiler in the thread caches.
+    Size mySerial;
+    /// The size of the ring buffers.
+    Size myBufferSize;
+    /// The time origin of the events.
+    Time myOrigin;
+    /// The names of the sites.
+    std::vector<std::string> myNames;
+    /// The identifier of each name.
+    std::map<std::string, SiteId> mySites;
+    /// The buffers of the threads.
+    std::vector<ThreadBuffer*> myBuffers;
+    /// Lock protecting the names and the list of buffers.
+    volatile int myLock;
+    /// The file written at exit, if any.
+    std::string myDumpFile;
+    /// Its format.
+    Format myDumpFormat;
+
+    // ------------------------- Hidden services ------------------------------
+  private:
+
+    /**
+     * Copy constructor.
+     * @param other the object to clone.
+     * Forbidden by default.
+     */
+    Profiler ( const Profiler & other );
+
+    /**
+     * Assignment.
+     * @param other the object to copy.
+     * @return a reference on 'this'.
+     * Forbidden by default.
+     */
+    Profiler & operator= ( const Profiler & other );
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /// @return the buffer of the calling thread, created on first use.
+    ThreadBuffer & buffer();
+
+    /// Finds or creates the buffer of the calling thread.
+    ThreadBuffer* findBuffer();
+
+    /// Acquires the lock.
+    void lock();
+
+    /// Releases the lock.
+    void unlock();
+
+  }; // end of class Profiler
+
+
+  /////////////////////////////////////////////////////////////////////////////
+  // class ProfileScope
+  /**
+   * Description of class 'ProfileScope' <p>
+   * \brief Aim: Records a scope of DGtal::profiler from its
+   * construction to its destruction.
+   */
+  class ProfileScope
+  {
+  public:
+    /**
+     * Enters the scope.
+     * @param id the identifier returned by Profiler::site().
+     */
+    ProfileScope( Profiler::SiteId id );
+
+    /**
+     * Leaves the scope.
+     */
+    ~ProfileScope();
+
+  private:
+    ProfileScope ( const ProfileScope & other );
+    ProfileScope & operator= ( const ProfileScope & other );
+  }; // end of class ProfileScope
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'Profiler'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'Profiler' to write.
+   * @return the output stream after the writing.
+   */
+  std::ostream&
+  operator<< ( std::ostream & out, const Profiler & object );
+
+  /** DGtal global profiler. */
+  extern Profiler profiler;
+
+} // namespace DGtal
+
+#define DGTAL_PROFILE_CAT2( a, b ) a##b
+#define DGTAL_PROFILE_CAT( a, b ) DGTAL_PROFILE_CAT2( a, b )
+
+#ifdef WITH_PROFILING
+/**
+ * Records the enclosing scope under the name [name] in
+ * DGtal::profiler. The site is looked up once.
+ */
+#define DGTAL_PROFILE_SCOPE( name )                                     \
+  static const DGtal::Profiler::SiteId                                  \
+  DGTAL_PROFILE_CAT( dgtalProfileSite, __LINE__ ) = DGtal::profiler.site( name ); \
+  DGtal::ProfileScope DGTAL_PROFILE_CAT( dgtalProfileScope, __LINE__ ) \
+  ( DGTAL_PROFILE_CAT( dgtalProfileSite, __LINE__ ) )
+#else
+#define DGTAL_PROFILE_SCOPE( name )
+#endif
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/base/Profiler.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined Profiler_h
+
+#undef Profiler_RECURSES
+#endif // else defined(Profiler_RECURSES)
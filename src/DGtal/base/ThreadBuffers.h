@@ -0,0 +1,175 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file ThreadBuffers.h
+ * @author Jacques-Olivier Lachaud (\c jacques-olivier.lachaud@univ-savoie.fr )
+ * Laboratory of Mathematics (CNRS, UMR 5127), University of Savoie, France
+ *
+ * @date 2026/10/19
+ *
+ * Header file for module ThreadBuffers.ih
+ *
+ * This file is part of the DGtal library.
+ *
+ * @see testThreadBuffers.cpp
+ */
+
+#if defined(ThreadBuffers_RECURSES)
+#error Recursive header files inclusion detected in ThreadBuffers.h
+#else // defined(ThreadBuffers_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define ThreadBuffers_RECURSES
+
+#if !defined ThreadBuffers_h
+/** Prevents repeated inclusion of headers. */
+#define ThreadBuffers_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include "DGtal/base/Common.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class ThreadBuffers
+  /**
+   * Description of template class 'ThreadBuffers' <p>
+   * \brief Aim: One output buffer per thread for a parallel loop whose
+   * results must be gathered in the order of the sequential loop.
+   *
+   * Each thread appends its results to local(), then appendTo()
+   * concatenates the buffers in the order of the threads. This gives
+   * the sequential order when the loop has a static schedule without
+   * chunk size: each thread then gets one contiguous block of
+   * iterations, and the blocks follow the order of the threads.
+   * Without WITH_OPENMP, there is a single buffer.
+   *
+   * @code
+   * ThreadBuffers<Value> buffers;
+   * #pragma omp parallel
+   * {
+   *   std::vector<Value> & local = buffers.local();
+   * #pragma omp for schedule(static)
+   *   for ( int i = 0; i < n; ++i )
+   *     compute( i, local );
+   * }
+   * buffers.appendTo( result );
+   * @endcode
+   *
+   * @tparam TValue the type of the elements of the buffers.
+   */
+  template <typename TValue>
+  class ThreadBuffers
+  {
+    // ----------------------- Standard services ------------------------------
+  public:
+    typedef TValue Value;
+    typedef std::vector<Value> Buffer;
+
+    /**
+     * Constructor. One empty buffer per thread that a parallel region
+     * may use.
+     */
+    ThreadBuffers();
+
+    /**
+     * Destructor.
+     */
+    ~ThreadBuffers();
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * @return the buffer of the calling thread.
+     */
+    Buffer & local();
+
+    /**
+     * Appends the buffers, in the order of the threads.
+     * @param out (modified) the output vector.
+     */
+    void appendTo( std::vector<Value> & out ) const;
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+    /// The buffer of each thread.
+    std::vector<Buffer> myBuffers;
+
+    // ------------------------- Hidden services ------------------------------
+  private:
+
+    /**
+     * Copy constructor.
+     * @param other the object to clone.
+     * Forbidden by default.
+     */
+    ThreadBuffers ( const ThreadBuffers & other );
+
+    /**
+     * Assignment.
+     * @param other the object to copy.
+     * @return a reference on 'this'.
+     * Forbidden by default.
+     */
+    ThreadBuffers & operator= ( const ThreadBuffers & other );
+
+  }; // end of class ThreadBuffers
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'ThreadBuffers'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'ThreadBuffers' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TValue>
+  std::ostream&
+  operator<< ( std::ostream & out, const ThreadBuffers<TValue> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/base/ThreadBuffers.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined ThreadBuffers_h
+
+#undef ThreadBuffers_RECURSES
+#endif // else defined(ThreadBuffers_RECURSES)
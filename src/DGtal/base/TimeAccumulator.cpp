@@ -0,0 +1,206 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/** 
+ * @file TimeAccumulator.cpp
+ * @author David Coeurjolly (\c david.coeurjolly@liris.cnrs.fr )
+ * Laboratoire d'InfoRmatique en Image et Systèmes d'information - LIRIS (CNRS, UMR 5205), CNRS, France
+ *
+ * @date 2026/10/19
+ *
+ * Implementation of methods defined in TimeAccumulator.h
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include "DGtal/base/TimeAccumulator.h"
+///////////////////////////////////////////////////////////////////////////////
+
+#ifdef WITH_OPENMP
+namespace
+{
+  /// The identifier of the last accumulator used by the thread.
+  unsigned long cachedId = 0;
+  /// The slot of the thread in this accumulator.
+  void* cachedSlot = 0;
+  /// A variable whose address identifies the thread.
+  char threadKey = 0;
+#pragma omp threadprivate( cachedId, cachedSlot, threadKey )
+  /// The last identifier given to an accumulator.
+  unsigned long lastId = 0;
+}
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+// class TimeAccumulator
+///////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+DGtal::TimeAccumulator::TimeAccumulator( const std::string & name,
+                                         Clock::Mode mode )
+  : myName( name ), myMode( mode ), myId( 0 )
+{
+#ifdef WITH_OPENMP
+#pragma omp critical( DGtal_TimeAccumulator )
+  myId = ++lastId;
+#else
+  mySlots.push_back( new Slot );
+  clear( *mySlots[ 0 ] );
+#endif
+}
+
+DGtal::TimeAccumulator::~TimeAccumulator()
+{
+  for ( unsigned int i = 0; i < mySlots.size(); ++i )
+    delete mySlots[ i ];
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Accumulation services - public :
+
+void
+DGtal::TimeAccumulator::reset()
+{
+  for ( unsigned int i = 0; i < mySlots.size(); ++i )
+    clear( *mySlots[ i ] );
+}
+
+DGtal::TimeAccumulator::Time
+DGtal::TimeAccumulator::total() const
+{
+  Time t = 0;
+  for ( unsigned int i = 0; i < mySlots.size(); ++i )
+    t += mySlots[ i ]->total;
+  return t;
+}
+
+boost::uint64_t
+DGtal::TimeAccumulator::count() const
+{
+  boost::uint64_t n = 0;
+  for ( unsigned int i = 0; i < mySlots.size(); ++i )
+    n += mySlots[ i ]->count;
+  return n;
+}
+
+DGtal::TimeAccumulator::Time
+DGtal::TimeAccumulator::min() const
+{
+  bool found = false;
+  Time t = 0;
+  for ( unsigned int i = 0; i < mySlots.size(); ++i )
+    if ( ( mySlots[ i ]->count > 0 ) && ( ! found || ( mySlots[ i ]->min < t ) ) )
+      {
+        t = mySlots[ i ]->min;
+        found = true;
+      }
+  return t;
+}
+
+DGtal::TimeAccumulator::Time
+DGtal::TimeAccumulator::max() const
+{
+  Time t = 0;
+  for ( unsigned int i = 0; i < mySlots.size(); ++i )
+    if ( mySlots[ i ]->max > t ) t = mySlots[ i ]->max;
+  return t;
+}
+
+double
+DGtal::TimeAccumulator::mean() const
+{
+  const boost::uint64_t n = count();
+  return ( n == 0 ) ? 0.0 : (double) total() / (double) n;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Interface - public :
+
+void
+DGtal::TimeAccumulator::selfDisplay ( std::ostream & out ) const
+{
+  out << "[TimeAccumulator " << myName
+      << " total=" << (double) total() / 1000000.0 << " ms"
+      << " count=" << count()
+      << " mean=" << mean() << " ns"
+      << " min=" << min() << " ns"
+      << " max=" << max() << " ns"
+      << " slots=" << mySlots.size() << "]";
+}
+
+bool
+DGtal::TimeAccumulator::isValid() const
+{
+#ifdef WITH_OPENMP
+  return myId != 0;
+#else
+  return mySlots.size() == 1;
+#endif
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Internals - private :
+
+DGtal::TimeAccumulator::Slot &
+DGtal::TimeAccumulator::slot()
+{
+#ifdef WITH_OPENMP
+  if ( cachedId == myId )
+    return *static_cast<Slot*>( cachedSlot );
+  Slot* s = 0;
+#pragma omp critical( DGtal_TimeAccumulator )
+  {
+    Slot* & threadSlot = myThreadSlots[ &threadKey ];
+    if ( threadSlot == 0 )
+      {
+        threadSlot = new Slot;
+        clear( *threadSlot );
+        mySlots.push_back( threadSlot );
+      }
+    s = threadSlot;
+  }
+  cachedId = myId;
+  cachedSlot = s;
+  return *s;
+#else
+  return *mySlots[ 0 ];
+#endif
+}
+
+void
+DGtal::TimeAccumulator::clear( Slot & s )
+{
+  s.total = 0;
+  s.count = 0;
+  s.min = 0;
+  s.max = 0;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Implementation of inline functions                                        //
+
+std::ostream&
+DGtal::operator<< ( std::ostream & out, const TimeAccumulator & object )
+{
+  object.selfDisplay( out );
+  return out;
+}
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,322 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file TimeAccumulator.h
+ * @author David Coeurjolly (\c david.coeurjolly@liris.cnrs.fr )
+ * Laboratoire d'InfoRmatique en Image et Systèmes d'information - LIRIS (CNRS, UMR 5205), CNRS, France
+ *
+ * @date 2026/10/19
+ *
+ * Header file for module TimeAccumulator.cpp
+ *
+ * This file is part of the DGtal library.
+ *
+ * @see testTimeAccumulator.cpp
+ */
+
+#if defined(TimeAccumulator_RECURSES)
+#error Recursive header files inclusion detected in TimeAccumulator.h
+#else // defined(TimeAccumulator_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define TimeAccumulator_RECURSES
+
+#if !defined TimeAccumulator_h
+/** Prevents repeated inclusion of headers. */
+#define TimeAccumulator_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <string>
+#include <vector>
+#include <map>
+#include <boost/cstdint.hpp>
+#include "DGtal/base/Clock.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // class TimeAccumulator
+  /**
+   * Description of class 'TimeAccumulator' <p>
+   * \brief Aim: Accumulates the durations of a piece of code executed
+   * many times, possibly by several threads, in nanoseconds.
+   *
+   * Each thread adds its durations to its own slot (on its own cache
+   * lines), without synchronization. The totals over
+   * all the threads are computed when they are asked for. The
+   * durations are usually measured by TimerScope objects, which
+   * measure their lifetime with the clock mode of the accumulator.
+   *
+   * @code
+   * TimeAccumulator isSimpleTime( "isSimple", Clock::THREAD_CPU_TIME );
+   * #pragma omp parallel for
+   * for ( long i = 0; i < n; ++i )
+   *   {
+   *     TimerScope scope( isSimpleTime );
+   *     simple[ i ] = object.isSimple( points[ i ] );
+   *   }
+   * trace.info() << isSimpleTime << std::endl;
+   * @endcode
+   *
+   * When DGtal is built WITH_OPENMP, the slot of a thread is created
+   * the first time it adds a duration, and found again through a
+   * threadprivate cache, so that every thread (of any team size, of
+   * a nested team, or not created by OpenMP) has its own slot.
+   * Without OpenMP, there is a single slot and the accumulator must
+   * be used by one thread at a time. The totals must not be read
+   * while threads are adding durations.
+   *
+   * @see Clock, Benchmark, Profiler.
+   */
+  class TimeAccumulator
+  {
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    typedef Clock::Time Time;
+
+    /**
+     * Constructor.
+     *
+     * @param name the name of the accumulated code.
+     * @param mode the time measured by the TimerScope objects.
+     */
+    TimeAccumulator( const std::string & name = "",
+                     Clock::Mode mode = Clock::WALL_TIME );
+
+    /**
+     * Destructor.
+     */
+    ~TimeAccumulator();
+
+    // ----------------------- Accumulation services --------------------------
+  public:
+
+    /**
+     * Adds a duration to the slot of the calling thread.
+     * @param duration a duration in nanoseconds.
+     */
+    void add( Time duration );
+
+    /**
+     * Resets all the slots.
+     */
+    void reset();
+
+    /**
+     * @return the name of the accumulated code.
+     */
+    const std::string & name() const;
+
+    /**
+     * @return the time measured by the TimerScope objects.
+     */
+    Clock::Mode mode() const;
+
+    /**
+     * @return the number of slots, i.e. the number of threads that
+     * have added durations (1 without OpenMP).
+     */
+    unsigned int nbSlots() const;
+
+    /**
+     * @return the total of the durations of all the threads (in ns).
+     */
+    Time total() const;
+
+    /**
+     * @param slot a slot, less than nbSlots().
+     * @return the total of the durations of this slot (in ns).
+     */
+    Time total( unsigned int slot ) const;
+
+    /**
+     * @return the number of durations of all the threads.
+     */
+    boost::uint64_t count() const;
+
+    /**
+     * @param slot a slot, less than nbSlots().
+     * @return the number of durations of this slot.
+     */
+    boost::uint64_t count( unsigned int slot ) const;
+
+    /**
+     * @return the shortest duration (in ns), 0 if none.
+     */
+    Time min() const;
+
+    /**
+     * @return the longest duration (in ns), 0 if none.
+     */
+    Time max() const;
+
+    /**
+     * @return the mean duration (in ns), 0 if none.
+     */
+    double mean() const;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    /**
+     * The durations of one thread. The slots are allocated
+     * separately, and a slot is two cache lines long, so that the
+     * fields of two slots never share a cache line whatever their
+     * alignment.
+     */
+    struct Slot
+    {
+      Time total;
+      boost::uint64_t count;
+      Time min;
+      Time max;
+      char padding[ 2 * 64 - 4 * sizeof( boost::uint64_t ) ];
+    };
+
+    /// The name of the accumulated code.
+    std::string myName;
+    /// The time measured by the TimerScope objects.
+    Clock::Mode myMode;
+    /// The slots of the threads (owned).
+    std::vector<Slot*> mySlots;
+    /// A unique identifier of the accumulator (for the per-thread cache).
+    unsigned long myId;
+    /// The slot of each thread, indexed by a per-thread address.
+    std::map<const void*, Slot*> myThreadSlots;
+
+    // ------------------------- Hidden services ------------------------------
+  private:
+
+    /**
+     * Copy constructor.
+     * @param other the object to clone.
+     * Forbidden by default.
+     */
+    TimeAccumulator ( const TimeAccumulator & other );
+
+    /**
+     * Assignment.
+     * @param other the object to copy.
+     * @return a reference on 'this'.
+     * Forbidden by default.
+     */
+    TimeAccumulator & operator= ( const TimeAccumulator & other );
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+     * @return the slot of the calling thread, created if needed.
+     */
+    Slot & slot();
+
+    /**
+     * Clears a slot.
+     * @param s any slot.
+     */
+    static void clear( Slot & s );
+
+  }; // end of class TimeAccumulator
+
+  /////////////////////////////////////////////////////////////////////////////
+  // class TimerScope
+  /**
+   * Description of class 'TimerScope' <p>
+   * \brief Aim: Measures its lifetime and adds it to a
+   * TimeAccumulator (RAII).
+   *
+   * @code
+   * {
+   *   TimerScope scope( accumulator );
+   *   ... // timed code
+   * }
+   * @endcode
+   */
+  class TimerScope
+  {
+  public:
+
+    /**
+     * Constructor. Starts the timer.
+     * @param accumulator the accumulator receiving the duration.
+     */
+    TimerScope( TimeAccumulator & accumulator );
+
+    /**
+     * Destructor. Adds the duration to the accumulator.
+     */
+    ~TimerScope();
+
+    /**
+     * @return the time (in ns) since the construction.
+     */
+    Clock::Time elapsed() const;
+
+  private:
+    /// The accumulator receiving the duration.
+    TimeAccumulator & myAccumulator;
+    /// The start time.
+    Clock::Time myStart;
+
+    TimerScope ( const TimerScope & other );
+    TimerScope & operator= ( const TimerScope & other );
+  }; // end of class TimerScope
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'TimeAccumulator'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'TimeAccumulator' to write.
+   * @return the output stream after the writing.
+   */
+  std::ostream&
+  operator<< ( std::ostream & out, const TimeAccumulator & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/base/TimeAccumulator.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined TimeAccumulator_h
+
+#undef TimeAccumulator_RECURSES
+#endif // else defined(TimeAccumulator_RECURSES)
@@ -46,6 +46,7 @@
 
 #include "DGtal/base/Config.h"
 #include "DGtal/base/Clock.h"
+#include "DGtal/base/Profiler.h"
 #include "DGtal/base/Assert.h"
 #include "DGtal/base/TraceWriter.h"
 #include "DGtal/base/TraceWriterTerm.h"
@@ -63,6 +64,8 @@ namespace DGtal
    * 
    * Trace objects use a TraceWriter to switch between terminal and file outputs.
    * Methods postfixed with "Debug" contain no code if the compilation flag DEBUG is not set.
+ * When the compilation flag WITH_PROFILING is set, the blocks are
+ * also recorded as scopes of DGtal::profiler.
    *
    *
    * For usage examples, see the testtrace.cpp file.
@@ -116,6 +119,18 @@ namespace DGtal
      */
     long endBlock();
  
+    /**
+     * Sets the time measured by the block clocks (CPU time of the
+     * process by default).
+     * @param mode the measured time.
+     */
+    void setClockMode( Clock::Mode mode );
+
+    /**
+     * @return the time measured by the block clocks.
+     */
+    Clock::Mode clockMode() const;
+ 
     /**
      * Create a string with an indentation prefix for a normal trace.
      * @return the cerr output stream with the prefix
@@ -187,6 +202,9 @@ namespace DGtal
     ///A stack to store the block clocks
 std::stack<Clock*> myClockStack;
 
+    ///The time measured by the block clocks
+    Clock::Mode myClockMode;
+
     // ------------------------- Hidden services ------------------------------
   protected:
 
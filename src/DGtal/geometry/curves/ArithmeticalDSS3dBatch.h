@@ -0,0 +1,315 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file ArithmeticalDSS3dBatch.h
+ * @brief Greedy decomposition of many 3d digital curves into 3d DSS.
+ * @author Tristan Roussillon (\c
+ * tristan.roussillon@liris.cnrs.fr ) Laboratoire d'InfoRmatique en
+ * Image et Systèmes d'information - LIRIS (CNRS, UMR 5205), CNRS,
+ * France
+ *
+ * @date 2026/10/19
+ *
+ * Header file for module ArithmeticalDSS3dBatch.ih
+ *
+ * This file is part of the DGtal library.
+ *
+ * @see testArithDSS3d.cpp testArithDSS3d-benchmark.cpp
+ */
+
+#if defined(ArithmeticalDSS3dBatch_RECURSES)
+#error Recursive header files inclusion detected in ArithmeticalDSS3dBatch.h
+#else // defined(ArithmeticalDSS3dBatch_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define ArithmeticalDSS3dBatch_RECURSES
+
+#if !defined ArithmeticalDSS3dBatch_h
+/** Prevents repeated inclusion of headers. */
+#define ArithmeticalDSS3dBatch_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/kernel/PointVector.h"
+#include "DGtal/kernel/CInteger.h"
+#include "DGtal/geometry/curves/ArithmeticalDSS.h"
+#include "DGtal/geometry/curves/ArithmeticalDSS3d.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class ArithmeticalDSS3dBatch
+  /**
+   * Description of template class 'ArithmeticalDSS3dBatch' <p>
+   * \brief Aim: computes the greedy decomposition into 3d DSS of a
+   * whole set of 3d digital curves.
+   *
+   * The result is the same as the one of
+   * GreedySegmentation<ArithmeticalDSS3d> on each curve (a segment
+   * starts at the last point of the previous one, or at the next
+   * point if they are not connected), but:
+   * - the points of all the curves are projected once onto the three
+   * coordinate planes and stored in three contiguous arrays (one per
+   * plane), the curves being given by their offsets in these arrays;
+   * - the three 2d recognitions are done by ArithmeticalDSS on
+   * plain pointers into these arrays, so that there is neither a
+   * projection adapter nor a copy of 3d points when a point is
+   * added;
+   * - the segments are stored as offsets as well: only the end of
+   * each segment is kept;
+   * - the curves are processed concurrently when DGtal is built
+   * WITH_OPENMP.
+   *
+   * @code
+   ArithmeticalDSS3dBatch<Point,int,4> batch;
+   for ( ... )
+     batch.addCurve( curve.begin(), curve.end() );
+   batch.decompose();
+   for ( unsigned int c = 0; c < batch.nbCurves(); ++c )
+     for ( unsigned int k = 0; k < batch.nbSegments( c ); ++k )
+       {
+         std::pair<Index,Index> s = batch.segment( c, k );
+         ...
+       }
+   * @endcode
+   *
+   * @tparam TPoint the type of 3d points (e.g. PointVector<3,int>).
+   * @tparam TInteger type of scalars used for the DSS parameters
+   * (satisfying CInteger).
+   * @tparam connectivity 4 for standard (6-connected in 3d) DSS or 8
+   * for naive (26-connected in 3d) DSS.
+   */
+  template <typename TPoint, typename TInteger, int connectivity>
+  class ArithmeticalDSS3dBatch
+  {
+    // ----------------------- Types ------------------------------
+  public:
+
+    BOOST_CONCEPT_ASSERT(( CInteger<TInteger> ) );
+    typedef TInteger Integer;
+    typedef TPoint Point3d;
+    typedef typename Point3d::Coordinate Coordinate;
+    typedef PointVector<2,Coordinate> Point2d;
+    typedef std::size_t Index;
+
+    ///2d recognition on the projected points
+    typedef const Point2d* PlanarIterator;
+    typedef ArithmeticalDSS<PlanarIterator,TInteger,connectivity> ArithmeticalDSS2d;
+
+    ///3d recognition (for the parameters of a segment)
+    typedef typename std::vector<Point3d>::const_iterator ConstIterator3d;
+    typedef ArithmeticalDSS3d<ConstIterator3d,TInteger,connectivity> SegmentComputer;
+    typedef typename SegmentComputer::PointD3d PointD3d;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Default constructor: no curve.
+     */
+    ArithmeticalDSS3dBatch();
+
+    /**
+     * Destructor.
+     */
+    ~ArithmeticalDSS3dBatch();
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Removes all the curves and segments.
+     */
+    void clear();
+
+    /**
+     * Reserves the memory for a given number of curves and points.
+     * @param nbCurves the expected number of curves.
+     * @param nbPoints the expected total number of points.
+     */
+    void reserve( Index nbCurves, Index nbPoints );
+
+    /**
+     * Adds a curve (its points are projected and copied).
+     * @tparam TIterator an iterator on 3d points.
+     * @param itb begin iterator
+     * @param ite end iterator
+     * @return the index of the curve.
+     */
+    template <typename TIterator>
+    unsigned int addCurve( const TIterator& itb, const TIterator& ite );
+
+    /**
+     * Computes the greedy decomposition of every curve (and forgets
+     * any previous decomposition).
+     * @return the total number of segments.
+     */
+    Index decompose();
+
+    /**
+     * @return the number of curves.
+     */
+    unsigned int nbCurves() const;
+
+    /**
+     * @param c the index of a curve.
+     * @return its number of points.
+     */
+    Index nbPoints( unsigned int c ) const;
+
+    /**
+     * @param c the index of a curve.
+     * @param i the index of a point in this curve.
+     * @return the point.
+     */
+    Point3d point( unsigned int c, Index i ) const;
+
+    /**
+     * @param c the index of a curve.
+     * @return its number of segments.
+     * @pre decompose() must be called before.
+     */
+    unsigned int nbSegments( unsigned int c ) const;
+
+    /**
+     * @param c the index of a curve.
+     * @param k the index of a segment of this curve.
+     * @return the indices (in the curve) of the first point of the
+     * segment and of the point following the last one.
+     * @pre decompose() must be called before.
+     */
+    std::pair<Index,Index> segment( unsigned int c, unsigned int k ) const;
+
+    /**
+     * Computes the parameters of a segment, like
+     * ArithmeticalDSS3d::getParameters (the segment is recognized
+     * again).
+     *
+     * @param c the index of a curve.
+     * @param k the index of a segment of this curve.
+     * @param direction (returns) the direction vector.
+     * @param intercept (returns) the intercept.
+     * @param thickness (returns) the thickness.
+     * @pre decompose() must be called before.
+     */
+    void getParameters( unsigned int c, unsigned int k,
+                        Point3d& direction, PointD3d& intercept,
+                        PointD3d& thickness ) const;
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    ///Projections of all the points onto the xy, xz and yz planes
+    std::vector<Point2d> myXY;
+    std::vector<Point2d> myXZ;
+    std::vector<Point2d> myYZ;
+
+    ///Offsets of the curves in the arrays of points (size: nbCurves+1)
+    std::vector<Index> myCurveOffsets;
+
+    ///Ends of the segments of all the curves (absolute indices)
+    std::vector<Index> mySegmentEnds;
+
+    ///Offsets of the curves in mySegmentEnds (size: nbCurves+1,
+    ///empty if not decomposed)
+    std::vector<Index> mySegmentOffsets;
+
+  private:
+
+    /**
+     * Copy constructor.
+     * @param other the object to clone.
+     * Forbidden by default.
+     */
+    ArithmeticalDSS3dBatch ( const ArithmeticalDSS3dBatch & other );
+
+    /**
+     * Assignment.
+     * @param other the object to copy.
+     * @return a reference on 'this'.
+     * Forbidden by default.
+     */
+    ArithmeticalDSS3dBatch & operator= ( const ArithmeticalDSS3dBatch & other );
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+     * Greedy decomposition of one curve.
+     * @param begin absolute index of the first point of the curve.
+     * @param end absolute index following the last point.
+     * @param xy,xz,yz (modified) the recognition algorithms, reused
+     * from a curve to another.
+     * @param ends (returns) the absolute ends of the segments.
+     */
+    void decomposeCurve( Index begin, Index end,
+                         ArithmeticalDSS2d & xy, ArithmeticalDSS2d & xz,
+                         ArithmeticalDSS2d & yz,
+                         std::vector<Index> & ends ) const;
+
+    /**
+     * @param i the absolute index of a point followed by another one.
+     * @return 'true' if these two points form a 3d DSS.
+     */
+    bool areConnected( Index i ) const;
+
+  }; // end of class ArithmeticalDSS3dBatch
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'ArithmeticalDSS3dBatch'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'ArithmeticalDSS3dBatch' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TPoint, typename TInteger, int connectivity>
+  std::ostream&
+  operator<< ( std::ostream & out,
+               const ArithmeticalDSS3dBatch<TPoint,TInteger,connectivity> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/geometry/curves/ArithmeticalDSS3dBatch.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined ArithmeticalDSS3dBatch_h
+
+#undef ArithmeticalDSS3dBatch_RECURSES
+#endif // else defined(ArithmeticalDSS3dBatch_RECURSES)
@@ -41,6 +41,7 @@
 //////////////////////////////////////////////////////////////////////////////
 // Inclusions
 #include <iostream>
+#include <vector>
 #include "DGtal/base/Common.h"
 #include <boost/static_assert.hpp>
 #include "DGtal/base/CowPtr.h"
@@ -78,7 +79,22 @@ namespace DGtal
    * @note Joseph O'Rourke, An on-line algorithm for fitting straight lines between data ranges,
   Communications of the ACM, Volume 24, Issue 9, September 1981, 574--578. 
    *
-   * This class is a model of the concept CBidirectionalSegmentComputer. 
+   * Since the preimage cannot be retracted, the first retraction 
+   * computes, in one linear-time pass, the preimages of the 
+   * suffixes (resp. prefixes) of the segment. Only one preimage 
+   * every sqrt(n) pairs is kept (n being the number of pairs), and 
+   * the next sqrt(n) preimages are rebuilt from one of them when 
+   * needed: the cache holds O(sqrt(n)) preimages, and the next 
+   * retractions in the same direction cost O(h) amortized (h being 
+   * the size of the hulls, which is the cost of a copy of a 
+   * preimage), until the segment is extended. A retraction at the 
+   * other end, or an extension, invalidates the cache: alternating 
+   * retractions at both ends cost O(n) each. The preimages, as well 
+   * as the two hulls of the preimage, which are stored in circular 
+   * arrays, are reused from a segment to another without any 
+   * allocation.
+   *
+   * This class is a model of the concept CDynamicBidirectionalSegmentComputer. 
    *
    * It should be used with the Curve object (defined in StdDefs.h)
    * and its IncidentPointsRange as follows:
@@ -314,6 +330,30 @@ namespace DGtal
      */
     bool isOppositeEndConvex();
 
+    // ----------------------- retraction operations --------------------------------------
+
+    /**
+     * Removes the first pair of the segment.
+     *
+     * Nb: in O(n) for the first one, then in O(h) amortized 
+     * (see the class description). 
+     *
+     * @return 'true' if the segment is retracted, 
+     * 'false' if it contains only one pair. 
+     */
+    bool retractForward();
+
+    /**
+     * Removes the last pair of the segment.
+     *
+     * Nb: in O(n) for the first one, then in O(h) amortized 
+     * (see the class description). 
+     *
+     * @return 'true' if the segment is retracted, 
+     * 'false' if it contains only one pair. 
+     */
+    bool retractBackward();
+
     //------------------ display -------------------------------
     /**
      * Writes/Displays the object on an output stream.
@@ -358,6 +398,46 @@ namespace DGtal
      * 'false' otherwise.
      */
     bool myFlagIsCW; 
+    /**
+     * Preimages of the next suffixes (resp. prefixes) of the segment
+     * used by retractForward() (resp. retractBackward()), 
+     * from the shortest one to the longest one. 
+     * The vector is never shrunk, 
+     * only the first @a myCacheSize preimages are valid. 
+     * Not copied. 
+     */
+    std::vector<Preimage> myCache; 
+    /**
+     * Number of valid preimages in @a myCache. 
+     */
+    typename std::vector<Preimage>::size_type myCacheSize; 
+    /**
+     * Preimages of one suffix (resp. prefix) every 
+     * @a myCheckpointStep pairs, from the shortest one to the 
+     * longest one, from which @a myCache is refilled.
+     * The vector is never shrunk, only the first 
+     * @a myNbCheckpoints preimages are valid. Not copied. 
+     */
+    std::vector<Preimage> myCheckpoints; 
+    /**
+     * First (resp. last) pair of each suffix (resp. prefix) 
+     * of @a myCheckpoints. 
+     */
+    std::vector<ConstIterator> myCheckpointIts; 
+    /**
+     * Number of valid preimages in @a myCheckpoints. 
+     */
+    typename std::vector<Preimage>::size_type myNbCheckpoints; 
+    /**
+     * Pair at which the next refill of @a myCache stops. 
+     */
+    ConstIterator myCacheStop; 
+    /**
+     * 1 if @a myCache contains the preimages of the suffixes, 
+     * -1 if it contains the preimages of the prefixes, 
+     * 0 if it is not valid. 
+     */
+    int myCacheState; 
 
     // ------------------------- Hidden services ------------------------------
   protected:
@@ -365,7 +445,44 @@ namespace DGtal
 
   private:
 
-    
+    /**
+     * Computes the preimages of the pairs 
+     * lying between each iterator from @a myEnd - 1 to
+     * @a myBegin + 1 and @a myEnd (if @a isSuffix is 'true'), 
+     * or between @a myBegin and each iterator from 
+     * @a myBegin + 1 to @a myEnd - 1 (otherwise), 
+     * with the orientation given by @a myFlagIsCW, 
+     * and stores one of them every sqrt(n) pairs 
+     * in @a myCheckpoints.
+     * @param isSuffix 'true' for the suffixes, 'false' for the prefixes
+     * @pre the segment contains at least two pairs.
+     */
+    void fillCache(bool isSuffix);
+
+    /**
+     * Fills @a myCache with the preimages lying between 
+     * the longest preimage of @a myCheckpoints, which is removed, 
+     * and @a myCacheStop. 
+     * @param isSuffix 'true' for the suffixes, 'false' for the prefixes
+     * @pre @a myNbCheckpoints > 0
+     */
+    void refillCache(bool isSuffix);
+
+    /**
+     * Sets the next unused preimage of @a myCheckpoints
+     * (added if all are used), which becomes valid. 
+     * @param aPreimage the preimage to store. 
+     * @param anIt the first (resp. last) pair of the suffix 
+     * (resp. prefix) of @a aPreimage.
+     */
+    void pushCheckpoint(const Preimage & aPreimage, const ConstIterator & anIt);
+
+    /**
+     * @return a reference on the next unused preimage of @a myCache
+     * (added if all are used), which becomes valid. 
+     * @param aPair any pair used to construct a new preimage.
+     */
+    Preimage & nextCacheItem(const Pair & aPair);
 
     // ------------------------- Internals ------------------------------------
   private:
@@ -375,7 +492,6 @@ namespace DGtal
 
   }; // end of class GeometricalDSS
 
-
   /**
    * Overloads 'operator<<' for displaying objects of class 'GeometricalDSS'.
    * @param out the output stream where the object is written.
@@ -386,6 +502,16 @@ namespace DGtal
   std::ostream&
   operator<< ( std::ostream & out, const GeometricalDSS<TConstIterator> & object );
 
+  /**
+   * Specialization of SegmentComputerTraits for GeometricalDSS, 
+   * so that the segmentations use its retraction operations. 
+   */
+  template <typename TConstIterator>
+  struct SegmentComputerTraits< GeometricalDSS<TConstIterator> > 
+  {
+    typedef DynamicBidirectionalSegmentComputer Category; 
+  };
+
 } // namespace DGtal
 
 
@@ -0,0 +1,441 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file LabelledImageContours.h
+ * @author Jacques-Olivier Lachaud (\c jacques-olivier.lachaud@univ-savoie.fr )
+ * Laboratory of Mathematics (CNRS, UMR 5807), University of Savoie, France
+ *
+ * @date 2026/10/19
+ *
+ * Header file for module LabelledImageContours.ih
+ *
+ * This file is part of the DGtal library.
+ *
+ * @see testLabelledImageContours.cpp
+ */
+
+#if defined(LabelledImageContours_RECURSES)
+#error Recursive header files inclusion detected in LabelledImageContours.h
+#else // defined(LabelledImageContours_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define LabelledImageContours_RECURSES
+
+#if !defined LabelledImageContours_h
+/** Prevents repeated inclusion of headers. */
+#define LabelledImageContours_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <string>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/topology/helpers/ImageContoursTracker.h"
+#include "DGtal/geometry/curves/FreemanChain.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class LabelledImageContours
+  /**
+     Description of template class 'LabelledImageContours' <p> \brief
+     Aim: extracts at once all the contours (outer boundaries and
+     boundaries of holes) of all the regions of a labelled 2D image,
+     together with their nesting hierarchy.
+
+     Each contour is stored as a Freeman chain (its first pointel and
+     its string of codes, in the direct orientation of the tracking),
+     and may be converted into a FreemanChain or a GridCurve.
+
+     The contours are discovered by a raster scan of the image (see
+     ImageContoursTracker). Every vertical linel receives, on each of
+     its sides, the index of the contour passing through it, so that
+     the hierarchy is deduced from the contours met at the first
+     linel of each contour, like in the border following algorithm
+     of Suzuki and Abe:
+     - the first linel of an outer contour has its region on the
+     right. If the contour met on the left of this linel is a hole
+     contour, it is the parent, otherwise both contours share the
+     same parent;
+     - the first linel of a hole contour has its region on the
+     left. The parent is the outer contour of the region, which is
+     found from the first contour met on the left of the run of
+     pixels of the region containing this linel.
+
+     Hence, the parent of a hole is the outer contour of its region,
+     and the parent of an outer contour is the innermost hole
+     enclosing it (or none). When a background label is given, its
+     contours are tracked (they are needed by the hierarchy) but not
+     stored, and the parents are taken among the stored contours.
+
+     The method computeByBands() splits the rows of the image into
+     bands. Each band links its vertical bels to the next vertical
+     bel of their contour (see ImageContoursTracker::linkVerticalBels)
+     without tracking, and cuts these links into the cycles lying in
+     the band and the pieces of the contours crossing its borders.
+     The pieces are then joined, so that each contour is assigned to
+     the band of its first linel. Each contour is tracked once, and
+     the hierarchy is built. When DGtal is built WITH_OPENMP, the
+     bands, then the contours, are processed concurrently. The
+     result is the same as compute().
+
+     @tparam TKSpace the type of cellular grid space, of dimension 2
+     (e.g. a KhalimskySpaceND<2>).
+
+     @tparam TImage the type of the labelled image, a model of
+     CConstImage (e.g. an ImageContainerBySTLVector).
+
+     @code
+     LabelledImageContours<KSpace,Image> contours( K, image, SurfelAdjacency<2>( true ) );
+     contours.setBackground( 0 );
+     contours.compute();
+     for ( unsigned int i = 0; i < contours.size(); ++i )
+       if ( ! contours[ i ].isHole )
+         {
+           FreemanChain<int> c = contours.freemanChain( i );
+           ...
+         }
+     @endcode
+
+     @see ImageContoursTracker
+   */
+  template <typename TKSpace, typename TImage>
+  class LabelledImageContours
+  {
+    // ----------------------- Types ------------------------------
+  public:
+    typedef TKSpace KSpace;
+    typedef TImage Image;
+    typedef ImageContoursTracker<KSpace, Image> Tracker;
+    typedef typename KSpace::Integer Integer;
+    typedef typename KSpace::Point Point;
+    typedef typename KSpace::SCell SCell;
+    typedef typename Image::Value Value;
+    typedef FreemanChain<Integer> FreemanChainType;
+
+    /**
+       A contour of a region of the image.
+    */
+    struct Contour
+    {
+      /// The label of the region.
+      Value label;
+      /// 'true' if the contour bounds a hole of the region.
+      bool isHole;
+      /// Index of the enclosing contour, or -1.
+      int parent;
+      /// Indices of the contours directly enclosed in this one.
+      std::vector<unsigned int> children;
+      /// The first surfel of the contour.
+      SCell start;
+      /// The first pointel of the chain.
+      Point firstPoint;
+      /// The Freeman codes of the chain.
+      std::string codes;
+    };
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+       Constructor.
+
+       @param K a space of dimension 2 whose bounds strictly contain
+       the domain of the image (i.e. with a margin of one pixel).
+
+       @param anImage the labelled image (only aliased).
+
+       @param aSurfelAdj the surfel adjacency chosen for the tracking.
+    */
+    LabelledImageContours( const KSpace & K, const Image & anImage,
+                           const SurfelAdjacency<2> & aSurfelAdj );
+
+    /**
+     * Destructor.
+     */
+    ~LabelledImageContours();
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+       The contours of the regions having the label @a aLabel are not
+       stored. To be called before compute().
+
+       @param aLabel the label of the background.
+    */
+    void setBackground( const Value & aLabel );
+
+    /**
+       The contours of every region are stored (default).
+    */
+    void unsetBackground();
+
+    /**
+       Extracts all the contours and their hierarchy in a single scan
+       of the image.
+
+       @return the number of stored contours.
+    */
+    unsigned int compute();
+
+    /**
+       Extracts all the contours and their hierarchy by processing
+       independently bands of rows (concurrently when WITH_OPENMP is
+       defined).
+
+       @param nbBands the number of bands (at least 1).
+       @return the number of stored contours.
+    */
+    unsigned int computeByBands( unsigned int nbBands );
+
+    /**
+       @return the number of stored contours.
+    */
+    unsigned int size() const;
+
+    /**
+       @param i the index of a contour.
+       @return the contour.
+    */
+    const Contour & operator[]( unsigned int i ) const;
+
+    /**
+       @return the indices of the contours that are not enclosed by
+       any stored contour.
+    */
+    const std::vector<unsigned int> & roots() const;
+
+    /**
+       @param i the index of a contour.
+       @return the contour as a Freeman chain.
+    */
+    FreemanChainType freemanChain( unsigned int i ) const;
+
+    /**
+       Tracks again a contour and pushes its surfels into the curve.
+
+       @tparam TCurve a curve with a method pushBack( const SCell & ),
+       like GridCurve.
+
+       @param i the index of a contour.
+       @param curve (modified) the curve, which should be empty.
+    */
+    template <typename TCurve>
+    void getGridCurve( unsigned int i, TCurve & curve ) const;
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    /// The cellular space.
+    const KSpace* myKPtr;
+    /// The labelled image.
+    const Image* myImage;
+    /// The tracker of the contours.
+    Tracker myTracker;
+    /// The background label (if myHasBackground).
+    Value myBackground;
+    /// 'true' if the contours of label myBackground are not stored.
+    bool myHasBackground;
+    /// Lower bound of the domain.
+    Point myLower;
+    /// Upper bound of the domain.
+    Point myUpper;
+    /// Number of vertical linels in a row (width + 1).
+    std::size_t myRowSize;
+    /// The stored contours.
+    std::vector<Contour> myContours;
+    /// The contours that are not enclosed.
+    std::vector<unsigned int> myRoots;
+
+    // ------------------------- Hidden services ------------------------------
+  protected:
+
+    /**
+     * Constructor.
+     * Forbidden by default (protected to avoid g++ warnings).
+     */
+    LabelledImageContours();
+
+  private:
+
+    /**
+     * Copy constructor.
+     * @param other the object to clone.
+     * Forbidden by default.
+     */
+    LabelledImageContours ( const LabelledImageContours & other );
+
+    /**
+     * Assignment.
+     * @param other the object to copy.
+     * @return a reference on 'this'.
+     * Forbidden by default.
+     */
+    LabelledImageContours & operator= ( const LabelledImageContours & other );
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+       Contour indices written on both sides of the vertical linels of
+       the rows [row0,row1].
+    */
+    struct LinelMarks
+    {
+      Integer row0;
+      Integer row1;
+      std::vector<int> left;
+      std::vector<int> right;
+    };
+
+    /**
+       Visitor marking the vertical linels of a contour, computing its
+       first linel and (optionally) its Freeman codes. It builds
+       either one given contour, or a new contour appended to a list
+       for each contour reported by the tracker.
+    */
+    struct ContourBuilder
+    {
+      ContourBuilder( const LabelledImageContours & owner, int id,
+                      LinelMarks & marks, Contour* contour );
+      ContourBuilder( const LabelledImageContours & owner,
+                      LinelMarks & marks, std::vector<Contour> & contours );
+      void beginContour( const Value & label );
+      void addSurfel( const SCell & s );
+      void endContour() {}
+
+      const LabelledImageContours* myOwner;
+      int myId;
+      LinelMarks* myMarks;
+      Contour* myContour;
+      std::vector<Contour>* myContours;
+      bool myIsFirst;
+      Value myLabel;
+    };
+
+    /**
+       The part of a contour lying in a band, between the first
+       vertical bel entering the band and the last one before leaving
+       it. The vertical bels are given by their index (see
+       ImageContoursTracker::nextVerticalBel).
+    */
+    struct BandPiece
+    {
+      /// The first vertical bel of the piece.
+      std::size_t entry;
+      /// The vertical bel following the piece, out of the band.
+      std::size_t exit;
+      /// The smallest vertical bel of the piece.
+      std::size_t first;
+    };
+
+    /**
+       Cuts the links of the vertical bels of a band, whose indices
+       lie in [lo,hi), into the contours lying in the band and the
+       pieces of the contours crossing its borders. The links of the
+       rows next to the band must be computed.
+
+       @param lo the first vertical bel index of the band.
+       @param hi the first vertical bel index after the band.
+       @param next the next vertical bel of each vertical bel.
+       @param starts (modified) the first vertical bel of each contour
+       lying in the band is appended, in raster order.
+       @param pieces (modified) the pieces are appended.
+    */
+    void cutBand( std::size_t lo, std::size_t hi,
+                  const std::vector<std::size_t> & next,
+                  std::vector<std::size_t> & starts,
+                  std::vector<BandPiece> & pieces ) const;
+
+    /**
+       @param s the index of a vertical bel.
+       @return the contour starting at this vertical bel (its label,
+       its side and its first surfel).
+    */
+    Contour contourAt( std::size_t s ) const;
+
+    /**
+       Computes the hierarchy of all the contours (including the
+       background ones) from the marks of the whole image, then keeps
+       the stored ones.
+
+       @param all all the contours, in raster order of their first
+       linel.
+       @param marks the marks of the whole image.
+    */
+    void buildHierarchy( std::vector<Contour> & all,
+                         const LinelMarks & marks );
+
+    /**
+       @param marks a set of marks.
+       @param left the pixel on the left of a vertical linel.
+       @return the index of this linel in the marks.
+    */
+    std::size_t linelIndex( const LinelMarks & marks,
+                            const Point & left ) const;
+
+    /**
+       @param label any label.
+       @return 'true' if the contours of this label are stored.
+    */
+    bool isStored( const Value & label ) const;
+
+  }; // end of class LabelledImageContours
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'LabelledImageContours'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'LabelledImageContours' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TKSpace, typename TImage>
+  std::ostream&
+  operator<< ( std::ostream & out,
+               const LabelledImageContours<TKSpace, TImage> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/geometry/curves/LabelledImageContours.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined LabelledImageContours_h
+
+#undef LabelledImageContours_RECURSES
+#endif // else defined(LabelledImageContours_RECURSES)
@@ -195,10 +195,9 @@ void maximalExtension(SC& s, const typename SC::ConstIterator& end) {
  */
 template <typename SC>
 void oppositeEndMaximalExtension(SC& s, const typename SC::ConstIterator& begin, IteratorType ) {
-  //extend one more time if s.begin() == begin
+  //stop if s.begin() == begin
   while ( (s.begin() != begin)
        && (s.extendBackward()) ) {}
-  if (s.begin() == begin) s.extendBackward();
 }
 
 /**
@@ -49,6 +49,7 @@
 #include <iostream>
 #include "DGtal/base/Common.h"
 #include "DGtal/geometry/curves/FP.h"
+#include "DGtal/geometry/curves/estimation/LengthEstimationCache.h"
 //////////////////////////////////////////////////////////////////////////////
 
 namespace DGtal
@@ -107,6 +108,20 @@ namespace DGtal
     void init( const double h, const ConstIterator& itb, const ConstIterator& ite, const bool& isClosed);
     
 
+    /** 
+     * Initialize the measure computation from a shared analysis of
+     * the curve, which avoids segmenting the curve again when several
+     * estimators are evaluated on it.
+     * 
+     * @param h grid size (must be >0).
+     * @param aCache an initialized analysis of the curve.
+     * @tparam TIterator the type of iterator on points used to
+     * initialize @a aCache.
+     */
+    template <typename TIterator>
+    void init( const double h, const LengthEstimationCache<TIterator>& aCache );
+    
+
     /** 
      * Computation of the l1 length of the curve.
      * Complexity: O(|Range|)
@@ -0,0 +1,299 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file LengthEstimationCache.h
+ * @brief Per-curve analysis shared by several length estimators.
+ * @author Tristan Roussillon (\c
+ * tristan.roussillon@liris.cnrs.fr ) Laboratoire d'InfoRmatique en
+ * Image et Systèmes d'information - LIRIS (CNRS, UMR 5205), CNRS,
+ * France
+ *
+ *
+ * @date 2026/10/19
+ *
+ * Header file for module LengthEstimationCache.ih
+ *
+ * This file is part of the DGtal library.
+ *
+ * @see testLengthEstimators.cpp
+ */
+
+#if defined(LengthEstimationCache_RECURSES)
+#error Recursive header files inclusion detected in LengthEstimationCache.h
+#else // defined(LengthEstimationCache_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define LengthEstimationCache_RECURSES
+
+#if !defined LengthEstimationCache_h
+/** Prevents repeated inclusion of headers. */
+#define LengthEstimationCache_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/geometry/curves/GreedyDecomposition.h"
+#include "DGtal/geometry/curves/ArithmeticalDSS.h"
+#include "DGtal/geometry/curves/FP.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class LengthEstimationCache
+  /**
+   * Description of template class 'LengthEstimationCache' <p>
+   * \brief Aim: computes once the data that the global length
+   * estimators need about a digital curve, so that several
+   * estimators may be evaluated on the same curve for the cost of a
+   * single analysis.
+   *
+   * The elementary steps joining consecutive points (and the last
+   * point to the first one if the curve is closed) are extracted in
+   * init(). The polygon of the greedy DSS decomposition and the
+   * faithful polygon (which is computed from the maximal segment
+   * cover of the curve) are only computed the first time they are
+   * required, and then kept. The MLP is obtained from the same FP
+   * object.
+   *
+   * The estimators L1LengthEstimator, TwoStepLocalLengthEstimator
+   * (and its derived classes BLUELocalLengthEstimator and
+   * RosenProffittLocalLengthEstimator), DSSLengthEstimator,
+   * FPLengthEstimator and MLPLengthEstimator may all be initialized
+   * from an instance of this class instead of a range.
+   *
+   * @code
+   PointsRange rp = gridcurve.getPointsRange();
+   LengthEstimationCache<PointsRange::ConstIterator> cache;
+   cache.init( rp.begin(), rp.end(), gridcurve.isClosed() );
+   DSSLengthEstimator<PointsRange::ConstIterator> DSSlength;
+   DSSlength.init( h, cache );
+   MLPLengthEstimator<PointsRange::ConstIterator> MLPlength;
+   MLPlength.init( h, cache ); //the MLP and the FP share the same computation
+   * @endcode
+   *
+   * @note The cache only stores points, not the iterators, so that
+   * it remains valid even if the input range is destroyed.
+   *
+   * @tparam TConstIterator a model of CConstIteratorOnPoints.
+   */
+  template <typename TConstIterator>
+  class LengthEstimationCache
+  {
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    typedef TConstIterator ConstIterator;
+
+    typedef typename IteratorCirculatorTraits<ConstIterator>::Value Point;
+    typedef typename IteratorCirculatorTraits<ConstIterator>::Value Vector;
+
+    typedef std::vector<Point> Polygon;
+    typedef PointVector<2, double> RealPoint;
+    typedef std::vector<RealPoint> RealPolygon;
+
+    ///The segmentations run on the stored copy of the points
+    typedef typename std::vector<Point>::const_iterator PointsConstIterator;
+    typedef ArithmeticalDSS<PointsConstIterator,int,4> DSSComputer;
+    typedef FP<PointsConstIterator,int,4> FaithfulPolygon;
+
+    /**
+     * Default Constructor.
+     */
+    LengthEstimationCache();
+
+    /**
+     * Destructor.
+     */
+    ~LengthEstimationCache();
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Extracts the steps of the curve and forgets any polygon
+     * computed for a previous curve.
+     * Complexity: O(|Range|)
+     *
+     * @param itb begin iterator
+     * @param ite end iterator
+     * @param isClosed true if the input range is closed.
+     */
+    void init( const ConstIterator& itb, const ConstIterator& ite, const bool& isClosed );
+
+    /**
+     * @return 'true' if the input range is closed.
+     * @pre init() method must be called before.
+     */
+    bool isClosed() const;
+
+    /**
+     * @return the number of elementary steps of the curve.
+     * @pre init() method must be called before.
+     */
+    unsigned int nbSteps() const;
+
+    /**
+     * @return the elementary steps of the curve.
+     * @pre init() method must be called before.
+     */
+    const std::vector<Vector>& steps() const;
+
+    /**
+     * @return the number of direct steps, when the steps of the
+     * curve are grouped two by two (an isolated last step counts as
+     * a direct one).
+     * @pre init() method must be called before.
+     * @see TwoStepLocalLengthEstimator
+     */
+    unsigned int nbTwoStepsDirect() const;
+
+    /**
+     * @return the number of pairs of consecutive steps making a
+     * diagonal move, when the steps of the curve are grouped two by
+     * two.
+     * @pre init() method must be called before.
+     * @see TwoStepLocalLengthEstimator
+     */
+    unsigned int nbTwoStepsDiagonal() const;
+
+    /**
+     * @return the vertices of the polygon given by the greedy
+     * decomposition of the curve into DSS (computed at the first
+     * call).
+     * @pre init() method must be called before.
+     */
+    const Polygon& dssPolygon() const;
+
+    /**
+     * @return the vertices of the FP of the curve (computed at the
+     * first call). If the curve is closed, the first vertex is
+     * repeated at the end.
+     * @pre init() method must be called before.
+     */
+    const Polygon& fpPolygon() const;
+
+    /**
+     * @return the vertices of the MLP of the curve (computed at the
+     * first call). If the curve is closed, the first vertex is
+     * repeated at the end.
+     * @pre init() method must be called before.
+     */
+    const RealPolygon& mlpPolygon() const;
+
+    /**
+     * @param aPolygon any sequence of vertices
+     * @return the sum of the euclidean lengths of its edges.
+     * @tparam TPolygon a vector of points, like Polygon or RealPolygon.
+     */
+    template <typename TPolygon>
+    static double polygonLength( const TPolygon& aPolygon );
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    ///Copy of the points of the range
+    std::vector<Point> myPoints;
+
+    ///Steps between consecutive points
+    std::vector<Vector> mySteps;
+
+    ///Counts of the two-step grouping
+    unsigned int myNbTwoStepsDirect;
+    unsigned int myNbTwoStepsDiagonal;
+
+    ///true if the range is closed
+    bool myIsClosed;
+
+    ///Boolean to make sure that init() has been called before.
+    bool myIsInitBefore;
+
+    ///Lazily computed polygons
+    mutable Polygon myDSSPolygon;
+    mutable Polygon myFPPolygon;
+    mutable RealPolygon myMLPPolygon;
+    mutable bool myIsDSSComputed;
+    mutable bool myIsFPComputed;
+
+  private:
+
+    /**
+     * Copy constructor.
+     * @param other the object to clone.
+     * Forbidden by default.
+     */
+    LengthEstimationCache ( const LengthEstimationCache & other );
+
+    /**
+     * Assignment.
+     * @param other the object to copy.
+     * @return a reference on 'this'.
+     * Forbidden by default.
+     */
+    LengthEstimationCache & operator= ( const LengthEstimationCache & other );
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+     * Computes both the FP and the MLP from a single FP object.
+     */
+    void computeFP() const;
+
+  }; // end of class LengthEstimationCache
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'LengthEstimationCache'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'LengthEstimationCache' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename T>
+  std::ostream&
+  operator<< ( std::ostream & out, const LengthEstimationCache<T> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/geometry/curves/estimation/LengthEstimationCache.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined LengthEstimationCache_h
+
+#undef LengthEstimationCache_RECURSES
+#endif // else defined(LengthEstimationCache_RECURSES)
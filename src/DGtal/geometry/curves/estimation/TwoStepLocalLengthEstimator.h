@@ -44,6 +44,7 @@
 // Inclusions
 #include <iostream>
 #include "DGtal/base/Common.h"
+#include "DGtal/geometry/curves/estimation/LengthEstimationCache.h"
 //////////////////////////////////////////////////////////////////////////////
 
 namespace DGtal
@@ -93,6 +94,7 @@ namespace DGtal
     
     /** 
      * Initialize the measure computation.
+     * Complexity: O(|Range|)
      * 
      * @param h grid size (must be >0).
      * @param itb begin iterator
@@ -103,10 +105,23 @@ namespace DGtal
 	       const ConstIterator& ite, 
 	       const bool& isClosed);
     
+    /** 
+     * Initialize the measure computation from a shared analysis of
+     * the curve.
+     * Complexity: O(1)
+     * 
+     * @param h grid size (must be >0).
+     * @param aCache an initialized analysis of the curve.
+     * @tparam TIterator the type of iterator on points used to
+     * initialize @a aCache.
+     */
+    template <typename TIterator>
+    void init( const double h, const LengthEstimationCache<TIterator>& aCache );
+    
 
     /** 
      * Computation of the l1 length of the curve.
-     * Complexity: O(|Range|)
+     * Complexity: O(1)
      * @pre init() method must be called before.
      * 
      * @return the curve length.
@@ -132,9 +147,9 @@ namespace DGtal
     ///Grid size.
     double myH;
 
-    ///Copy of the range.
-    ConstIterator myBeginIt;
-    ConstIterator myEndIt;
+    ///Numbers of direct and diagonal steps.
+    unsigned int myNbDirect;
+    unsigned int myNbDiag;
 
     ///Boolean to make sure that init() has been called before eval().
     bool myIsInitBefore;
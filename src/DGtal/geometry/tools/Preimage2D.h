@@ -41,9 +41,8 @@
 //////////////////////////////////////////////////////////////////////////////
 // Inclusions
 #include <iostream>
-#include <list>
 #include "DGtal/base/Common.h"
-#include "DGtal/base/OpInSTLContainers.h"
+#include "DGtal/base/ArrayDeque.h"
 #include "DGtal/shapes/fromPoints/Point2ShapePredicate.h"
 #include "DGtal/io/Color.h"
 //////////////////////////////////////////////////////////////////////////////
@@ -76,6 +75,11 @@ namespace DGtal
    * vertical segments of increasing x-coordinate) the algorithm of O'Rourke
    * will return the right output.
    *
+   * The two parts of the preimage are stored in ArrayDeque, i.e.
+   * circular arrays: the updates at both ends are in amortized O(1)
+   * and, thanks to init(), the same object may be reused for many
+   * consecutive segments without any allocation.
+   *
    * @tparam Shape  a model of COrientableHypersurface
    *
    * You can define your preimage type from a given shape type as follows:
@@ -100,15 +104,13 @@ namespace DGtal
     typedef typename Shape::Point Point;
     typedef typename Shape::Point Vector;
 
-  private:
-
     //container of points
-    typedef std::list<Point> Container;
+    typedef ArrayDeque<Point> Container;
     //Iterators on the container
-    typedef typename std::list<Point>::iterator ForwardIterator;
-    typedef typename std::list<Point>::reverse_iterator BackwardIterator;
-    typedef typename std::list<Point>::const_iterator ConstForwardIterator;
-    typedef typename std::list<Point>::const_reverse_iterator ConstBackwardIterator;
+    typedef typename Container::ConstIterator ConstForwardIterator;
+    typedef typename Container::ConstReverseIterator ConstBackwardIterator;
+
+  private:
 
     //Predicates used to decide whether the preimage
     //has to be updated or not
@@ -143,6 +145,14 @@ namespace DGtal
      */
     Preimage2D(const Point & firstPoint, const Point & secondPoint, const Shape & aShape );
 
+    /**
+     * Reinitialization with a first straight segment:
+     * the memory allocated so far is kept.
+     * @param firstPoint  the end point of the first straight segment expected to lie in the interior of the separating shapes
+     * @param secondPoint  the end point of the first straight segment expected to lie in the exterior of the separating shapes
+     */
+    void init(const Point & firstPoint, const Point & secondPoint);
+
     /**
      * Destructor. Does nothing.
      */
@@ -264,7 +274,8 @@ namespace DGtal
      * end points of a new segment
      * (adding to the front with respect to a clockwise-oriented scan)
      *
-     * Nb: in O(n)
+     * Nb: in O(n) in the worst case, but in amortized O(1)
+     * (each vertex is removed at most once)
      *
      * @param aP  the end point of the new straight segment expected to lie in the interior of the separating shapes
      * @param aQ  the end point of the new straight segment expected to lie in the exterior of the separating shapes
@@ -280,7 +291,8 @@ namespace DGtal
      * end points of a new segment
      * (adding to the back with respect to a clockwise-oriented scan)
      *
-     * Nb: in O(n)
+     * Nb: in O(n) in the worst case, but in amortized O(1)
+     * (each vertex is removed at most once)
      *
      * @param aP  the end point of the new straight segment expected to lie in the interior of the separating shapes
      * @param aQ  the end point of the new straight segment expected to lie in the exterior of the separating shapes
@@ -398,24 +410,38 @@ namespace DGtal
   private:
 
     /**
-     * Updates the current preimage
+     * Updates the current preimage by removing 
+     * the vertices of @a aContainer that are 
+     * no longer vertices of the preimage 
+     * from its front, while there are at least two vertices
+     *
+     * Nb: in O(n)
+     *
+     * @param aPoint  a new vertex of the preimage,
+     * @param aContainer  the container to be updated
+     *
+     * @tparam Predicate  the type of Predicate
+     */
+    template <typename Predicate>
+    void updateFront(const Point & aPoint, 
+                     Container & aContainer);
+
+    /**
+     * Updates the current preimage by removing 
+     * the vertices of @a aContainer that are 
+     * no longer vertices of the preimage 
+     * from its back, while there are at least two vertices
      *
      * Nb: in O(n)
      *
      * @param aPoint  a new vertex of the preimage,
-     * @param aContainer  the STL-like container to be updated,
-     * @param anIterator  an iterator to its front (resp. back)
-     * @param anEndIterator  an iterator pointing after its back 
-     * (resp. before its front). 
+     * @param aContainer  the container to be updated
      *
-     * @tparam Iterator  the type of Iterator (either Container::iterator or Container::reverse_iterator)
      * @tparam Predicate  the type of Predicate
      */
-    template <typename Iterator, typename Predicate>
-    void update(const Point & aPoint, 
-                Container & aContainer,
-                Iterator & anIterator,
-                const Iterator & anEndIterator);
+    template <typename Predicate>
+    void updateBack(const Point & aPoint, 
+                    Container & aContainer);
 
 
 
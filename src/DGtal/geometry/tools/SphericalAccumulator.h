@@ -41,6 +41,7 @@
 //////////////////////////////////////////////////////////////////////////////
 // Inclusions
 #include <iostream>
+#include <vector>
 #include <algorithm>
 #include "DGtal/base/Common.h"
 #include "DGtal/kernel/NumberTraits.h"
@@ -147,6 +148,35 @@ namespace DGtal
      */
     void addDirection(const Vector &aDir);
 
+    /** 
+     * Adds a range of directions into the accumulator, as
+     * addDirection for each of them (except for the max bin, see
+     * below), but faster:
+     * - the bins are computed without trigonometric functions (see
+     *   fastBinCoordinates);
+     * - when DGtal is built WITH_OPENMP, the range is split among the
+     *   threads, which fill their own histograms, summed at the end.
+     *
+     * The max bin is then the bin with the maximal count (the first
+     * one in the bin order in case of ties, unless the previous max
+     * bin has the same count).
+     * 
+     * @tparam TIterator a random access iterator on Vector.
+     * @param itb an iterator on the first direction.
+     * @param ite an iterator after the last direction.
+     */
+    template <typename TIterator>
+    void addDirections(TIterator itb, TIterator ite);
+
+    /** 
+     * Adds the samples of another accumulator with the same
+     * decomposition (e.g. filled by another thread or with another
+     * part of a surface). The max bin is updated as in addDirections.
+     * 
+     * @param other an accumulator with the same number of slices.
+     */
+    void merge(const SphericalAccumulator & other);
+
     /** 
      * Given a normalized direction, this method computes the bin
      * coordinates.
@@ -160,6 +190,27 @@ namespace DGtal
 			Size &posPhi, 
 			Size &posTheta) const;
 
+    /** 
+     * Computes the bin coordinates of a direction as binCoordinates,
+     * but without trigonometric functions nor square roots: the
+     * latitude is found by comparing the z coordinate with the
+     * precomputed cosines of the slice boundaries, and the longitude
+     * by comparing a pseudo-angle (monotonous with the angle, computed
+     * with one division) with the precomputed pseudo-angles of the
+     * sector boundaries of the slice. The candidate boundaries are
+     * found in regular lookup tables. The rare directions within
+     * rounding errors of a bin boundary are binned by binCoordinates,
+     * so that both methods always give the same bin.
+     * 
+     * @pre @a aDir a non null vector.
+     * @param aDir a direction.
+     * @param posPhi position according to the first direction.
+     * @param posTheta position according to the second direction.
+     */
+    void fastBinCoordinates(const Vector &aDir, 
+                            Size &posPhi, 
+                            Size &posTheta) const;
+
     /** 
      * Returns the current number of samples in the bin
      * (posPhi,posTheta).
@@ -347,6 +398,29 @@ namespace DGtal
     ///Theta coordinate of the max bin
     Size myMaxBinTheta;
 
+    ///Increasing boundaries -c|c| of the slices, with c the cosine
+    ///of the angle (posPhi-1/2).dphi, for posPhi in [1,myNphi-1]
+    std::vector<double> myPhiBounds;
+
+    ///Number of bounds of myPhiBounds below the beginning of each of
+    ///the 4*myNphi regular cells of [-1,1]
+    std::vector<Size> myPhiCells;
+
+    ///Number of valid bins of each slice
+    std::vector<Size> mySliceSizes;
+
+    ///Index in myThetaBounds of the boundaries of each slice
+    std::vector<Size> mySliceOffsets;
+
+    ///Increasing pseudo-angles of the boundaries (posTheta+1/2).dtheta
+    ///of the bins of each slice
+    std::vector<double> myThetaBounds;
+
+    ///Number of bounds of each slice below the beginning of each of
+    ///its 4 regular cells per bin of [0,4[ (at 4 times the offset of
+    ///the slice)
+    std::vector<Size> myThetaCells;
+
 
     // ------------------------- Hidden services ------------------------------
   protected:
@@ -377,6 +451,26 @@ namespace DGtal
     // ------------------------- Internals ------------------------------------
   private:
 
+    /** 
+     * @param x any value.
+     * @param y any value.
+     * @return a value in [0,4[ increasing with the angle of (x,y) in
+     * [0,2pi[.
+     */
+    static double pseudoAngle(double x, double y);
+
+    /** 
+     * @param aDir a direction.
+     * @return the index in myAccumulator of the bin of @a aDir
+     * (computed by fastBinCoordinates).
+     */
+    Size binIndex(const Vector &aDir) const;
+
+    /** 
+     * Updates the max bin after several insertions.
+     */
+    void updateMaxBin();
+
   }; // end of class SphericalAccumulator
 
 
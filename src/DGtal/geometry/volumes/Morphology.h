@@ -0,0 +1,375 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file Morphology.h
+ * @brief Dilations, erosions, openings and closings of digital sets and images
+ * @author David Coeurjolly (\c david.coeurjolly@liris.cnrs.fr )
+ * Laboratoire d'InfoRmatique en Image et Systèmes d'information - LIRIS (CNRS, UMR 5205), CNRS, France
+ *
+ * @date 2026/10/19
+ *
+ * Header file for module Morphology.cpp
+ *
+ * This file is part of the DGtal library.
+ *
+ * @see testMorphology.cpp
+ */
+
+#if defined(Morphology_RECURSES)
+#error Recursive header files inclusion detected in Morphology.h
+#else // defined(Morphology_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define Morphology_RECURSES
+
+#if !defined Morphology_h
+/** Prevents repeated inclusion of headers. */
+#define Morphology_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/kernel/domains/HyperRectDomain.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/images/imagesSetsUtils/SetFromImage.h"
+#include "DGtal/images/imagesSetsUtils/ImageFromSet.h"
+#include "DGtal/geometry/volumes/distance/DistanceTransformation.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class Morphology
+  /**
+   * Description of template class 'Morphology' <p>
+   * \brief Aim: Mathematical morphology operators (dilation, erosion,
+   * opening, closing) on digital sets and images of a
+   * HyperRectDomain, whose cost does not depend on the size of the
+   * structuring element.
+   *
+   * Three structuring elements of radius r are available:
+   *
+   * - BOX: the points q with |q_i - p_i| <= r for all i. The
+   *   structuring element is decomposed into segments along each
+   *   axis, and the max (dilation) or min (erosion) on each segment
+   *   is computed with the van Herk/Gil-Werman algorithm, with three
+   *   comparisons per point whatever r. On gray-level images, these
+   *   are the flat gray-level dilation and erosion.
+   *
+   * - NORM1_BALL, NORM2_BALL: the points q with ||q - p||_1 <= r or
+   *   ||q - p||_2 <= r. The dilation of X is obtained by thresholding
+   *   the exact l_1 or squared l_2 DistanceTransformation of the
+   *   complement of X, the erosion by thresholding the distance
+   *   transformation of X. These operators are binary: an image point
+   *   belongs to the foreground iff its value is not 0, and the
+   *   resulting image has values 0 and 1.
+   *
+   * The structuring element is clipped by the domain: the points
+   * outside the domain are neither foreground (for dilations) nor
+   * background (for erosions).
+   *
+   * The van Herk/Gil-Werman passes and the thresholds are computed in
+   * parallel over the lines of the image when OpenMP is enabled.
+   * Digital sets are processed through an ImageContainerBySTLVector
+   * on their domain.
+   *
+   * @code
+   * Z3i::DigitalSet aSet( domain );
+   * ...
+   * Morphology<Z3i::Domain>::close( aSet, Morphology<Z3i::Domain>::NORM2_BALL, 4.5 );
+   * @endcode
+   *
+   * @tparam TDomain a HyperRectDomain.
+   */
+  template <typename TDomain>
+  class Morphology
+  {
+    // ----------------------- Types ------------------------------
+  public:
+    typedef TDomain Domain;
+    typedef typename Domain::Space Space;
+    typedef typename Domain::Point Point;
+    typedef typename Domain::Size Size;
+    typedef typename Space::Dimension Dimension;
+
+    /// The available structuring elements.
+    enum StructuringElement { BOX, NORM1_BALL, NORM2_BALL };
+
+    // ----------------------- Image services ------------------------------
+  public:
+
+    /**
+     * Dilates the image [anImage] by the structuring element [se] of
+     * radius [radius].
+     *
+     * @tparam TValue the type of value of the image.
+     * @param anImage (modified) the image to dilate.
+     * @param se the structuring element.
+     * @param radius its radius (truncated for BOX and NORM1_BALL).
+     * @param parallel when 'false', the lines are processed sequentially.
+     */
+    template <typename TValue>
+    static void dilate( ImageContainerBySTLVector<Domain,TValue> & anImage,
+                        StructuringElement se, double radius,
+                        bool parallel = true );
+
+    /**
+     * Erodes the image [anImage] by the structuring element [se] of
+     * radius [radius].
+     *
+     * @tparam TValue the type of value of the image.
+     * @param anImage (modified) the image to erode.
+     * @param se the structuring element.
+     * @param radius its radius (truncated for BOX and NORM1_BALL).
+     * @param parallel when 'false', the lines are processed sequentially.
+     */
+    template <typename TValue>
+    static void erode( ImageContainerBySTLVector<Domain,TValue> & anImage,
+                       StructuringElement se, double radius,
+                       bool parallel = true );
+
+    /**
+     * Opens the image [anImage] (erosion then dilation) by the
+     * structuring element [se] of radius [radius].
+     *
+     * @tparam TValue the type of value of the image.
+     * @param anImage (modified) the image to open.
+     * @param se the structuring element.
+     * @param radius its radius (truncated for BOX and NORM1_BALL).
+     * @param parallel when 'false', the lines are processed sequentially.
+     */
+    template <typename TValue>
+    static void open( ImageContainerBySTLVector<Domain,TValue> & anImage,
+                      StructuringElement se, double radius,
+                      bool parallel = true );
+
+    /**
+     * Closes the image [anImage] (dilation then erosion) by the
+     * structuring element [se] of radius [radius].
+     *
+     * @tparam TValue the type of value of the image.
+     * @param anImage (modified) the image to close.
+     * @param se the structuring element.
+     * @param radius its radius (truncated for BOX and NORM1_BALL).
+     * @param parallel when 'false', the lines are processed sequentially.
+     */
+    template <typename TValue>
+    static void close( ImageContainerBySTLVector<Domain,TValue> & anImage,
+                       StructuringElement se, double radius,
+                       bool parallel = true );
+
+    /**
+     * Replaces each value of [anImage] by the maximum of the values in
+     * the box centered on it whose half-sides are given by [radii]
+     * (van Herk/Gil-Werman algorithm, axis by axis).
+     *
+     * @tparam TValue the type of value of the image.
+     * @param anImage (modified) any image.
+     * @param radii the half-side of the box along each axis.
+     * @param parallel when 'false', the lines are processed sequentially.
+     */
+    template <typename TValue>
+    static void maxFilter( ImageContainerBySTLVector<Domain,TValue> & anImage,
+                           const Point & radii, bool parallel = true );
+
+    /**
+     * Replaces each value of [anImage] by the minimum of the values in
+     * the box centered on it whose half-sides are given by [radii]
+     * (van Herk/Gil-Werman algorithm, axis by axis).
+     *
+     * @tparam TValue the type of value of the image.
+     * @param anImage (modified) any image.
+     * @param radii the half-side of the box along each axis.
+     * @param parallel when 'false', the lines are processed sequentially.
+     */
+    template <typename TValue>
+    static void minFilter( ImageContainerBySTLVector<Domain,TValue> & anImage,
+                           const Point & radii, bool parallel = true );
+
+    // ----------------------- Digital set services ------------------------------
+  public:
+
+    /**
+     * Dilates the digital set [aSet] by the structuring element [se]
+     * of radius [radius], within the domain of the set.
+     *
+     * @tparam TDigitalSet a model of CDigitalSet whose domain is Domain.
+     * @param aSet (modified) the set to dilate.
+     * @param se the structuring element.
+     * @param radius its radius (truncated for BOX and NORM1_BALL).
+     * @param parallel when 'false', the lines are processed sequentially.
+     */
+    template <typename TDigitalSet>
+    static void dilate( TDigitalSet & aSet, StructuringElement se,
+                        double radius, bool parallel = true );
+
+    /**
+     * Erodes the digital set [aSet] by the structuring element [se]
+     * of radius [radius], within the domain of the set.
+     *
+     * @tparam TDigitalSet a model of CDigitalSet whose domain is Domain.
+     * @param aSet (modified) the set to erode.
+     * @param se the structuring element.
+     * @param radius its radius (truncated for BOX and NORM1_BALL).
+     * @param parallel when 'false', the lines are processed sequentially.
+     */
+    template <typename TDigitalSet>
+    static void erode( TDigitalSet & aSet, StructuringElement se,
+                       double radius, bool parallel = true );
+
+    /**
+     * Opens the digital set [aSet] by the structuring element [se] of
+     * radius [radius], within the domain of the set.
+     *
+     * @tparam TDigitalSet a model of CDigitalSet whose domain is Domain.
+     * @param aSet (modified) the set to open.
+     * @param se the structuring element.
+     * @param radius its radius (truncated for BOX and NORM1_BALL).
+     * @param parallel when 'false', the lines are processed sequentially.
+     */
+    template <typename TDigitalSet>
+    static void open( TDigitalSet & aSet, StructuringElement se,
+                      double radius, bool parallel = true );
+
+    /**
+     * Closes the digital set [aSet] by the structuring element [se] of
+     * radius [radius], within the domain of the set.
+     *
+     * @tparam TDigitalSet a model of CDigitalSet whose domain is Domain.
+     * @param aSet (modified) the set to close.
+     * @param se the structuring element.
+     * @param radius its radius (truncated for BOX and NORM1_BALL).
+     * @param parallel when 'false', the lines are processed sequentially.
+     */
+    template <typename TDigitalSet>
+    static void close( TDigitalSet & aSet, StructuringElement se,
+                       double radius, bool parallel = true );
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+     * Point predicate on an image, true for the points whose value is
+     * not 0 (or is 0 when [complement] is true).
+     */
+    template <typename TImage>
+    struct ForegroundPredicate
+    {
+      typedef typename TImage::Point Point;
+      ForegroundPredicate( const TImage & anImage, bool complement )
+        : myImage( &anImage ), myComplement( complement ) {}
+      bool operator()( const Point & p ) const
+      {
+        return ( (*myImage)( p ) != typename TImage::Value( 0 ) ) != myComplement;
+      }
+      const TImage* myImage;
+      bool myComplement;
+    };
+
+    /**
+     * Binary dilation (or erosion when [erosion] is true) of [anImage]
+     * by a ball, by thresholding the l_p distance transformation.
+     */
+    template <DGtal::uint32_t p, typename TValue>
+    static void ballOperation( ImageContainerBySTLVector<Domain,TValue> & anImage,
+                               DGtal::int64_t threshold, bool erosion,
+                               bool parallel );
+
+    /**
+     * Dilation (or erosion when [erosion] is true) of [anImage] by the
+     * structuring element [se].
+     */
+    template <typename TValue>
+    static void elementary( ImageContainerBySTLVector<Domain,TValue> & anImage,
+                            StructuringElement se, double radius,
+                            bool erosion, bool parallel );
+
+    /**
+     * Van Herk/Gil-Werman filter along each axis: replaces each value
+     * by the best value for [TBetter] (e.g. std::less for the maximum)
+     * in the box of half-sides [radii].
+     */
+    template <typename TValue, typename TBetter>
+    static void lineFilter( ImageContainerBySTLVector<Domain,TValue> & anImage,
+                            const Point & radii, const TBetter & better,
+                            bool parallel );
+
+    /// The four operators.
+    enum Operation { DILATION, EROSION, OPENING, CLOSING };
+
+    /**
+     * Applies the operator [op] to [anImage].
+     */
+    template <typename TValue>
+    static void apply( ImageContainerBySTLVector<Domain,TValue> & anImage,
+                       StructuringElement se, double radius, Operation op,
+                       bool parallel );
+
+    /**
+     * Applies the operator [op] to the set [aSet] through a vector
+     * image on its domain.
+     */
+    template <typename TDigitalSet>
+    static void applyToSet( TDigitalSet & aSet, StructuringElement se,
+                            double radius, Operation op, bool parallel );
+
+  }; // end of class Morphology
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'Morphology'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'Morphology' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TDomain>
+  std::ostream&
+  operator<< ( std::ostream & out, const Morphology<TDomain> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/geometry/volumes/Morphology.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined Morphology_h
+
+#undef Morphology_RECURSES
+#endif // else defined(Morphology_RECURSES)
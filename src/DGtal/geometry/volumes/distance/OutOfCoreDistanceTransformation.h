@@ -0,0 +1,301 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file OutOfCoreDistanceTransformation.h
+ * @brief Distance transformation of volumes streamed from disk
+ * @author David Coeurjolly (\c david.coeurjolly@liris.cnrs.fr )
+ * Laboratoire d'InfoRmatique en Image et Systèmes d'information - LIRIS (CNRS, UMR 5205), CNRS, France
+ *
+ * @date 2026/10/19
+ *
+ * Header file for module OutOfCoreDistanceTransformation.cpp
+ *
+ * This file is part of the DGtal library.
+ *
+ * @see testOutOfCoreDistanceTransformation.cpp
+ */
+
+#if defined(OutOfCoreDistanceTransformation_RECURSES)
+#error Recursive header files inclusion detected in OutOfCoreDistanceTransformation.h
+#else // defined(OutOfCoreDistanceTransformation_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define OutOfCoreDistanceTransformation_RECURSES
+
+#if !defined OutOfCoreDistanceTransformation_h
+/** Prevents repeated inclusion of headers. */
+#define OutOfCoreDistanceTransformation_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <fstream>
+#include <cstdio>
+#include <string>
+#include <vector>
+#include <boost/static_assert.hpp>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/Exceptions.h"
+#include "DGtal/kernel/SpaceND.h"
+#include "DGtal/kernel/domains/HyperRectDomain.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/geometry/volumes/distance/SeparableMetricHelper.h"
+#include "DGtal/geometry/volumes/distance/DistanceTransformation.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class OutOfCoreDistanceTransformation
+  /**
+   * Description of template class 'OutOfCoreDistanceTransformation' <p>
+   * \brief Aim: Computes the distance transformation of a 3D volume
+   * too large to be held in memory, with a memory usage bounded by
+   * the caller.
+   *
+   * The volume is an 8 bits volume file (raw or vol, as read by
+   * RawReader::importRaw8 and VolReader::importVol). Its voxels with a
+   * value strictly greater than a threshold are the foreground, as for
+   * SimpleThresholdForegroundPredicate, and their distance to the
+   * background is computed as by DistanceTransformation.
+   *
+   * The computation streams the volume:
+   * - the volume is read z-plane by z-plane; the first two separable
+   *   passes (along x and y) only involve one plane and are computed
+   *   in memory with DistanceTransformation in 2D; the result is
+   *   spilled to a scratch file;
+   * - the last pass (along z) is computed on bands of consecutive
+   *   (x,y) columns of the scratch file, as many as the memory budget
+   *   allows, and written to the output file.
+   *
+   * The output file is a raw file of IntegerLong values (native byte
+   * order), ordered as the points of DistanceTransformation::OutputImage
+   * (x first, then y, then z) on the domain [0,extent-1].
+   *
+   * The memory budget must allow one plane (X*Y*(1+2*sizeof(IntegerLong))
+   * bytes) and one column (Z*2*sizeof(IntegerLong) bytes).
+   *
+   * @code
+   * OutOfCoreDistanceTransformation<Z3i::Space, 2> dt( 512 << 20, "/tmp/dt.scratch" );
+   * dt.computeFromVol( "scan.vol", "scan-dt.raw" );
+   * @endcode
+   *
+   * @tparam TSpace type of Digital Space (model of CSpace), of dimension 3.
+   * @tparam p the static integer value to define the l_p metric.
+   * @tparam IntegerLong (optional) type used to represent exact
+   * distance value according to p (default: DGtal::int64_t)
+   */
+  template < typename TSpace,
+             DGtal::uint32_t p,
+             typename IntegerLong = DGtal::int64_t >
+  class OutOfCoreDistanceTransformation
+  {
+
+  public:
+    BOOST_STATIC_ASSERT( TSpace::dimension == 3 );
+    BOOST_CONCEPT_ASSERT(( CSignedInteger<IntegerLong> ));
+
+    ///Copy of the space type.
+    typedef TSpace Space;
+    typedef typename Space::Vector Vector;
+    typedef typename Space::Point Point;
+    ///Memory sizes and offsets in the files (64 bits for large volumes).
+    typedef DGtal::uint64_t Size;
+    typedef typename Space::Point::Coordinate Abscissa;
+
+    ///Types of the planes processed in memory.
+    typedef SpaceND< 2, typename Space::Integer > PlaneSpace;
+    typedef HyperRectDomain< PlaneSpace > PlaneDomain;
+    typedef ImageContainerBySTLVector< PlaneDomain, unsigned char > PlaneImage;
+
+    ///We construct the type associated to the separable metric
+    typedef SeparableMetricHelper< Point, IntegerLong, p > SeparableMetric;
+
+    /**
+     * Constructor.
+     *
+     * @param maxMemory the memory budget, in bytes, of the buffers.
+     * @param scratchFile the name of the file where the intermediate
+     * results are spilled (about the size of the output file). It is
+     * removed at the end of the computation.
+     */
+    OutOfCoreDistanceTransformation( Size maxMemory,
+                                     const std::string & scratchFile );
+
+    /**
+     * Destructor.
+     */
+    ~OutOfCoreDistanceTransformation();
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Computes the distance transformation of a raw 8 bits volume.
+     *
+     * @param inputFile the name of the raw file.
+     * @param extent the size of the volume along each axis.
+     * @param outputFile the name of the output raw file.
+     * @param threshold the voxels with a value strictly greater than
+     * [threshold] are the foreground.
+     * @param offset the position of the first voxel in the file.
+     */
+    void computeFromRaw8( const std::string & inputFile,
+                          const Vector & extent,
+                          const std::string & outputFile,
+                          unsigned char threshold = 0,
+                          std::streamoff offset = 0 ) const
+      throw( DGtal::IOException, DGtal::MemoryException );
+
+    /**
+     * Computes the distance transformation of a vol volume.
+     *
+     * @param inputFile the name of the vol file.
+     * @param outputFile the name of the output raw file.
+     * @param threshold the voxels with a value strictly greater than
+     * [threshold] are the foreground.
+     * @return the extent of the volume.
+     */
+    Vector computeFromVol( const std::string & inputFile,
+                           const std::string & outputFile,
+                           unsigned char threshold = 0 ) const
+      throw( DGtal::IOException, DGtal::MemoryException );
+
+    /**
+     * @param extent the size of a volume.
+     * @return 'true' if the memory budget allows to process it.
+     */
+    bool canProcess( const Vector & extent ) const;
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+     * Foreground of a plane: values strictly greater than a
+     * threshold. Unlike SimpleThresholdForegroundPredicate, the plane
+     * is not copied, so that it can be refilled for each z.
+     */
+    struct PlanePredicate
+    {
+      typedef typename PlaneImage::Point Point;
+      PlanePredicate( const PlaneImage & anImage, unsigned char threshold )
+        : myImage( &anImage ), myThreshold( threshold ) {}
+      bool operator()( const Point & aPoint ) const
+      {
+        return (*myImage)( aPoint ) > myThreshold;
+      }
+      const PlaneImage* myImage;
+      unsigned char myThreshold;
+    };
+
+    ///In memory distance transformation of a plane.
+    typedef DistanceTransformation< PlaneSpace, PlanePredicate, p, IntegerLong > PlaneDT;
+
+    /**
+     * Passes x and y: streams the planes of [input] and spills their
+     * 2D distance transformation to [scratch].
+     */
+    void computePlanes( std::istream & input, std::ostream & scratch,
+                        const Vector & extent, unsigned char threshold ) const;
+
+    /**
+     * Pass z: processes [scratch] by bands of columns and writes the
+     * result to [output].
+     */
+    void computeColumns( std::istream & scratch, std::ostream & output,
+                         const Vector & extent ) const;
+
+    /**
+     * Lower envelope of the Lp-parabolas of one column of [n] values
+     * read every [stride] values of [input], written to [output].
+     */
+    void computeColumn( const IntegerLong * input, IntegerLong * output,
+                        Abscissa n, Size stride,
+                        IntegerLong planeInfinity, IntegerLong infinity,
+                        Abscissa s[], Abscissa t[] ) const;
+
+    /**
+     * Removes a file when it goes out of scope (RAII), so that the
+     * scratch file is removed even if an exception is thrown.
+     */
+    struct ScratchFileRemover
+    {
+      ScratchFileRemover( const std::string & aFile ) : myFile( aFile ) {}
+      ~ScratchFileRemover() { std::remove( myFile.c_str() ); }
+      /// The name of the file to remove.
+      const std::string & myFile;
+    };
+
+    /**
+     * Runs the computation on [input] positioned on the first voxel.
+     */
+    void computeFromStream( std::istream & input, const Vector & extent,
+                            const std::string & outputFile,
+                            unsigned char threshold ) const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    ///The separable metric instance
+    SeparableMetric myMetric;
+    ///Memory budget in bytes
+    Size myMaxMemory;
+    ///Name of the scratch file
+    std::string myScratchFile;
+
+  }; // end of class OutOfCoreDistanceTransformation
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'OutOfCoreDistanceTransformation'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'OutOfCoreDistanceTransformation' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TSpace, DGtal::uint32_t p, typename IntegerLong>
+  std::ostream&
+  operator<< ( std::ostream & out,
+               const OutOfCoreDistanceTransformation<TSpace, p, IntegerLong> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/geometry/volumes/distance/OutOfCoreDistanceTransformation.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined OutOfCoreDistanceTransformation_h
+
+#undef OutOfCoreDistanceTransformation_RECURSES
+#endif // else defined(OutOfCoreDistanceTransformation_RECURSES)
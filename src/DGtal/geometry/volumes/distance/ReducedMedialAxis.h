@@ -0,0 +1,222 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file ReducedMedialAxis.h
+ * @brief Separable extraction of the reduced discrete medial axis
+ * @author David Coeurjolly (\c david.coeurjolly@liris.cnrs.fr )
+ * Laboratoire d'InfoRmatique en Image et Systèmes d'information - LIRIS (CNRS, UMR 5205), CNRS, France
+ *
+ * @date 2026/10/19
+ *
+ * Header file for module ReducedMedialAxis.cpp
+ *
+ * This file is part of the DGtal library.
+ *
+ * @see testReducedMedialAxis.cpp
+ */
+
+#if defined(ReducedMedialAxis_RECURSES)
+#error Recursive header files inclusion detected in ReducedMedialAxis.h
+#else // defined(ReducedMedialAxis_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define ReducedMedialAxis_RECURSES
+
+#if !defined ReducedMedialAxis_h
+/** Prevents repeated inclusion of headers. */
+#define ReducedMedialAxis_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/kernel/domains/HyperRectDomain.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/geometry/volumes/distance/SeparableMetricHelper.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class ReducedMedialAxis
+  /**
+   * Description of template class 'ReducedMedialAxis' <p>
+   * \brief Aim: Implementation of the linear in time extraction of the
+   * reduced discrete medial axis from a distance transformation.
+   *
+   * The input image associates to each point P of the shape the
+   * distance value V (e.g. the squared Euclidean distance for p=2)
+   * of the largest ball centered at P contained in the shape, as
+   * computed by DistanceTransformation, and 0 to the background. The
+   * shape is the union of these balls, as reconstructed by
+   * ReverseDistanceTransformation.
+   *
+   * The power diagram of these balls is computed separably, axis by
+   * axis, with the upper envelopes of the reversed Lp-parabolas of the
+   * SeparableMetricHelper (reversedF and reversedSep), as in the
+   * reverse distance transformation. Along with the power of each
+   * point, the center of the ball realizing it is propagated. The
+   * reduced medial axis is the set of balls whose power cell contains
+   * at least one point of the shape: their union is the whole shape,
+   * and a ball whose power cell is empty is useless for the
+   * reconstruction.
+   *
+   * Each pass is parallel over the lines of the image when OpenMP is
+   * enabled. The balls are returned in a compact array, ordered as the
+   * points of an ImageContainerBySTLVector.
+   *
+   * @code
+   * typedef DistanceTransformation<Z3i::Space, Predicate, 2> DT;
+   * DT::OutputImage dtImage = dt.compute();
+   * ReducedMedialAxis<DT::OutputImage, 2> rdma;
+   * std::vector< ReducedMedialAxis<DT::OutputImage, 2>::Ball > balls;
+   * rdma.compute( balls, dtImage );
+   * @endcode
+   *
+   * @tparam TImage type of the distance image, an
+   * ImageContainerBySTLVector with integer values (e.g.
+   * DistanceTransformation::OutputImage).
+   * @tparam p the static integer value to define the l_p metric.
+   *
+   * @see Coeurjolly, D. and Montanvert, A. Optimal Separable
+   * Algorithms to Compute the Reverse Euclidean Distance
+   * Transformation and Discrete Medial Axis in Arbitrary
+   * Dimension. IEEE PAMI, 29(3), 2007.
+   */
+  template <typename TImage, DGtal::uint32_t p = 2>
+  class ReducedMedialAxis
+  {
+
+  public:
+
+    typedef TImage Image;
+    typedef typename Image::Value Value;
+    typedef typename Image::Point Point;
+    typedef typename Image::Domain Domain;
+    typedef typename Image::Size Size;
+    typedef typename Image::Dimension Dimension;
+    typedef typename Point::Coordinate Coordinate;
+
+    ///We construct the type associated to the separable metric
+    typedef SeparableMetricHelper< Point, Value, p > SeparableMetric;
+
+    /**
+     * A ball of the medial axis: its center and its radius (as a
+     * distance value, i.e. the squared radius for p=2).
+     */
+    struct Ball
+    {
+      Point center;
+      Value radius;
+    };
+
+    /**
+     * Constructor.
+     */
+    ReducedMedialAxis();
+
+    /**
+     * Default destructor
+     */
+    ~ReducedMedialAxis();
+
+  public:
+
+    /**
+     * Computes the reduced medial axis of the shape coded by the
+     * distance image [dtImage].
+     *
+     * @param balls (output) the balls of the reduced medial axis,
+     * ordered as the points of the image.
+     * @param dtImage the distance values of the points of the shape,
+     * 0 for the background.
+     * @param parallel when 'false', the lines are processed sequentially.
+     * @return the number of balls.
+     */
+    Size compute( std::vector<Ball> & balls, const Image & dtImage,
+                  bool parallel = true ) const;
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------- Private functions ------------------------
+  private:
+
+    /**
+     * Computes the upper envelope of the reversed parabolas of one
+     * line of [n] values (0 or less meaning no parabola), and writes
+     * for each point the envelope (0 when negative) and the label of
+     * the parabola realizing it.
+     *
+     * @param values the values of the line.
+     * @param labels the labels of the line.
+     * @param n the length of the line.
+     * @param s (work) stack of the apexes of the envelope.
+     * @param t (work) stack of the abscissa where each apex starts.
+     * @param outValues (output) the envelope, every [stride] values.
+     * @param outLabels (output) the labels, every [stride] values.
+     * @param stride the distance between two output values.
+     */
+    void computeLine( const Value* values, const Size* labels, Coordinate n,
+                      Coordinate* s, Coordinate* t,
+                      Value* outValues, Size* outLabels, Size stride ) const;
+
+    // ------------------- Private members ------------------------
+  private:
+
+    ///The separable metric instance
+    SeparableMetric myMetric;
+
+  }; // end of class ReducedMedialAxis
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'ReducedMedialAxis'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'ReducedMedialAxis' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TImage, DGtal::uint32_t p>
+  std::ostream&
+  operator<< ( std::ostream & out, const ReducedMedialAxis<TImage, p> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/geometry/volumes/distance/ReducedMedialAxis.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined ReducedMedialAxis_h
+
+#undef ReducedMedialAxis_RECURSES
+#endif // else defined(ReducedMedialAxis_RECURSES)
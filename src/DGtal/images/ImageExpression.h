@@ -0,0 +1,477 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file ImageExpression.h
+ * @author Tristan Roussillon (\c tristan.roussillon@liris.cnrs.fr )
+ * Laboratoire d'InfoRmatique en Image et Systèmes d'information - LIRIS (CNRS, UMR 5205), CNRS, France
+ *
+ * @date 2026/10/19
+ *
+ * Header file for module ImageExpression.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(ImageExpression_RECURSES)
+#error Recursive header files inclusion detected in ImageExpression.h
+#else // defined(ImageExpression_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define ImageExpression_RECURSES
+
+#if !defined ImageExpression_h
+/** Prevents repeated inclusion of headers. */
+#define ImageExpression_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <functional>
+#include "DGtal/base/Common.h"
+#include "DGtal/images/CConstImage.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // Nodes of image expressions
+  /*
+   * Each node of an image expression provides the types Domain,
+   * Point, Size and Value, and the services:
+   * - 'Value operator()( const Point & ) const', the value at a point;
+   * - 'const Domain & domain() const', the domain of the expression;
+   * - 'bool isLinearOn( const Domain & ) const', true when the values
+   *   can be read by offsets in the given domain (all the images of the
+   *   expression are ImageContainerBySTLVector on this very domain);
+   * - 'Value operator[]( Size ) const', the value at an offset, valid
+   *   only when isLinearOn is true.
+   */
+
+  /**
+   * Description of template class 'ImageExpressionTerminal' <p>
+   * \brief Aim: A leaf of an image expression, which refers to a
+   * model of CConstImage.
+   *
+   * The image is stored as an aliasing pointer: it must exist during
+   * the use of the expression.
+   *
+   * @tparam TImage a model of CConstImage.
+   */
+  template <typename TImage>
+  class ImageExpressionTerminal
+  {
+  public:
+    typedef TImage Image;
+    BOOST_CONCEPT_ASSERT(( CConstImage<Image> ));
+    typedef typename Image::Domain Domain;
+    typedef typename Image::Point Point;
+    typedef typename Domain::Size Size;
+    typedef typename Image::Value Value;
+
+    ImageExpressionTerminal( const Image & anImage ) : myImage( &anImage ) {}
+    Value operator()( const Point & aPoint ) const
+    { return (*myImage)( aPoint ); }
+    const Domain & domain() const { return myImage->domain(); }
+    bool isLinearOn( const Domain & ) const { return false; }
+    Value operator[]( Size ) const
+    {
+      ASSERT( false && "[ImageExpressionTerminal::operator[]] not a linear image." );
+      return Value();
+    }
+    void selfDisplay( std::ostream & out ) const
+    { out << "[ImageExpressionTerminal]"; }
+
+  private:
+    /// Aliasing pointer on the image.
+    const Image* myImage;
+  };
+
+  /**
+   * Specialization of ImageExpressionTerminal for images stored in a
+   * vector, whose values may be read by offsets.
+   */
+  template <typename TDomain, typename TValue>
+  class ImageExpressionTerminal< ImageContainerBySTLVector<TDomain, TValue> >
+  {
+  public:
+    typedef ImageContainerBySTLVector<TDomain, TValue> Image;
+    typedef TDomain Domain;
+    typedef typename Domain::Point Point;
+    typedef typename Domain::Size Size;
+    typedef TValue Value;
+
+    ImageExpressionTerminal( const Image & anImage ) : myImage( &anImage ) {}
+    Value operator()( const Point & aPoint ) const
+    { return (*myImage)( aPoint ); }
+    const Domain & domain() const { return myImage->domain(); }
+    bool isLinearOn( const Domain & aDomain ) const
+    {
+      return ( myImage->domain().lowerBound() == aDomain.lowerBound() )
+        && ( myImage->domain().upperBound() == aDomain.upperBound() );
+    }
+    Value operator[]( Size i ) const
+    { return static_cast<const std::vector<TValue> &>( *myImage )[ i ]; }
+    void selfDisplay( std::ostream & out ) const
+    { out << "[ImageExpressionTerminal linear]"; }
+
+  private:
+    /// Aliasing pointer on the image.
+    const Image* myImage;
+  };
+
+  /**
+   * Description of template class 'ImageExpressionUnary' <p>
+   * \brief Aim: A node of an image expression that applies a unary
+   * functor to the values of an expression.
+   *
+   * @tparam TNode the type of the sub-expression.
+   * @tparam TFunctor the type of the functor (copied).
+   * @tparam TValue the type of the values returned by the functor.
+   */
+  template <typename TNode, typename TFunctor, typename TValue>
+  class ImageExpressionUnary
+  {
+  public:
+    typedef typename TNode::Domain Domain;
+    typedef typename TNode::Point Point;
+    typedef typename TNode::Size Size;
+    typedef TValue Value;
+
+    ImageExpressionUnary( const TNode & aNode, const TFunctor & aFunctor )
+      : myNode( aNode ), myFunctor( aFunctor ) {}
+    Value operator()( const Point & aPoint ) const
+    { return myFunctor( myNode( aPoint ) ); }
+    const Domain & domain() const { return myNode.domain(); }
+    bool isLinearOn( const Domain & aDomain ) const
+    { return myNode.isLinearOn( aDomain ); }
+    Value operator[]( Size i ) const
+    { return myFunctor( myNode[ i ] ); }
+    void selfDisplay( std::ostream & out ) const
+    {
+      out << "[ImageExpressionUnary ";
+      myNode.selfDisplay( out );
+      out << "]";
+    }
+
+  private:
+    /// The sub-expression.
+    TNode myNode;
+    /// The functor applied to its values.
+    TFunctor myFunctor;
+  };
+
+  /**
+   * Description of template class 'ImageExpressionBinary' <p>
+   * \brief Aim: A node of an image expression that combines the values
+   * of two expressions on the same domain with a binary functor.
+   *
+   * @tparam TNode1 the type of the left sub-expression.
+   * @tparam TNode2 the type of the right sub-expression.
+   * @tparam TFunctor the type of the binary functor (copied), which
+   * defines the type 'result_type' (e.g. std::plus).
+   */
+  template <typename TNode1, typename TNode2, typename TFunctor>
+  class ImageExpressionBinary
+  {
+  public:
+    typedef typename TNode1::Domain Domain;
+    typedef typename TNode1::Point Point;
+    typedef typename TNode1::Size Size;
+    typedef typename TFunctor::result_type Value;
+
+    ImageExpressionBinary( const TNode1 & aNode1, const TNode2 & aNode2,
+                           const TFunctor & aFunctor )
+      : myNode1( aNode1 ), myNode2( aNode2 ), myFunctor( aFunctor ) {}
+    Value operator()( const Point & aPoint ) const
+    { return myFunctor( myNode1( aPoint ), myNode2( aPoint ) ); }
+    const Domain & domain() const { return myNode1.domain(); }
+    bool isLinearOn( const Domain & aDomain ) const
+    { return myNode1.isLinearOn( aDomain ) && myNode2.isLinearOn( aDomain ); }
+    Value operator[]( Size i ) const
+    { return myFunctor( myNode1[ i ], myNode2[ i ] ); }
+    void selfDisplay( std::ostream & out ) const
+    {
+      out << "[ImageExpressionBinary ";
+      myNode1.selfDisplay( out );
+      out << " ";
+      myNode2.selfDisplay( out );
+      out << "]";
+    }
+
+  private:
+    /// The left sub-expression.
+    TNode1 myNode1;
+    /// The right sub-expression.
+    TNode2 myNode2;
+    /// The functor combining their values.
+    TFunctor myFunctor;
+  };
+
+  /**
+   * Functor that thresholds values: returns @a above when the value
+   * is greater than the threshold, @a below otherwise (same
+   * convention as SimpleThresholdForegroundPredicate).
+   */
+  template <typename TInput, typename TOutput>
+  struct ImageExpressionThreshold
+  {
+    typedef TInput argument_type;
+    typedef TOutput result_type;
+    ImageExpressionThreshold( const TInput & t,
+                              const TOutput & above, const TOutput & below )
+      : myThreshold( t ), myAbove( above ), myBelow( below ) {}
+    TOutput operator()( const TInput & v ) const
+    { return ( v > myThreshold ) ? myAbove : myBelow; }
+    TInput myThreshold;
+    TOutput myAbove;
+    TOutput myBelow;
+  };
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class ImageExpression
+  /**
+   * Description of template class 'ImageExpression' <p>
+   * \brief Aim: A lazy expression on images (arithmetic, thresholds,
+   * functors), which is evaluated at once into a destination image,
+   * without any intermediate image.
+   *
+   * Contrary to a chain of ConstImageAdapter, where each level
+   * computes the values of the level below through the operator() of
+   * the image, an expression is a tree of nodes whose types are known
+   * at compile time, so that its evaluation at a point is fully
+   * inlined. Moreover, when all the images of the expression and the
+   * destination are ImageContainerBySTLVector on the same domain,
+   * imageEvaluate reads and writes the values by offsets, in one
+   * linear pass on the arrays (in parallel with OpenMP), instead of
+   * going through points.
+   *
+   * Expressions are built from images with imageExpression, then
+   * combined with the arithmetic operators (with another expression
+   * or a value), imageThreshold and imageMap:
+   *
+   * @code
+   * Image a( domain ), b( domain ), c( domain );
+   * ...
+   * imageEvaluate( c, imageThreshold( imageExpression( a ) * 2
+   *                                   - imageExpression( b ), 10, 255, 0 ) );
+   * @endcode
+   *
+   * The expression refers to the images (aliasing pointers) and
+   * copies the functors. The destination may be one of the images of
+   * the expression, since the value at a point only depends on the
+   * values at this point.
+   *
+   * @tparam TNode the type of the root node of the expression (e.g.
+   * ImageExpressionTerminal, ImageExpressionUnary or
+   * ImageExpressionBinary).
+   *
+   * @see ConstImageAdapter
+   */
+  template <typename TNode>
+  class ImageExpression : public TNode
+  {
+    // ----------------------- Types ------------------------------
+  public:
+    typedef TNode Node;
+    typedef typename Node::Domain Domain;
+    typedef typename Node::Point Point;
+    typedef typename Node::Size Size;
+    typedef typename Node::Value Value;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Constructor.
+     * @param aNode the root of the expression.
+     */
+    ImageExpression( const Node & aNode ) : Node( aNode ) {}
+
+    /**
+     * @return the root of the expression.
+     */
+    const Node & node() const { return *this; }
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay( std::ostream & out ) const
+    {
+      out << "[ImageExpression ";
+      Node::selfDisplay( out );
+      out << "]";
+    }
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const { return true; }
+
+  }; // end of class ImageExpression
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'ImageExpression'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'ImageExpression' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TNode>
+  std::ostream&
+  operator<< ( std::ostream & out, const ImageExpression<TNode> & object );
+
+  /**
+   * @param anImage any model of CConstImage (referenced).
+   * @return the expression made of this image.
+   */
+  template <typename TImage>
+  ImageExpression< ImageExpressionTerminal<TImage> >
+  imageExpression( const TImage & anImage );
+
+  /**
+   * @param e any expression.
+   * @param t the threshold.
+   * @param above the value when the value of @a e is greater than @a t.
+   * @param below the value otherwise.
+   * @return the thresholded expression.
+   */
+  template <typename TNode, typename TOutput>
+  ImageExpression< ImageExpressionUnary< TNode,
+                                         ImageExpressionThreshold<typename TNode::Value, TOutput>,
+                                         TOutput > >
+  imageThreshold( const ImageExpression<TNode> & e,
+                  const typename TNode::Value & t,
+                  const TOutput & above, const TOutput & below );
+
+  /**
+   * @tparam TValue the type of the values returned by the functor
+   * (explicit template argument).
+   * @param e any expression.
+   * @param f any unary functor on the values of @a e.
+   * @return the expression whose values are the images by @a f of the
+   * values of @a e.
+   */
+  template <typename TValue, typename TNode, typename TFunctor>
+  ImageExpression< ImageExpressionUnary< TNode, TFunctor, TValue > >
+  imageMap( const ImageExpression<TNode> & e, const TFunctor & f );
+
+  /**
+   * @param e1 any expression.
+   * @param e2 any expression on the same domain.
+   * @param f any binary functor, which defines 'result_type'.
+   * @return the expression whose values are f( e1, e2 ).
+   */
+  template <typename TNode1, typename TNode2, typename TFunctor>
+  ImageExpression< ImageExpressionBinary< TNode1, TNode2, TFunctor > >
+  imageMap( const ImageExpression<TNode1> & e1,
+            const ImageExpression<TNode2> & e2, const TFunctor & f );
+
+  /**
+   * Evaluates an expression on the domain of an image and writes the
+   * values in this image, point by point with setValue.
+   *
+   * @param anImage (modified) any model of CImage, whose domain is
+   * included in the domain of @a e.
+   * @param e any expression.
+   */
+  template <typename TImage, typename TNode>
+  void imageEvaluate( TImage & anImage, const ImageExpression<TNode> & e );
+
+  /**
+   * Evaluates an expression on the domain of an image stored in a
+   * vector, in one pass on the values of the image. When the
+   * expression is linear on this domain, the values are computed by
+   * offsets, otherwise scanline by scanline. The pass is parallel when
+   * OpenMP is enabled and @a parallel is 'true' (the images of the
+   * expression are then read concurrently).
+   *
+   * @param anImage (modified) the destination image, whose domain is
+   * included in the domain of @a e.
+   * @param e any expression.
+   * @param parallel when 'false', the evaluation is sequential.
+   */
+  template <typename TDomain, typename TValue, typename TNode>
+  void imageEvaluate( ImageContainerBySTLVector<TDomain, TValue> & anImage,
+                      const ImageExpression<TNode> & e,
+                      bool parallel = true );
+
+#define DGTAL_IMAGE_EXPRESSION_OPERATOR( op, functor )                  \
+  template <typename TNode1, typename TNode2>                           \
+  ImageExpression< ImageExpressionBinary< TNode1, TNode2,               \
+                                          functor<typename TNode1::Value> > > \
+  operator op ( const ImageExpression<TNode1> & e1,                     \
+                const ImageExpression<TNode2> & e2 )                    \
+  {                                                                     \
+    typedef ImageExpressionBinary< TNode1, TNode2,                      \
+                                   functor<typename TNode1::Value> > Node; \
+    return ImageExpression<Node>( Node( e1, e2,                         \
+                                        functor<typename TNode1::Value>() ) ); \
+  }                                                                     \
+  template <typename TNode>                                             \
+  ImageExpression< ImageExpressionUnary< TNode,                         \
+                                         std::binder2nd< functor<typename TNode::Value> >, \
+                                         typename TNode::Value > >      \
+  operator op ( const ImageExpression<TNode> & e,                       \
+                const typename TNode::Value & v )                       \
+  {                                                                     \
+    typedef std::binder2nd< functor<typename TNode::Value> > F;         \
+    typedef ImageExpressionUnary< TNode, F, typename TNode::Value > Node; \
+    return ImageExpression<Node>                                        \
+      ( Node( e, F( functor<typename TNode::Value>(), v ) ) );          \
+  }                                                                     \
+  template <typename TNode>                                             \
+  ImageExpression< ImageExpressionUnary< TNode,                         \
+                                         std::binder1st< functor<typename TNode::Value> >, \
+                                         typename TNode::Value > >      \
+  operator op ( const typename TNode::Value & v,                        \
+                const ImageExpression<TNode> & e )                      \
+  {                                                                     \
+    typedef std::binder1st< functor<typename TNode::Value> > F;         \
+    typedef ImageExpressionUnary< TNode, F, typename TNode::Value > Node; \
+    return ImageExpression<Node>                                        \
+      ( Node( e, F( functor<typename TNode::Value>(), v ) ) );          \
+  }
+
+  /// e1 + e2, e + v and v + e, values of the type of the left expression.
+  DGTAL_IMAGE_EXPRESSION_OPERATOR( +, std::plus )
+  /// e1 - e2, e - v and v - e, values of the type of the left expression.
+  DGTAL_IMAGE_EXPRESSION_OPERATOR( -, std::minus )
+  /// e1 * e2, e * v and v * e, values of the type of the left expression.
+  DGTAL_IMAGE_EXPRESSION_OPERATOR( *, std::multiplies )
+  /// e1 / e2, e / v and v / e, values of the type of the left expression.
+  DGTAL_IMAGE_EXPRESSION_OPERATOR( /, std::divides )
+
+#undef DGTAL_IMAGE_EXPRESSION_OPERATOR
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/images/ImageExpression.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined ImageExpression_h
+
+#undef ImageExpression_RECURSES
+#endif // else defined(ImageExpression_RECURSES)
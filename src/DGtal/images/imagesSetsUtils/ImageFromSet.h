@@ -146,6 +146,23 @@ namespace DGtal
     {
       append<Set>(aImage,defaultValue,aSet.begin(),aSet.end());
     }
+
+    /** 
+     * Bulk version of append for images whose values are stored
+     * contiguously (ImageContainerBySTLVector). The points of the Set
+     * are grouped into runs along the last axis (consecutive points
+     * in the order of a sorted set): the offset of a point is computed
+     * once per run, and the values of a run are written with a
+     * constant stride. Points outside the image domain are ignored.
+     *
+     * @tparam Set model of CDigitalSet
+     * @param aImage an image (an ImageContainerBySTLVector).
+     * @param aSet an instance of Set to convert into an image
+     * @param defaultValue the default value for points in the set
+     */
+    template<typename Set>
+    static
+    void appendRuns(Image &aImage, const Set &aSet, const Value &defaultValue);
   }   ; // end of class ImageFromSet
 
 
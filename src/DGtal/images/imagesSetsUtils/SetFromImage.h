@@ -154,6 +154,36 @@ namespace DGtal
       append(aSet,aImage,isForeground);
     }
 
+    /** 
+     * Bulk version of append for images whose values are stored
+     * contiguously (ImageContainerBySTLVector): appends to a Set the
+     * points whose values are in ]minVal,maxVal].
+     *
+     * The image is cut into slabs of consecutive first coordinates.
+     * In each slab, the thresholds are computed on contiguous
+     * segments of values (simple loops that the compiler can
+     * vectorize), and the foreground points are gathered in the
+     * order of the points (first coordinate most significant). The
+     * slabs are processed in parallel when OpenMP is enabled and @a
+     * parallel is 'true'. The points are then inserted slab after
+     * slab in increasing order, with insertNew when the set is
+     * initially empty, so that a set based on a sorted container only
+     * appends them.
+     *
+     * @tparam Image an ImageContainerBySTLVector.
+     * @param aSet the set (maybe empty) to which points are added.
+     * @param aImage image to convert to a Set.
+     * @param minVal minimum value of the thresholding
+     * @param maxVal maximum value of the thresholding
+     * @param parallel when 'false', the slabs are processed sequentially.
+     */
+    template<typename Image>
+    static
+    void appendRuns(Set &aSet, const Image &aImage, 
+                    const typename Image::Value minVal,
+                    const typename Image::Value maxVal,
+                    bool parallel = true);
+
   };
 } // namespace DGtal
 
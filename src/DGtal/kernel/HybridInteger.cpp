@@ -0,0 +1,139 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file HybridInteger.cpp
+ * @author Jacques-Olivier Lachaud (\c jacques-olivier.lachaud@univ-savoie.fr )
+ * Laboratory of Mathematics (CNRS, UMR 5127), University of Savoie, France
+ *
+ * @date 2026/10/19
+ *
+ * Implementation of methods defined in HybridInteger.h
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include "DGtal/kernel/HybridInteger.h"
+///////////////////////////////////////////////////////////////////////////////
+
+#ifdef WITH_BIGINTEGER
+
+using namespace std;
+
+///////////////////////////////////////////////////////////////////////////////
+// class HybridInteger
+///////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////////
+// ----------------------- Representation ------------------------------
+
+DGtal::int64_t
+DGtal::HybridInteger::castToInt64_t() const
+{
+  if ( myBig == 0 ) return mySmall;
+  // n mod 2^64 in [0,2^64), read as a two's complement int64_t.
+  DGtal::BigInteger low;
+  mpz_fdiv_r_2exp( low.get_mpz_t(), myBig->get_mpz_t(), 64 );
+  DGtal::uint64_t u = 0;
+  mpz_export( &u, 0, -1, sizeof( u ), 0, 0, low.get_mpz_t() );
+  return (DGtal::int64_t) u;
+}
+
+double
+DGtal::HybridInteger::castToDouble() const
+{
+  return ( myBig == 0 ) ? (double) mySmall : myBig->get_d();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Internals - private :
+
+void
+DGtal::HybridInteger::bigOperation( Operation op, const HybridInteger & other )
+{
+  DGtal::BigInteger a = bigValue();
+  const DGtal::BigInteger b = other.bigValue();
+  switch ( op )
+    {
+    case ADD: a += b; break;
+    case SUB: a -= b; break;
+    case MUL: a *= b; break;
+    case DIV: a /= b; break;
+    case MOD: a %= b; break;
+    }
+  setBig( a );
+}
+
+void
+DGtal::HybridInteger::setBig( const DGtal::BigInteger & n )
+{
+  DGtal::int64_t small;
+  if ( fitsInt64( n, small ) )
+    {
+      if ( myBig != 0 ) clearBig();
+      mySmall = small;
+    }
+  else
+    {
+      if ( myBig != 0 ) *myBig = n;
+      else myBig = new DGtal::BigInteger( n );
+      mySmall = 0;
+    }
+}
+
+bool
+DGtal::HybridInteger::fitsInt64( const DGtal::BigInteger & n, 
+                                 DGtal::int64_t & small )
+{
+  const size_t bits = mpz_sizeinbase( n.get_mpz_t(), 2 );
+  const int sign = sgn( n );
+  // |n| < 2^63, or n = -2^63.
+  if ( ( bits > 64 ) 
+       || ( ( bits == 64 ) 
+            && ( ( sign > 0 ) || ( mpz_scan1( n.get_mpz_t(), 0 ) != 63 ) ) ) )
+    return false;
+  DGtal::uint64_t u = 0;
+  mpz_export( &u, 0, -1, sizeof( u ), 0, 0, n.get_mpz_t() );
+  small = (DGtal::int64_t) ( sign < 0 ? (DGtal::uint64_t) 0 - u : u );
+  return true;
+}
+
+void
+DGtal::HybridInteger::toBig( DGtal::BigInteger & big, DGtal::int64_t n )
+{
+  DGtal::uint64_t u = ( n < 0 ) 
+    ? (DGtal::uint64_t) 0 - (DGtal::uint64_t) n : (DGtal::uint64_t) n;
+  mpz_import( big.get_mpz_t(), 1, -1, sizeof( u ), 0, 0, &u );
+  if ( n < 0 ) mpz_neg( big.get_mpz_t(), big.get_mpz_t() );
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Implementation of functions                                               //
+
+std::istream&
+DGtal::operator>> ( std::istream & in, HybridInteger & object )
+{
+  DGtal::BigInteger n;
+  if ( in >> n )
+    object = HybridInteger( n );
+  return in;
+}
+
+#endif // WITH_BIGINTEGER
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,264 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file HybridInteger.h
+ * @author Jacques-Olivier Lachaud (\c jacques-olivier.lachaud@univ-savoie.fr )
+ * Laboratory of Mathematics (CNRS, UMR 5127), University of Savoie, France
+ *
+ * @date 2026/10/19
+ *
+ * Header file for module HybridInteger.cpp
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(HybridInteger_RECURSES)
+#error Recursive header files inclusion detected in HybridInteger.h
+#else // defined(HybridInteger_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define HybridInteger_RECURSES
+
+#if !defined HybridInteger_h
+/** Prevents repeated inclusion of headers. */
+#define HybridInteger_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include "DGtal/base/Common.h"
+//////////////////////////////////////////////////////////////////////////////
+
+#ifdef WITH_BIGINTEGER
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // class HybridInteger
+  /**
+Description of class 'HybridInteger' <p> \brief Aim: An exact integer
+stored inline as a 64 bits integer as long as it fits, and promoted to
+a BigInteger (GMP) only when an operation overflows.
+
+Arithmetical algorithms (gcd, continued fractions, DSS or plane
+recognition) need exact integers, but their values fit in 64 bits but
+on rare inputs. With BigInteger, every operation pays for GMP
+(function calls, memory allocations). With HybridInteger, an operation
+on two small values is a 64 bits operation followed by an overflow
+check; only when it overflows, the operation is redone with GMP. A big
+result that fits again in 64 bits goes back to the inline
+representation.
+
+It is a model of CInteger (and of CSignedInteger, CUnsignedInteger
+like BigInteger), with its NumberTraits specialization. The
+IntegerComputer specialized methods (gcd, floorDiv, ceilDiv) compute
+directly on 64 bits integers when both operands are small, and with
+the GMP functions otherwise.
+
+It is only defined when DGtal is compiled with GMP (WITH_BIGINTEGER).
+
+@code
+typedef IntegerComputer<HybridInteger> IC;
+IC ic;
+HybridInteger a = 1;
+for ( int i = 0; i < 100; ++i ) a *= 3; // promoted to a BigInteger
+HybridInteger g = ic.gcd( a, 81 );      // 81, back to 64 bits
+@endcode
+
+@see IntegerComputer
+   */
+  class HybridInteger
+  {
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Destructor.
+     */
+    ~HybridInteger();
+
+    /**
+     * Constructor. The value 0.
+     */
+    HybridInteger();
+
+    /**
+     * Constructor from a basic integer.
+     * @param n any 64 bits integer.
+     */
+    HybridInteger( DGtal::int64_t n );
+
+    /**
+     * Constructor from a big integer.
+     * @param n any big integer.
+     */
+    explicit HybridInteger( const DGtal::BigInteger & n );
+
+    /**
+     * Copy constructor.
+     * @param other the object to clone.
+     */
+    HybridInteger( const HybridInteger & other );
+
+    /**
+     * Assignment.
+     * @param other the object to copy.
+     * @return a reference on 'this'.
+     */
+    HybridInteger & operator= ( const HybridInteger & other );
+
+    // ----------------------- Representation ---------------------------------
+  public:
+
+    /// @return 'true' iff the value is stored inline on 64 bits.
+    bool isSmall() const;
+
+    /// @return the value, which must be small.
+    DGtal::int64_t smallValue() const;
+
+    /// @return the value as a big integer.
+    DGtal::BigInteger bigValue() const;
+
+    /// @return the value modulo 2^64, in two's complement.
+    DGtal::int64_t castToInt64_t() const;
+
+    /// @return the value as a double.
+    double castToDouble() const;
+
+    // ----------------------- Arithmetic -------------------------------------
+  public:
+
+    HybridInteger & operator+= ( const HybridInteger & other );
+    HybridInteger & operator-= ( const HybridInteger & other );
+    HybridInteger & operator*= ( const HybridInteger & other );
+    /// Division truncated toward zero, as for int64_t and BigInteger.
+    HybridInteger & operator/= ( const HybridInteger & other );
+    /// Remainder of the division truncated toward zero.
+    HybridInteger & operator%= ( const HybridInteger & other );
+    HybridInteger & operator++ ();
+    HybridInteger & operator-- ();
+    HybridInteger operator++ ( int );
+    HybridInteger operator-- ( int );
+    HybridInteger operator- () const;
+    HybridInteger operator+ () const;
+
+    /**
+     * @param other any integer.
+     * @return -1, 0 or 1 whether this is lower, equal or greater than
+     * [other].
+     */
+    int compare( const HybridInteger & other ) const;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /// The operations redone with GMP when they overflow.
+    enum Operation { ADD, SUB, MUL, DIV, MOD };
+
+    /// this = this op other, computed with GMP.
+    void bigOperation( Operation op, const HybridInteger & other );
+
+    /// Sets the value, inline when it fits in 64 bits.
+    void setBig( const DGtal::BigInteger & n );
+
+    /// Frees the big representation, if any.
+    void clearBig();
+
+    /// @return 'true' iff n fits in 64 bits, and then sets [small].
+    static bool fitsInt64( const DGtal::BigInteger & n, DGtal::int64_t & small );
+
+    /// Converts n to a big integer (independently of sizeof(long)).
+    static void toBig( DGtal::BigInteger & big, DGtal::int64_t n );
+
+    /// @return 'true' iff a + b, a - b or a * b overflows, the result
+    /// being in [r] otherwise.
+    static bool addOverflow( DGtal::int64_t a, DGtal::int64_t b, DGtal::int64_t & r );
+    static bool subOverflow( DGtal::int64_t a, DGtal::int64_t b, DGtal::int64_t & r );
+    static bool mulOverflow( DGtal::int64_t a, DGtal::int64_t b, DGtal::int64_t & r );
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+    /// The value when it fits in 64 bits (myBig == 0).
+    DGtal::int64_t mySmall;
+    /// The value otherwise, or 0.
+    DGtal::BigInteger* myBig;
+
+  }; // end of class HybridInteger
+
+  HybridInteger operator+ ( const HybridInteger & a, const HybridInteger & b );
+  HybridInteger operator- ( const HybridInteger & a, const HybridInteger & b );
+  HybridInteger operator* ( const HybridInteger & a, const HybridInteger & b );
+  HybridInteger operator/ ( const HybridInteger & a, const HybridInteger & b );
+  HybridInteger operator% ( const HybridInteger & a, const HybridInteger & b );
+  bool operator== ( const HybridInteger & a, const HybridInteger & b );
+  bool operator!= ( const HybridInteger & a, const HybridInteger & b );
+  bool operator< ( const HybridInteger & a, const HybridInteger & b );
+  bool operator<= ( const HybridInteger & a, const HybridInteger & b );
+  bool operator> ( const HybridInteger & a, const HybridInteger & b );
+  bool operator>= ( const HybridInteger & a, const HybridInteger & b );
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'HybridInteger'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'HybridInteger' to write.
+   * @return the output stream after the writing.
+   */
+  std::ostream&
+  operator<< ( std::ostream & out, const HybridInteger & object );
+
+  /**
+   * Reads a HybridInteger (in base 10) from an input stream.
+   * @param in the input stream.
+   * @param object (output) the integer read.
+   * @return the input stream after the reading.
+   */
+  std::istream&
+  operator>> ( std::istream & in, HybridInteger & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/kernel/HybridInteger.ih"
+
+#endif // WITH_BIGINTEGER
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined HybridInteger_h
+
+#undef HybridInteger_RECURSES
+#endif // else defined(HybridInteger_RECURSES)
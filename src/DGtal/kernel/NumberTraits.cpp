@@ -78,6 +78,8 @@ namespace DGtal
 #ifdef WITH_BIGINTEGER
   const DGtal::BigInteger NumberTraits<DGtal::BigInteger>::ONE = 1;
   const DGtal::BigInteger NumberTraits<DGtal::BigInteger>::ZERO = 0;
+  const DGtal::HybridInteger NumberTraits<DGtal::HybridInteger>::ONE = 1;
+  const DGtal::HybridInteger NumberTraits<DGtal::HybridInteger>::ZERO = 0;
 #endif 
 
 }
@@ -46,6 +46,7 @@
 #include <boost/integer_traits.hpp>
 #include <boost/call_traits.hpp>
 #include "DGtal/base/Common.h"
+#include "DGtal/kernel/HybridInteger.h"
 
 
 //////////////////////////////////////////////////////////////////////////////
@@ -1005,6 +1006,83 @@ namespace DGtal
       return mpz_odd_p( aT.get_mpz_t() );
     }
   }; // end of class NumberTraits<DGtal::BigInteger>.
+
+  /**
+   * Specialization for <DGtal::HybridInteger>. 
+   * Like DGtal::BigInteger, DGtal::HybridInteger represents
+   * signed and unsigned arbitrary-size integers. Therefore both
+   * IsUnsigned and IsSigned are TagTrue.
+   */
+  template <>
+  struct NumberTraits<DGtal::HybridInteger>
+  {
+    typedef TagFalse IsBounded;
+    typedef TagTrue IsUnsigned;
+    typedef TagTrue IsSigned;
+    typedef TagTrue IsSpecialized;
+    typedef DGtal::HybridInteger SignedVersion;
+    typedef DGtal::HybridInteger UnsignedVersion;
+    typedef DGtal::HybridInteger ReturnType;
+    typedef boost::call_traits<DGtal::HybridInteger>::param_type ParamType;
+    static const DGtal::HybridInteger ZERO;
+    static const DGtal::HybridInteger ONE;
+    static ReturnType zero()
+    {
+      return ZERO;
+    }
+    static ReturnType one()
+    {
+      return ONE;
+    }
+    static ReturnType min()
+    {
+      ASSERT2(false, "UnBounded interger type does not support min() function");
+      return ZERO;
+    }
+    static ReturnType max()
+    {
+      ASSERT2(false, "UnBounded interger type does not support max() function");
+      return ZERO;
+    }
+    static unsigned int digits()
+    {
+      ASSERT2(false, "UnBounded interger type does not support digits() function");
+      return 0;
+    }
+    static BoundEnum isBounded()
+    {
+      return UNBOUNDED;
+    }
+    static SignEnum isSigned()
+    {
+      return SIGNED;
+    }
+    static DGtal::int64_t castToInt64_t(const DGtal::HybridInteger & aT)
+    {
+      return aT.castToInt64_t();
+    }
+    static double castToDouble(const DGtal::HybridInteger & aT)
+    {
+      return aT.castToDouble();
+    }
+    /**
+       @param aT any number.
+       @return 'true' iff the number is even.
+    */
+    static bool even( ParamType aT )
+    {
+      return aT.isSmall() ? ( ( aT.smallValue() & 1 ) == 0 )
+        : mpz_even_p( aT.bigValue().get_mpz_t() );
+    }
+    /**
+       @param aT any number.
+       @return 'true' iff the number is odd.
+    */
+    static bool odd( ParamType aT )
+    {
+      return ! even( aT );
+    }
+  }; // end of class NumberTraits<DGtal::HybridInteger>.
 #endif
 
 
@@ -0,0 +1,523 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file DigitalSetByRuns.h
+ * @author Jacques-Olivier Lachaud (\c jacques-olivier.lachaud@univ-savoie.fr )
+ * Laboratory of Mathematics (CNRS, UMR 5807), University of Savoie, France
+ *
+ * @date 2026/10/19
+ *
+ * Header file for module DigitalSetByRuns.cpp
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(DigitalSetByRuns_RECURSES)
+#error Recursive header files inclusion detected in DigitalSetByRuns.h
+#else // defined(DigitalSetByRuns_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define DigitalSetByRuns_RECURSES
+
+#if !defined DigitalSetByRuns_h
+/** Prevents repeated inclusion of headers. */
+#define DigitalSetByRuns_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <iterator>
+#include <vector>
+#include <string>
+#include "DGtal/base/Common.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class DigitalSetByRuns
+  /**
+    Description of template class 'DigitalSetByRuns' <p>
+
+    \brief Aim: A container class for storing sets of digital points
+    within some given hyper-rectangular domain as runs of consecutive
+    points along the first axis.
+
+    The domain is decomposed into rows, i.e. lines parallel to the
+    first axis. A row is indexed by the remaining coordinates, in the
+    same order as the scanlines of an ImageContainerBySTLVector on the
+    same domain. Each row stores a sorted list of disjoint and
+    non-adjacent runs [first,last]. The memory is thus proportional to
+    the number of rows plus the number of runs, which is much less
+    than a std::set<Point> or a dense image for large compact shapes.
+
+    Set unions, intersections, differences and complements between
+    sets lying in the same domain are computed run by run, row by row,
+    in parallel when OpenMP is available. Iteration visits the points
+    row by row and, inside each row, run by run. Contrary to
+    DigitalSetBySTLSet, the points are thus not enumerated in the
+    lexicographic order of Point, but in the storage order of
+    ImageContainerBySTLVector (first coordinate fastest).
+
+    Model of CDigitalSet.
+
+    @tparam TDomain the type of domain, a HyperRectDomain.
+
+    @code
+    Z3i::Domain domain( Z3i::Point( 0, 0, 0 ), Z3i::Point( 255, 255, 255 ) );
+    DigitalSetByRuns<Z3i::Domain> a( domain ), b( domain );
+    a.assignFromImage( image, 0, 255 );   // voxels in ]0,255]
+    ...
+    a *= b;                                // intersection
+    a.fillImage( image, 128 );
+    @endcode
+   */
+  template <typename TDomain>
+  class DigitalSetByRuns
+  {
+  public:
+    typedef TDomain Domain;
+    typedef DigitalSetByRuns<Domain> Self;
+    typedef typename Domain::Space Space;
+    typedef typename Domain::Point Point;
+    typedef typename Domain::Size Size;
+    typedef typename Point::Coordinate Coordinate;
+
+    /**
+     * A run of consecutive points along the first axis, from [first]
+     * to [last] (included).
+     */
+    struct Run
+    {
+      Coordinate first;
+      Coordinate last;
+      Run() {}
+      Run( Coordinate f, Coordinate l ) : first( f ), last( l ) {}
+    };
+
+    /// The runs of one row, sorted, disjoint and non-adjacent.
+    typedef std::vector<Run> RunRow;
+
+    /**
+     * Read-only bidirectional iterator on the points of the set. It
+     * stays valid as long as the set is not modified.
+     */
+    class ConstIterator
+    {
+    public:
+      typedef std::bidirectional_iterator_tag iterator_category;
+      typedef Point value_type;
+      typedef std::ptrdiff_t difference_type;
+      typedef const Point* pointer;
+      typedef const Point& reference;
+
+      ConstIterator();
+      ConstIterator( const DigitalSetByRuns* aSet, Size aRow,
+                     Size aRun, const Point & aPoint );
+      const Point & operator*() const;
+      const Point* operator->() const;
+      ConstIterator & operator++();
+      ConstIterator operator++( int );
+      ConstIterator & operator--();
+      ConstIterator operator--( int );
+      bool operator==( const ConstIterator & other ) const;
+      bool operator!=( const ConstIterator & other ) const;
+
+    private:
+      friend class DigitalSetByRuns;
+      /// The set that is visited.
+      const DigitalSetByRuns* mySet;
+      /// The index of the current row, the number of rows at the end.
+      Size myRow;
+      /// The index of the current run in its row.
+      Size myRun;
+      /// The current point.
+      Point myPoint;
+    };
+
+    /// Points of a set are not modifiable through an iterator.
+    typedef ConstIterator Iterator;
+    friend class ConstIterator;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Destructor.
+     */
+    ~DigitalSetByRuns();
+
+    /**
+     * Constructor.
+     * Creates the empty set in the domain [d].
+     *
+     * @param d any domain.
+     */
+    DigitalSetByRuns( const Domain & d );
+
+    /**
+     * Copy constructor.
+     * @param other the object to clone.
+     */
+    DigitalSetByRuns ( const DigitalSetByRuns & other );
+
+    /**
+     * Assignment.
+     * @param other the object to copy.
+     * @return a reference on 'this'.
+     * @pre the domain of [other] is included in the domain of 'this'.
+     */
+    DigitalSetByRuns & operator= ( const DigitalSetByRuns & other );
+
+    /**
+     * @return the embedding domain.
+     */
+    const Domain & domain() const;
+
+    // ----------------------- Standard Set services --------------------------
+  public:
+
+    /**
+     * @return the number of elements in the set.
+     */
+    Size size() const;
+
+    /**
+     * @return 'true' iff the set is empty (no element).
+     */
+    bool empty() const;
+
+    /**
+     * Adds point [p] to this set.
+     *
+     * @param p any digital point.
+     * @pre p should belong to the associated domain.
+     */
+    void insert( const Point & p );
+
+    /**
+     * Adds the collection of points specified by the two iterators to
+     * this set.
+     *
+     * @param first the start point in the collection of Point.
+     * @param last the last point in the collection of Point.
+     * @pre all points should belong to the associated domain.
+     */
+    template <typename PointInputIterator>
+    void insert( PointInputIterator first, PointInputIterator last );
+
+    /**
+     * Adds point [p] to this set if the point is not already in the
+     * set.
+     *
+     * @param p any digital point.
+     *
+     * @pre p should belong to the associated domain.
+     * @pre p should not belong to this.
+     */
+    void insertNew( const Point & p );
+
+    /**
+     * Adds the collection of points specified by the two iterators to
+     * this set.
+     *
+     * @param first the start point in the collection of Point.
+     * @param last the last point in the collection of Point.
+     *
+     * @pre all points should belong to the associated domain.
+     * @pre each point should not belong to this.
+     */
+    template <typename PointInputIterator>
+    void insertNew( PointInputIterator first, PointInputIterator last );
+
+    /**
+     * Removes point [p] from the set.
+     *
+     * @param p the point to remove.
+     * @return the number of removed elements (0 or 1).
+     */
+    Size erase( const Point & p );
+
+    /**
+     * Removes the point pointed by [it] from the set.
+     *
+     * @param it an iterator on this set.
+     */
+    void erase( Iterator it );
+
+    /**
+     * Removes the collection of points specified by the two iterators from
+     * this set.
+     *
+     * @param first the start point in this set.
+     * @param last the last point in this set.
+     */
+    void erase( Iterator first, Iterator last );
+
+    /**
+     * Clears the set.
+     * @post this set is empty.
+     */
+    void clear();
+
+    /**
+     * @param p any digital point.
+     * @return a const iterator pointing on [p] if found, otherwise end().
+     */
+    ConstIterator find( const Point & p ) const;
+
+    /**
+     * @return a const iterator on the first element in this set.
+     */
+    ConstIterator begin() const;
+
+    /**
+     * @return a const iterator on the element after the last in this set.
+     */
+    ConstIterator end() const;
+
+    /**
+     * set union to left.
+     * @param aSet any other set.
+     * @return a reference on 'this'.
+     */
+    DigitalSetByRuns & operator+= ( const DigitalSetByRuns & aSet );
+
+    /**
+     * set intersection to left.
+     * @param aSet any other set.
+     * @return a reference on 'this'.
+     */
+    DigitalSetByRuns & operator*= ( const DigitalSetByRuns & aSet );
+
+    /**
+     * set difference to left.
+     * @param aSet any other set.
+     * @return a reference on 'this'.
+     */
+    DigitalSetByRuns & operator-= ( const DigitalSetByRuns & aSet );
+
+    // ----------------------- Other Set services -----------------------------
+  public:
+
+    /**
+     * Computes the complement in the domain of this set
+     * @param ito an output iterator
+     * @tparam TOutputIterator a model of output iterator
+     */
+    template< typename TOutputIterator >
+    void computeComplement(TOutputIterator& ito) const;
+
+    /**
+     * Builds the complement in the domain of the set [other_set] in
+     * this.
+     *
+     * @param other_set defines the set whose complement is assigned to 'this'.
+     */
+    void assignFromComplement( const DigitalSetByRuns & other_set );
+
+    /**
+     * Computes the bounding box of this set.
+     *
+     * @param lower the first point of the bounding box (lowest in all
+     * directions).
+     * @param upper the last point of the bounding box (highest in all
+     * directions).
+     */
+    void computeBoundingBox( Point & lower, Point & upper ) const;
+
+    // ----------------------- Run services -----------------------------------
+  public:
+
+    /**
+     * @return the total number of runs of this set.
+     */
+    Size nbRuns() const;
+
+    /**
+     * @param p any point of the domain.
+     * @return the runs of the row containing [p].
+     */
+    const RunRow & runs( const Point & p ) const;
+
+    /**
+     * Assigns to this set the points of [aImage] whose values are in
+     * ]minVal,maxVal], as SetFromImage::append does. When the image
+     * and the set have the same domain bounds, the runs are extracted
+     * scanline by scanline from the image storage.
+     *
+     * @tparam TValue the type of value of the image.
+     * @param aImage any image, points outside the domain of 'this'
+     * are ignored.
+     * @param minVal minimum value of the thresholding.
+     * @param maxVal maximum value of the thresholding.
+     */
+    template <typename TValue>
+    void assignFromImage( const ImageContainerBySTLVector<Domain,TValue> & aImage,
+                          const TValue & minVal, const TValue & maxVal );
+
+    /**
+     * Sets the value of the points of this set in [aImage] to
+     * [aValue], as ImageFromSet::append does. When the image and the
+     * set have the same domain bounds, each run is filled at once in
+     * the image storage.
+     *
+     * @tparam TValue the type of value of the image.
+     * @param aImage any image, points outside its domain are ignored.
+     * @param aValue the value to set.
+     */
+    template <typename TValue>
+    void fillImage( ImageContainerBySTLVector<Domain,TValue> & aImage,
+                    const TValue & aValue ) const;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    /**
+     * @return the style name used for drawing this object.
+     */
+    std::string className() const;
+
+    // ------------------------- Protected Datas ------------------------------
+  protected:
+
+    /**
+     * The associated domain;
+     */
+    const Domain & myDomain;
+
+    /**
+     * The extent of the domain along each axis.
+     */
+    Point myExtent;
+
+    /**
+     * The runs of each row, rows being ordered as the scanlines of an
+     * image on the same domain.
+     */
+    std::vector<RunRow> myRows;
+
+    /**
+     * The number of points of the set.
+     */
+    Size mySize;
+
+    // ------------------------- Hidden services ------------------------------
+  protected:
+
+    /**
+     * Default Constructor.
+     * Forbidden since a Domain is necessary for defining a set.
+     */
+    DigitalSetByRuns();
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+     * @param p any point of the domain.
+     * @return the index of the row containing [p].
+     */
+    Size rowIndex( const Point & p ) const;
+
+    /**
+     * @param r the index of a row.
+     * @return the point of the row [r] with first coordinate 0.
+     */
+    Point rowPoint( Size r ) const;
+
+    /**
+     * @param other any set.
+     * @return 'true' iff [other] has the same domain bounds as 'this',
+     * so that rows correspond one to one.
+     */
+    bool sameLayout( const DigitalSetByRuns & other ) const;
+
+    /**
+     * Recomputes mySize from the runs.
+     */
+    void updateSize();
+
+    /**
+     * @param a any row.
+     * @return the number of points of the row.
+     */
+    static Size length( const RunRow & a );
+
+    /**
+     * Computes in [out] the union of rows [a] and [b].
+     */
+    static void unite( RunRow & out, const RunRow & a, const RunRow & b );
+
+    /**
+     * Computes in [out] the intersection of rows [a] and [b].
+     */
+    static void intersect( RunRow & out, const RunRow & a, const RunRow & b );
+
+    /**
+     * Computes in [out] the difference of rows [a] and [b].
+     */
+    static void subtract( RunRow & out, const RunRow & a, const RunRow & b );
+
+    /**
+     * Computes in [out] the complement of row [a] in [lo,hi].
+     */
+    static void complement( RunRow & out, const RunRow & a,
+                            Coordinate lo, Coordinate hi );
+
+  }; // end of class DigitalSetByRuns
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'DigitalSetByRuns'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'DigitalSetByRuns' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename Domain>
+  std::ostream&
+  operator<< ( std::ostream & out, const DigitalSetByRuns<Domain> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/kernel/sets/DigitalSetByRuns.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined DigitalSetByRuns_h
+
+#undef DigitalSetByRuns_RECURSES
+#endif // else defined(DigitalSetByRuns_RECURSES)
@@ -463,6 +463,329 @@ DGtal::AngleLinearMinimizerByAdaptiveStepGradientDescent::lastDelta() const
 
 
 
+void
+DGtal::AngleLinearMinimizerByDirectSolver::oneStep( unsigned int i1, unsigned int i2 )
+{
+  const unsigned int n = size();
+  ModuloComputer<unsigned int> mc( n );
+  if ( myStates.size() != n )
+    myStates.assign( n, FREE );
+  const bool whole = ( i1 == i2 );
+  if ( whole && myIsCurveOpen ) 
+    i1 = i2 = 0;
+  const unsigned int L = whole ? n : ( i2 + n - i1 ) % n;
+  const bool cyclic = whole && ! myIsCurveOpen;
+  myU.resize( L );
+  myLo.resize( L );
+  myHi.resize( L );
+  myWindowStates.resize( L );
+  myW.resize( L );
+  myTmpC.resize( L );
+  myTmpD.resize( L );
+
+  // Unwraps the values and their bounds along the window, from its
+  // left neighbor. myW[ j ] links the values j and j+1.
+  double vL = 0.0;
+  double wL = 0.0;
+  unsigned int iprev = mc.previous( i1 );
+  double uprev = 0.0;
+  if ( ! whole )
+    {
+      vL = ro( iprev ).value;
+      wL = edgeWeight( iprev );
+      uprev = vL;
+    }
+  unsigned int i = i1;
+  for ( unsigned int j = 0; j < L; ++j )
+    {
+      const ValueInfo & vi = this->ro( i );
+      myU[ j ] = ( whole && ( j == 0 ) ) ? vi.value
+        : uprev + AngleComputer::deviation( vi.value, ro( iprev ).value );
+      myLo[ j ] = myU[ j ] + AngleComputer::deviation( vi.min, vi.value );
+      myHi[ j ] = myU[ j ] + AngleComputer::deviation( vi.max, vi.value );
+      if ( myHi[ j ] < myLo[ j ] ) myHi[ j ] = myLo[ j ];
+      myWindowStates[ j ] = FREE;
+      myW[ j ] = edgeWeight( i );
+      uprev = myU[ j ];
+      iprev = i;
+      i = mc.next( i );
+    }
+  double vR = 0.0;
+  double wR = 0.0;
+  double T = 0.0;
+  if ( ! whole )
+    {
+      vR = uprev + AngleComputer::deviation( ro( i2 ).value, ro( iprev ).value );
+      wR = myW[ L - 1 ];
+    }
+  else if ( cyclic )
+    { // the total rotation of the closed curve, a multiple of 2pi.
+      const double twoPi = 2.0 * M_PI;
+      double S = uprev + AngleComputer::deviation( ro( i1 ).value, ro( iprev ).value )
+        - myU[ 0 ];
+      T = twoPi * floor( S / twoPi + 0.5 );
+    }
+
+  // Primal-dual active set iterations. They start with all the values
+  // free, so that the unconstrained solution of a closed curve, defined
+  // up to a rotation, is the one with a zero mean displacement.
+  const double eps = 1e-12;
+  const unsigned int maxIterations = 2 * L + 10;
+  myNbIterations = 0;
+  bool changed = true;
+  while ( changed && ( myNbIterations < maxIterations ) )
+    {
+      ++myNbIterations;
+      for ( unsigned int j = 0; j < L; ++j )
+        if ( myWindowStates[ j ] == LOWER ) myU[ j ] = myLo[ j ];
+        else if ( myWindowStates[ j ] == UPPER ) myU[ j ] = myHi[ j ];
+      if ( cyclic ) 
+        solveCycle( L, T );
+      else
+        solveChain( &myU[ 0 ], &myWindowStates[ 0 ], &myW[ 0 ], 
+                    L, vL, wL, vR, wR );
+      changed = false;
+      for ( unsigned int j = 0; j < L; ++j )
+        {
+          const double u = myU[ j ];
+          unsigned char & st = myWindowStates[ j ];
+          if ( st == FREE )
+            {
+              const double tol = eps * ( 1.0 + fabs( u ) );
+              if ( u < myLo[ j ] - tol ) { st = LOWER; changed = true; }
+              else if ( u > myHi[ j ] + tol ) { st = UPPER; changed = true; }
+              continue;
+            }
+          if ( myLo[ j ] == myHi[ j ] ) continue;
+          double wl, vl, wr, vr;
+          if ( j > 0 ) { wl = myW[ j - 1 ]; vl = myU[ j - 1 ]; }
+          else if ( cyclic ) { wl = myW[ L - 1 ]; vl = myU[ L - 1 ] - T; }
+          else { wl = wL; vl = vL; }
+          if ( j < L - 1 ) { wr = myW[ j ]; vr = myU[ j + 1 ]; }
+          else if ( cyclic ) { wr = myW[ L - 1 ]; vr = myU[ 0 ] + T; }
+          else { wr = wR; vr = vR; }
+          // half of the derivative of the energy.
+          const double g = wl * ( u - vl ) + wr * ( u - vr );
+          const double tol = eps * ( wl + wr ) * ( 1.0 + fabs( u ) );
+          if ( ( ( st == LOWER ) && ( g < -tol ) ) 
+               || ( ( st == UPPER ) && ( g > tol ) ) )
+            {
+              st = FREE;
+              changed = true;
+            }
+        }
+    }
+
+  i = i1;
+  for ( unsigned int j = 0; j < L; ++j )
+    {
+      ValueInfo & vi = this->rw( i );
+      if ( myWindowStates[ j ] == LOWER ) 
+        vi.value = vi.min;
+      else if ( myWindowStates[ j ] == UPPER ) 
+        vi.value = vi.max;
+      else
+        {
+          double u = myU[ j ];
+          if ( u < myLo[ j ] ) u = myLo[ j ];
+          if ( u > myHi[ j ] ) u = myHi[ j ];
+          vi.value = AngleComputer::cast( u );
+        }
+      myStates[ i ] = myWindowStates[ j ];
+      i = mc.next( i );
+    }
+  myNbSolved = myIsUpdating ? myNbSolved + L : L;
+}
+
+
+void
+DGtal::AngleLinearMinimizerByDirectSolver::solveChain
+( double* u, const unsigned char* st, const double* w,
+  unsigned int L, double vL, double wL, double vR, double wR )
+{
+  double* c = &myTmpC[ 0 ];
+  double* d = &myTmpD[ 0 ];
+  unsigned int j = 0;
+  while ( j < L )
+    {
+      if ( st[ j ] != FREE ) 
+        {
+          ++j;
+          continue;
+        }
+      // [a,b] is a run of free values linked together.
+      const unsigned int a = j;
+      while ( ( j + 1 < L ) && ( st[ j + 1 ] == FREE ) && ( w[ j ] > 0.0 ) ) 
+        ++j;
+      const unsigned int b = j++;
+      const double lw = ( a == 0 ) ? wL : w[ a - 1 ];
+      const double lv = ( a == 0 ) ? vL : u[ a - 1 ];
+      const double rw = ( b == L - 1 ) ? wR : w[ b ];
+      const double rv = ( b == L - 1 ) ? vR : u[ b + 1 ];
+      if ( ( lw <= 0.0 ) && ( rw <= 0.0 ) )
+        { // no fixed extremity: the values are equal, as close as
+          // possible to the current ones.
+          double mean = 0.0;
+          for ( unsigned int k = a; k <= b; ++k ) mean += u[ k ];
+          mean /= (double) ( b - a + 1 );
+          for ( unsigned int k = a; k <= b; ++k ) u[ k ] = mean;
+          continue;
+        }
+      // Thomas algorithm on the rows (left+right) u_k - left u_{k-1}
+      // - right u_{k+1} = 0, the fixed extremities being moved to the
+      // right-hand side.
+      const unsigned int m = b - a + 1;
+      for ( unsigned int k = 0; k < m; ++k )
+        {
+          const double left = ( k == 0 ) ? lw : w[ a + k - 1 ];
+          const double right = ( k == m - 1 ) ? rw : w[ a + k ];
+          double rhs = 0.0;
+          if ( k == 0 ) rhs += lw * lv;
+          if ( k == m - 1 ) rhs += rw * rv;
+          double denom = left + right;
+          if ( k > 0 )
+            {
+              denom -= left * c[ k - 1 ];
+              rhs += left * d[ k - 1 ];
+            }
+          c[ k ] = right / denom;
+          d[ k ] = rhs / denom;
+        }
+      u[ b ] = d[ m - 1 ];
+      for ( unsigned int k = m - 1; k > 0; --k )
+        u[ a + k - 1 ] = d[ k - 1 ] + c[ k - 1 ] * u[ a + k ];
+    }
+}
+
+
+void
+DGtal::AngleLinearMinimizerByDirectSolver::solveCycle( unsigned int L, double T )
+{
+  unsigned int p = 0;
+  while ( ( p < L ) && ( myWindowStates[ p ] == FREE ) ) 
+    ++p;
+  if ( p == L )
+    { // no active value: the flux (u_{j+1} - u_j) w_j is the same
+      // along the curve, and the mean displacement is zero.
+      double D = 0.0;
+      for ( unsigned int j = 0; j < L; ++j ) D += 1.0 / myW[ j ];
+      const double q = T / D;
+      double x = 0.0;
+      double shift = 0.0;
+      for ( unsigned int j = 0; j < L; ++j )
+        {
+          myTmpC[ j ] = x;
+          shift += myU[ j ] - x;
+          x += q / myW[ j ];
+        }
+      shift /= (double) L;
+      for ( unsigned int j = 0; j < L; ++j ) 
+        myU[ j ] = myTmpC[ j ] + shift;
+      return;
+    }
+  // The curve is cut at the active value p: the chain p+1, ..., p+L-1
+  // is bordered by u_p and u_p + T.
+  const double up = myU[ p ];
+  const double wp = myW[ p ];
+  const double wprev = myW[ ( p + L - 1 ) % L ];
+  std::rotate( myU.begin(), myU.begin() + p + 1, myU.end() );
+  std::rotate( myWindowStates.begin(), myWindowStates.begin() + p + 1, myWindowStates.end() );
+  std::rotate( myW.begin(), myW.begin() + p + 1, myW.end() );
+  for ( unsigned int k = L - 1 - p; k < L; ++k ) myU[ k ] += T;
+  solveChain( &myU[ 0 ], &myWindowStates[ 0 ], &myW[ 0 ], L - 1,
+              up, wp, up + T, wprev );
+  for ( unsigned int k = L - 1 - p; k < L; ++k ) myU[ k ] -= T;
+  std::rotate( myU.begin(), myU.begin() + ( L - 1 - p ), myU.end() );
+  std::rotate( myWindowStates.begin(), myWindowStates.begin() + ( L - 1 - p ), myWindowStates.end() );
+  std::rotate( myW.begin(), myW.begin() + ( L - 1 - p ), myW.end() );
+}
+
+
+bool
+DGtal::AngleLinearMinimizerByDirectSolver::isActiveOptimal( unsigned int i ) const
+{
+  ModuloComputer<unsigned int> mc( size() );
+  const unsigned int iprev = mc.previous( i );
+  const unsigned int inext = mc.next( i );
+  const ValueInfo & vi = this->ro( i );
+  const double wl = edgeWeight( iprev );
+  const double wr = edgeWeight( i );
+  const double g = wl * AngleComputer::deviation( vi.value, ro( iprev ).value )
+    + wr * AngleComputer::deviation( vi.value, ro( inext ).value );
+  const double tol = 1e-12 * ( wl + wr ) * ( 1.0 + fabs( vi.value ) );
+  if ( myStates[ i ] == LOWER ) return g >= -tol;
+  if ( myStates[ i ] == UPPER ) return g <= tol;
+  return true;
+}
+
+
+double
+DGtal::AngleLinearMinimizerByDirectSolver::update( unsigned int i1, unsigned int i2 )
+{
+  const unsigned int n = size();
+  if ( ( myStates.size() != n ) || ( i1 == i2 ) )
+    return optimize();
+  ModuloComputer<unsigned int> mc( n );
+  unsigned int a = i1;
+  unsigned int b = i2;
+  unsigned int L = ( b + n - a ) % n;
+  double s = 0.0;
+  myNbSolved = 0;
+  myIsUpdating = true;
+  bool done = false;
+  while ( ! done )
+    {
+      // Extends the window to the free values linked to it.
+      while ( ( L < n ) && ( myStates[ mc.previous( a ) ] == FREE ) 
+              && ( edgeWeight( mc.previous( a ) ) > 0.0 ) )
+        {
+          a = mc.previous( a );
+          ++L;
+        }
+      while ( ( L < n ) && ( myStates[ b ] == FREE ) 
+              && ( edgeWeight( mc.previous( b ) ) > 0.0 ) )
+        {
+          b = mc.next( b );
+          ++L;
+        }
+      if ( L >= n ) break;
+      s = optimize( a, b );
+      // The active values bordering the window may not be optimal
+      // anymore with their new neighbors.
+      done = true;
+      const unsigned int ia = mc.previous( a );
+      if ( ( edgeWeight( ia ) > 0.0 ) && ! isActiveOptimal( ia ) )
+        {
+          myStates[ ia ] = FREE;
+          a = ia;
+          ++L;
+          done = false;
+        }
+      if ( ( L < n ) && ( edgeWeight( mc.previous( b ) ) > 0.0 ) 
+           && ! isActiveOptimal( b ) )
+        {
+          myStates[ b ] = FREE;
+          b = mc.next( b );
+          ++L;
+          done = false;
+        }
+      if ( L >= n ) break;
+    }
+  myIsUpdating = false;
+  if ( L >= n ) 
+    s = optimize();
+  return s;
+}
+
+
+double
+DGtal::AngleLinearMinimizerByDirectSolver::lastDelta() const
+{
+  return max();
+}
+
+
+
 ///////////////////////////////////////////////////////////////////////////////
 // Interface - public :
 
@@ -507,6 +830,17 @@ DGtal::AngleLinearMinimizerByAdaptiveStepGradientDescent::selfDisplay( std::ostr
   aStream << "[LinearMinimizer::gradient descent with adaptive step " << myStep << "]";
 }
 
+/**
+ * Writes/Displays the object on an output stream.
+ * @param aStream the output stream where the object is written.
+ */
+void 
+DGtal::AngleLinearMinimizerByDirectSolver::selfDisplay( std::ostream& aStream ) const
+{
+  aStream << "[LinearMinimizer::direct solver with active set " 
+          << myNbIterations << " iterations]";
+}
+
 /**
  * Checks the validity/consistency of the object.
  * @return 'true' if the object is valid, 'false' otherwise.
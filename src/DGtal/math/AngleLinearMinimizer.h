@@ -46,6 +46,7 @@
 // Inclusions
 #include <iostream>
 #include <vector>
+#include <algorithm>
 #include "DGtal/base/Common.h"
 #include "DGtal/math/AngleComputer.h" 
 #include "DGtal/arithmetic/ModuloComputer.h" 
@@ -534,6 +535,176 @@ public:
   
 
 
+  /**
+   * Specializes AngleLinearMinimizer to compute directly the exact
+   * minimum of the energy under the bounds, instead of iterating
+   * sweeps whose number grows with the size of the curve.
+   *
+   * The angles are unwrapped along the curve, so that the energy is
+   * a quadratic function of the values, with a tridiagonal (or
+   * periodic tridiagonal for a closed curve) matrix. The bounds are
+   * handled by a primal-dual active set method: each iteration fixes
+   * the active values to their bound and solves the free runs of
+   * values between them by Gaussian elimination (Thomas algorithm),
+   * then frees the active values whose multiplier has the wrong sign
+   * and activates the free values out of their bounds. Since the
+   * matrix is an M-matrix, only a few iterations are needed. Hence
+   * one call to optimize() gives the minimum in O(n) per iteration.
+   *
+   * optimize(i1,i2) computes the minimum over the values [i1,i2[
+   * only, the other values being fixed. update(i1,i2) re-solves the
+   * whole problem after a change of the values [i1,i2[ (e.g. their
+   * bounds): only the runs of free values around [i1,i2[ are solved
+   * again, up to the first active values that remain active.
+   */
+  class AngleLinearMinimizerByDirectSolver : public AngleLinearMinimizer
+  {
+  public:
+    /**
+     * Default constructor.
+     */
+     AngleLinearMinimizerByDirectSolver();
+
+    /**
+     * Destructor. Does nothing.
+     */
+     virtual ~AngleLinearMinimizerByDirectSolver();
+
+    /**
+     * Computes again the minimum of the whole energy after a change
+     * of the values [i1] included to [i2] excluded, when the other
+     * values are the result of a previous optimization. The window
+     * is extended to the free values connected to it, and further
+     * when the active values bordering it do not remain optimal. The
+     * whole problem is solved if there was no previous optimization.
+     *
+     * @param i1 the first changed value (between 0 and 'size()-1').
+     * @param i2 the value after the last changed one (between 0 and 'size()-1').
+     * @return the sum of the displacements of the last solved window.
+     */
+    double update( unsigned int i1, unsigned int i2 );
+
+    /**
+     * @param i any index below 'size()'.
+     * @return 'true' if the [i]th value is at one of its bounds in
+     * the last solution.
+     */
+    bool isActive( unsigned int i ) const;
+
+    /**
+     * @return the number of active set iterations of the last optimization.
+     */
+    unsigned int nbIterations() const;
+
+    /**
+     * @return the number of values solved by the last optimize() or update().
+     */
+    unsigned int nbSolvedValues() const;
+
+  protected:
+    
+    /**
+     * The method which performs the optimization effectively. Computes
+     * the minimum of the energy over the values [i1] included to [i2]
+     * excluded, the others being fixed.
+     *
+     * @param i1 the first value to be optimized (between 0 and 'size()-1').
+     * @param i2 the value after the last to be optimized (between 0 and 'size()-1').
+     */
+    virtual void oneStep( unsigned int i1, unsigned int i2 );
+
+public:
+    /**
+     * Should be used to stop the minimization process. The smaller is
+     * this value, the more the optimization is at an end. May have
+     * several meanings, like the infinite norm of the last displacement
+     * or the infinite norm of the projected gradient.
+     *
+     * @return an upper bound on the norm of the last displacement. 
+     */
+    virtual double lastDelta() const; 
+
+    // ----------------------- Interface --------------------------------------
+  public:
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param aStream the output stream where the object is written.
+     */
+    virtual void selfDisplay( std::ostream & aStream ) const;
+
+  private:
+
+    /// The status of a value in the active set method.
+    enum State { FREE = 0, LOWER = 1, UPPER = 2 };
+
+    /**
+     * The status of each value in the last solution.
+     */
+    std::vector<unsigned char> myStates;
+
+    /**
+     * The unwrapped values, bounds, states and edge weights of the
+     * solved window, and the work arrays of the Thomas algorithm.
+     */
+    std::vector<double> myU;
+    std::vector<double> myLo;
+    std::vector<double> myHi;
+    std::vector<unsigned char> myWindowStates;
+    std::vector<double> myW;
+    std::vector<double> myTmpC;
+    std::vector<double> myTmpD;
+
+    /**
+     * The number of active set iterations of the last optimization.
+     */
+    unsigned int myNbIterations;
+
+    /**
+     * The number of values solved by the last optimize() or update().
+     */
+    unsigned int myNbSolved;
+
+    /**
+     * When 'true', oneStep adds the size of the window to myNbSolved
+     * instead of resetting it.
+     */
+    bool myIsUpdating;
+
+    /**
+     * @param i any index below 'size()'.
+     * @return the weight (inverse of the distance) of the edge
+     * between the [i]th value and the next one, 0 if they are not
+     * linked.
+     */
+    double edgeWeight( unsigned int i ) const;
+
+    /**
+     * @param i any index below 'size()'.
+     * @return 'true' if the [i]th value, active, satisfies the
+     * optimality conditions with its current neighbors.
+     */
+    bool isActiveOptimal( unsigned int i ) const;
+
+    /**
+     * Solves the free values of a chain of [L] values with fixed
+     * values at its extremities: [vL] linked with weight [wL] to the
+     * first value, [vR] linked with weight [wR] to the last one. The
+     * weight [w][j] links the values j and j+1.
+     */
+    void solveChain( double* u, const unsigned char* st, const double* w,
+                     unsigned int L, double vL, double wL, 
+                     double vR, double wR );
+
+    /**
+     * Solves the free values of the closed curve, whose last value is
+     * linked to the first one plus [T] by the weight w[L-1].
+     */
+    void solveCycle( unsigned int L, double T );
+
+  };
+  
+
+
 /**
  * Overloads 'operator<<' for displaying objects of class 'AngleLinearMinimizer'.
  * @param out the output stream where the object is written.
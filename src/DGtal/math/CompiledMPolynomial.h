@@ -0,0 +1,316 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file CompiledMPolynomial.h
+ * @author Jacques-Olivier Lachaud (\c jacques-olivier.lachaud@univ-savoie.fr )
+ * Laboratory of Mathematics (CNRS, UMR 5807), University of Savoie, France
+ *
+ * @date 2026/10/19
+ *
+ * Header file for module CompiledMPolynomial.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(CompiledMPolynomial_RECURSES)
+#error Recursive header files inclusion detected in CompiledMPolynomial.h
+#else // defined(CompiledMPolynomial_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define CompiledMPolynomial_RECURSES
+
+#if !defined CompiledMPolynomial_h
+/** Prevents repeated inclusion of headers. */
+#define CompiledMPolynomial_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/math/MPolynomial.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /**
+   * Flattens a multivariate polynomial with k indeterminates into the
+   * arrays of a CompiledMPolynomial (used by CompiledMPolynomial only).
+   */
+  template <int k, typename TRing, typename TAlloc>
+  struct MPolynomialCompiler
+  {
+    static void compile( const MPolynomial<k, TRing, TAlloc> & p,
+                         std::vector<int> & degrees,
+                         std::vector<TRing> & coefficients )
+    {
+      degrees.push_back( p.degree() );
+      for ( int i = p.degree(); i >= 0; --i )
+        MPolynomialCompiler<k-1, TRing, TAlloc>::compile( p[ i ], degrees, coefficients );
+    }
+  };
+
+  /**
+   * Specialization of MPolynomialCompiler for univariate polynomials,
+   * whose coefficients are stored contiguously.
+   */
+  template <typename TRing, typename TAlloc>
+  struct MPolynomialCompiler<1, TRing, TAlloc>
+  {
+    static void compile( const MPolynomial<1, TRing, TAlloc> & p,
+                         std::vector<int> & degrees,
+                         std::vector<TRing> & coefficients )
+    {
+      degrees.push_back( p.degree() );
+      for ( int i = p.degree(); i >= 0; --i )
+        coefficients.push_back( (const TRing &) p[ i ] );
+    }
+  };
+
+  /**
+   * Evaluates the flat Horner program of a polynomial with k
+   * indeterminates (used by CompiledMPolynomial only). The pointers
+   * on the degrees and coefficients are moved after the program.
+   */
+  template <int k, typename TRing>
+  struct CompiledMPolynomialEvaluator
+  {
+    static TRing eval( const int* & degree, const TRing* & coef,
+                       const TRing* x )
+    {
+      const int d = *degree++;
+      TRing r = TRing( 0 );
+      for ( int i = 0; i <= d; ++i )
+        r = r * x[ 0 ]
+          + CompiledMPolynomialEvaluator<k-1, TRing>::eval( degree, coef, x + 1 );
+      return r;
+    }
+
+    static void eval( std::size_t nb, std::size_t blockSize,
+                      const int* & degree, const TRing* & coef,
+                      const TRing* const* coordinates,
+                      TRing* values, TRing* tmp )
+    {
+      const int d = *degree++;
+      const TRing* x = coordinates[ 0 ];
+      for ( std::size_t j = 0; j < nb; ++j )
+        values[ j ] = TRing( 0 );
+      for ( int i = 0; i <= d; ++i )
+        {
+          CompiledMPolynomialEvaluator<k-1, TRing>
+            ::eval( nb, blockSize, degree, coef, coordinates + 1,
+                    tmp, tmp + blockSize );
+          for ( std::size_t j = 0; j < nb; ++j )
+            values[ j ] = values[ j ] * x[ j ] + tmp[ j ];
+        }
+    }
+  };
+
+  /**
+   * Specialization of CompiledMPolynomialEvaluator for univariate
+   * polynomials.
+   */
+  template <typename TRing>
+  struct CompiledMPolynomialEvaluator<1, TRing>
+  {
+    static TRing eval( const int* & degree, const TRing* & coef,
+                       const TRing* x )
+    {
+      const int d = *degree++;
+      TRing r = TRing( 0 );
+      for ( int i = 0; i <= d; ++i )
+        r = r * x[ 0 ] + *coef++;
+      return r;
+    }
+
+    static void eval( std::size_t nb, std::size_t,
+                      const int* & degree, const TRing* & coef,
+                      const TRing* const* coordinates,
+                      TRing* values, TRing* )
+    {
+      const int d = *degree++;
+      const TRing* x = coordinates[ 0 ];
+      for ( std::size_t j = 0; j < nb; ++j )
+        values[ j ] = TRing( 0 );
+      for ( int i = 0; i <= d; ++i )
+        {
+          const TRing c = *coef++;
+          for ( std::size_t j = 0; j < nb; ++j )
+            values[ j ] = values[ j ] * x[ j ] + c;
+        }
+    }
+  };
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class CompiledMPolynomial
+  /**
+   * Description of template class 'CompiledMPolynomial' <p> \brief
+   * Aim: A multivariate polynomial compiled into a flat Horner
+   * program, for fast evaluations at many points.
+   *
+   * An MPolynomial is a tree of std::vector of coefficients, which
+   * is walked through recursively (with temporary evaluator objects)
+   * at each evaluation. A CompiledMPolynomial stores the same nested
+   * Horner scheme in two contiguous arrays: the degrees of the nodes
+   * of the tree in depth-first order and the coefficients of the
+   * univariate polynomials of the last indeterminate, each from the
+   * highest degree to the lowest one. An evaluation is then a single
+   * forward pass on both arrays.
+   *
+   * The batch evaluation takes the points as a structure of arrays
+   * (one array per indeterminate) and runs the program once for
+   * blocks of points: the inner loops are simple loops on contiguous
+   * arrays, which the compiler can vectorize.
+   *
+   * @code
+   * MPolynomial<3,double> P = ...;
+   * CompiledMPolynomial<3,double> CP( P );
+   * double x[ 3 ] = { 0.5, 1.0, -2.0 };
+   * double v = CP.evaluate( x ); // same as P( 0.5 )( 1.0 )( -2.0 )
+   * CompiledMPolynomial<3,double> CPx( derivative<0>( P ) );
+   * @endcode
+   *
+   * @tparam n the number of indeterminates (at least 1).
+   * @tparam TRing the ring of coefficients.
+   * @tparam TAlloc the allocator of the original MPolynomial.
+   *
+   * @see MPolynomial, ImplicitPolynomial3Shape
+   */
+  template <int n, typename TRing, typename TAlloc = std::allocator<TRing> >
+  class CompiledMPolynomial
+  {
+    BOOST_STATIC_ASSERT(( n >= 1 ));
+
+    // ----------------------- Types ------------------------------
+  public:
+    typedef TRing Ring;
+    typedef MPolynomial<n, TRing, TAlloc> Polynomial;
+
+    /// Number of points evaluated together by the batch evaluation.
+    static const std::size_t BlockSize = 128;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Constructor. The compiled polynomial is the zero polynomial.
+     */
+    CompiledMPolynomial();
+
+    /**
+     * Constructor.
+     * @param p the polynomial to compile.
+     */
+    CompiledMPolynomial( const Polynomial & p );
+
+    /**
+     * Destructor.
+     */
+    ~CompiledMPolynomial();
+
+    /**
+     * Compiles the polynomial [p].
+     * @param p any polynomial.
+     */
+    void init( const Polynomial & p );
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * @param x the values of the n indeterminates.
+     * @return the value of the polynomial at [x].
+     */
+    Ring evaluate( const Ring* x ) const;
+
+    /**
+     * @param aPoint a point with n coordinates (accessed with operator[]).
+     * @return the value of the polynomial at [aPoint].
+     * @tparam TPoint a type of point, like a RealPoint.
+     */
+    template <typename TPoint>
+    Ring operator()( const TPoint & aPoint ) const;
+
+    /**
+     * Evaluates the polynomial at [nb] points given as a structure of
+     * arrays.
+     *
+     * @param nb the number of points.
+     * @param coordinates an array of n pointers, the k-th one points
+     * to the [nb] values of the k-th indeterminate.
+     * @param values (returns) an array of [nb] values, the values of
+     * the polynomial at the points.
+     */
+    void evaluate( std::size_t nb, const Ring* const* coordinates,
+                   Ring* values ) const;
+
+    /**
+     * @return the number of coefficients of the program (including
+     * the null ones in the middle of univariate polynomials).
+     */
+    std::size_t size() const;
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    /// Degrees of the nodes of the Horner scheme, in depth-first order.
+    std::vector<int> myDegrees;
+    /// Coefficients of the univariate polynomials of the last
+    /// indeterminate, from the highest degree to the lowest.
+    std::vector<Ring> myCoefficients;
+
+  }; // end of class CompiledMPolynomial
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'CompiledMPolynomial'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'CompiledMPolynomial' to write.
+   * @return the output stream after the writing.
+   */
+  template <int n, typename TRing, typename TAlloc>
+  std::ostream&
+  operator<< ( std::ostream & out, const CompiledMPolynomial<n,TRing,TAlloc> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/math/CompiledMPolynomial.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined CompiledMPolynomial_h
+
+#undef CompiledMPolynomial_RECURSES
+#endif // else defined(CompiledMPolynomial_RECURSES)
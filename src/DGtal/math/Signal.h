@@ -41,6 +41,7 @@
 //////////////////////////////////////////////////////////////////////////////
 // Inclusions
 #include <iostream>
+#include <vector>
 #include "DGtal/base/Common.h"
 #include "DGtal/base/CowPtr.h"
 //////////////////////////////////////////////////////////////////////////////
@@ -164,6 +165,21 @@ namespace DGtal
     
   public:
     typedef TValue Value;
+
+    /// The algorithms computing a convolution product.
+    enum ConvolutionMethod { 
+      /// DIRECT for short kernels or integer values, FFT otherwise.
+      AUTOMATIC, 
+      /// Sum of the products, in O(N.M) for a kernel of size M.
+      DIRECT, 
+      /// Product of the Fourier transforms, in O((N+M)log(N+M)).
+      FFT 
+    };
+
+    /// Kernel size from which AUTOMATIC uses the FFT (measured
+    /// crossing point with the DIRECT method).
+    static const unsigned int FFT_THRESHOLD = 256;
+
     /** 
         @return the gaussian signal of order 2 (binomial signal of
         order 2 / 4).
@@ -323,10 +339,33 @@ namespace DGtal
         @param G the second signal (not periodic)
         
         @return the signal that is the convolution of F and G, of type
-        F. The returned signal is periodic iff Fis periodic.
+        F. The returned signal is periodic iff F is periodic.
+
+        @see convolve
     */
     Signal<TValue> operator*( const Signal<TValue>& G );
 
+    /** 
+        Convolution product of two signals (F = this), as operator*,
+        with the chosen algorithm.
+
+        The DIRECT method sums the products in the same order as the
+        definition, hence gives exactly the same values, but in a
+        loop over contiguous values that the compiler vectorizes. The
+        FFT method computes the linear convolution of the (periodized
+        or padded) signal with the kernel by fast Fourier transform,
+        up to rounding errors. It is only used for floating-point
+        values; AUTOMATIC chooses it for kernels of at least
+        FFT_THRESHOLD values.
+
+        @param G the second signal (not periodic)
+        @param method the algorithm.
+        @return the signal that is the convolution of F and G, of type
+        F. The returned signal is periodic iff F is periodic.
+    */
+    Signal<TValue> convolve( const Signal<TValue>& G, 
+                             ConvolutionMethod method = AUTOMATIC ) const;
+
     // ----------------------- Interface --------------------------------------
   public:
 
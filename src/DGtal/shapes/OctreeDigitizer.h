@@ -0,0 +1,311 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file OctreeDigitizer.h
+ * @author Jacques-Olivier Lachaud (\c jacques-olivier.lachaud@univ-savoie.fr )
+ * Laboratory of Mathematics (CNRS, UMR 5807), University of Savoie, France
+ *
+ * @date 2026/10/19
+ *
+ * Header file for module OctreeDigitizer.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(OctreeDigitizer_RECURSES)
+#error Recursive header files inclusion detected in OctreeDigitizer.h
+#else // defined(OctreeDigitizer_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define OctreeDigitizer_RECURSES
+
+#if !defined OctreeDigitizer_h
+/** Prevents repeated inclusion of headers. */
+#define OctreeDigitizer_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/kernel/domains/HyperRectDomain.h"
+#include "DGtal/shapes/GaussDigitizer.h"
+#include "DGtal/shapes/Shapes.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /**
+   * Description of template class 'TrivialBlockBound' <p>
+   * \brief Aim: A block bound for OctreeDigitizer which never
+   * classifies a box, for shapes that only provide an orientation
+   * (e.g. StarShaped3D): all the points are then sampled.
+   *
+   * @tparam TSpace the digital space.
+   */
+  template <typename TSpace>
+  struct TrivialBlockBound
+  {
+    typedef typename TSpace::RealPoint RealPoint;
+
+    /**
+     * @return ON (the box is never classified).
+     */
+    Orientation operator()( const RealPoint &, const RealPoint & ) const
+    {
+      return ON;
+    }
+  };
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class OctreeDigitizer
+  /**
+   * Description of template class 'OctreeDigitizer' <p> \brief Aim:
+   * Computes the whole Gauss digitization of a Euclidean shape at
+   * once, by classifying blocks of digital points instead of
+   * evaluating the shape at each point.
+   *
+   * The domain of a GaussDigitizer is tiled by cubic tiles, which are
+   * recursively subdivided like an octree (a 2^n-tree). Each block is
+   * first given to a block bound, which may tell that the embedding of
+   * the block is entirely inside (all its points are then added) or
+   * entirely outside the shape (it is then skipped). Otherwise, the
+   * block is subdivided, and the points of the smallest blocks (the
+   * leaves) are sampled one by one, as GaussDigitizer::orientation
+   * would do, so that the shape is evaluated near its boundary only.
+   * The result is the same as a point by point digitization when
+   * the block bound is exact. A block bound computed in
+   * floating-point arithmetic, like MPolynomialBlockBound, contains
+   * the exact values of the shape function, so the result may only
+   * differ at points where the point by point evaluation gets the
+   * wrong sign because of its own rounding errors.
+   *
+   * When DGtal is built WITH_OPENMP, the tiles are processed
+   * concurrently: the shape and the block bound must then be usable
+   * concurrently (their methods are const).
+   *
+   * A block bound is a functor which, given the lower and upper
+   * points of a box of the Euclidean space, returns INSIDE if all the
+   * points of the box are inside the shape, OUTSIDE if none of them
+   * is inside, and ON otherwise. Models are TrivialBlockBound,
+   * LipschitzBlockBound and MPolynomialBlockBound.
+   *
+   * The digitization is made of spans (see Shapes), which may be
+   * inserted into a digital set or written into an image.
+   *
+   * @code
+   * typedef ImplicitPolynomial3Shape<Space> Shape;
+   * Shape shape( P );
+   * GaussDigitizer<Space,Shape> dig;
+   * dig.attach( shape );
+   * dig.init( RealPoint( -2, -2, -2 ), RealPoint( 2, 2, 2 ), 0.01 );
+   * MPolynomialBlockBound<Space> bound( P );
+   * OctreeDigitizer<Space,Shape,MPolynomialBlockBound<Space> > octree( dig, bound );
+   * DigitalSet set( dig.getDomain() );
+   * octree.digitize( set );
+   * @endcode
+   *
+   * @tparam TSpace the digital space.
+   * @tparam TEuclideanShape a model of CEuclideanOrientedShape.
+   * @tparam TBlockBound the type of block bound.
+   *
+   * @see GaussDigitizer, Shapes
+   */
+  template <typename TSpace, typename TEuclideanShape,
+            typename TBlockBound = TrivialBlockBound<TSpace> >
+  class OctreeDigitizer
+  {
+    // ----------------------- Types ------------------------------
+  public:
+    typedef TSpace Space;
+    typedef typename Space::Integer Integer;
+    typedef typename Space::Point Point;
+    typedef typename Space::RealPoint RealPoint;
+    typedef TEuclideanShape EuclideanShape;
+    typedef TBlockBound BlockBound;
+    typedef GaussDigitizer<Space, EuclideanShape> Digitizer;
+    typedef HyperRectDomain<Space> Domain;
+    typedef typename Shapes<Domain>::Span Span;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Constructor.
+     *
+     * @param aDigitizer an initialized Gauss digitizer (only
+     * referenced).
+     * @param aBound the block bound (copied).
+     * @param aLeafSize the maximal size of the blocks that are
+     * sampled point by point.
+     * @param aTileSize the size of the tiles, which are the blocks
+     * processed concurrently.
+     */
+    OctreeDigitizer( const Digitizer & aDigitizer,
+                     const BlockBound & aBound = BlockBound(),
+                     Integer aLeafSize = 4,
+                     Integer aTileSize = 64 );
+
+    /**
+     * Destructor.
+     */
+    ~OctreeDigitizer();
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Appends to [spans] the spans of the points of the domain of the
+     * digitizer whose embedding is inside the shape, in increasing
+     * order.
+     *
+     * @param spans (modified) the vector of spans.
+     */
+    void digitalSpans( std::vector<Span> & spans );
+
+    /**
+     * Adds to the (perhaps non empty) set [aSet] the points of the
+     * domain of the digitizer whose embedding is inside the shape.
+     *
+     * @param aSet the set (modified).
+     * @tparam TDigitalSet a model of CDigitalSet.
+     */
+    template <typename TDigitalSet>
+    void digitize( TDigitalSet & aSet );
+
+    /**
+     * Sets to [aValue] the value of the points of the domain of the
+     * digitizer whose embedding is inside the shape.
+     *
+     * @param anImage the image (modified), whose domain contains the
+     * domain of the digitizer.
+     * @param aValue the value of the inside points.
+     * @tparam TImage a model of CImage with a setValue method.
+     */
+    template <typename TImage>
+    void digitize( TImage & anImage, const typename TImage::Value & aValue );
+
+    /**
+     * @return the number of points classified as inside by blocks
+     * during the last digitization.
+     */
+    DGtal::uint64_t nbInsidePoints() const;
+
+    /**
+     * @return the number of points classified as outside by blocks
+     * during the last digitization.
+     */
+    DGtal::uint64_t nbOutsidePoints() const;
+
+    /**
+     * @return the number of points whose orientation was computed
+     * during the last digitization.
+     */
+    DGtal::uint64_t nbSampledPoints() const;
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    /// The Gauss digitizer.
+    const Digitizer* myDigitizer;
+    /// The block bound.
+    BlockBound myBound;
+    /// Maximal size of the sampled blocks.
+    Integer myLeafSize;
+    /// Size of the tiles.
+    Integer myTileSize;
+    /// Numbers of inside, outside and sampled points of the last
+    /// digitization.
+    DGtal::uint64_t myCounts[ 3 ];
+
+    // ------------------------- Hidden services ------------------------------
+  private:
+
+    /**
+     * Copy constructor.
+     * @param other the object to clone.
+     * Forbidden by default.
+     */
+    OctreeDigitizer ( const OctreeDigitizer & other );
+
+    /**
+     * Assignment.
+     * @param other the object to copy.
+     * @return a reference on 'this'.
+     * Forbidden by default.
+     */
+    OctreeDigitizer & operator= ( const OctreeDigitizer & other );
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+     * Classifies the block [aLow, anUp], subdivides it if necessary,
+     * and appends its inside spans to [spans].
+     *
+     * @param aLow the lower point of the block.
+     * @param anUp the upper point of the block.
+     * @param spans (modified) the spans of the inside points.
+     * @param counts (modified) the numbers of inside, outside and
+     * sampled points.
+     */
+    void processBlock( const Point & aLow, const Point & anUp,
+                       std::vector<Span> & spans,
+                       DGtal::uint64_t* counts ) const;
+
+  }; // end of class OctreeDigitizer
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'OctreeDigitizer'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'OctreeDigitizer' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TSpace, typename TEuclideanShape, typename TBlockBound>
+  std::ostream&
+  operator<< ( std::ostream & out,
+               const OctreeDigitizer<TSpace,TEuclideanShape,TBlockBound> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/shapes/OctreeDigitizer.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined OctreeDigitizer_h
+
+#undef OctreeDigitizer_RECURSES
+#endif // else defined(OctreeDigitizer_RECURSES)
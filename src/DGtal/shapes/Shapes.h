@@ -41,6 +41,8 @@
 //////////////////////////////////////////////////////////////////////////////
 // Inclusions
 #include <iostream>
+#include <vector>
+#include <utility>
 #include "DGtal/base/Common.h"
 #include "DGtal/kernel/NumberTraits.h"
 #include "DGtal/kernel/domains/CDomain.h"
@@ -65,6 +67,26 @@ namespace DGtal
    * class for constructing different shapes (balls, diamonds, and
    * others).
    *
+   * Shapes are digitized scanline by scanline: a scanline is a line
+   * of points parallel to the last axis, and the points of a
+   * scanline lying inside the shape are grouped into spans (maximal
+   * runs of consecutive points). Since points are ordered
+   * lexicographically with the first coordinate as the most
+   * significant one, spans are produced in increasing order and
+   * each of them is a contiguous range of a sorted set, so that
+   * whole spans are inserted at once into the target set. When
+   * DGtal is built WITH_OPENMP, the scanlines are processed
+   * concurrently.
+   *
+   * The spans of the balls are computed analytically (with integer
+   * arithmetic only). For convex shapes (i.e. shapes whose
+   * intersection with each scanline is an interval of points, like
+   * the digitization of a convex Euclidean shape), the ends of each
+   * span are found by exponential and binary search from a point of
+   * the previous span, so that the shape is evaluated only
+   * O(log(width)) times on a scanline that intersects it. Other
+   * shapes are evaluated at each point of their bounding box.
+   *
    * @tparam TDomain the type of the domain in which shapes are created.
    */
   template <typename TDomain>
@@ -86,9 +108,88 @@ namespace DGtal
     typedef typename Space::Integer Integer;
     typedef typename Space::UnsignedInteger UnsignedInteger;
 
+    /**
+     * A span is a run of consecutive points along the last axis,
+     * given by its first and last points (which differ only by their
+     * last coordinate).
+     */
+    typedef std::pair<Point,Point> Span;
+
     // ----------------------- Static services ------------------------------
   public:
 
+    /**
+     * Appends to [spans] the spans of the points of the bounding box
+     * of the shape [aFunctor] that are inside the shape. The spans
+     * are appended in increasing order. The shape is evaluated at
+     * each point of its bounding box.
+     *
+     * @param spans (modified) the vector of spans.
+     * @param aFunctor a functor defining the shape.
+     * @tparam TShapeFunctor a model of CDigitalBoundedShape and
+     * CDigitalOrientedShape, whose method orientation may be called
+     * concurrently.
+     */
+    template <typename TShapeFunctor>
+    static void digitalSpans( std::vector<Span> & spans,
+                              const TShapeFunctor & aFunctor );
+
+    /**
+     * Appends to [spans] the spans of the points of the bounding box
+     * of the shape [aFunctor] that are inside the shape. The spans
+     * are appended in increasing order. The intersection of the shape
+     * with each scanline is assumed to be an interval of points: the
+     * ends of the spans are found by exponential and binary search.
+     *
+     * @param spans (modified) the vector of spans.
+     * @param aFunctor a functor defining the shape.
+     * @tparam TShapeFunctor a model of CDigitalBoundedShape and
+     * CDigitalOrientedShape, whose method orientation may be called
+     * concurrently.
+     */
+    template <typename TShapeFunctor>
+    static void convexDigitalSpans( std::vector<Span> & spans,
+                                    const TShapeFunctor & aFunctor );
+
+    /**
+     * Adds all the points of the spans [spans] to the (perhaps non
+     * empty) set [aSet].
+     *
+     * @param aSet the set (modified).
+     * @param spans a vector of spans, in increasing order for a fast
+     * insertion.
+     * @tparam TDigitalSet a model of CDigitalSet.
+     */
+    template <typename TDigitalSet>
+    static void insertSpans( TDigitalSet & aSet,
+                             const std::vector<Span> & spans );
+
+    /**
+     * Removes all the points of the spans [spans] from the set [aSet].
+     *
+     * @param aSet the set (modified).
+     * @param spans a vector of spans.
+     * @tparam TDigitalSet a model of CDigitalSet.
+     */
+    template <typename TDigitalSet>
+    static void eraseSpans( TDigitalSet & aSet,
+                            const std::vector<Span> & spans );
+
+    /**
+     * Sets the value of all the points of the spans [spans] to
+     * [aValue] in the image [anImage].
+     *
+     * @param anImage the image (modified), whose domain contains the
+     * spans.
+     * @param spans a vector of spans.
+     * @param aValue the value to write.
+     * @tparam TImage a model of CImage with a setValue method.
+     */
+    template <typename TImage>
+    static void fillSpans( TImage & anImage,
+                           const std::vector<Span> & spans,
+                           const typename TImage::Value & aValue );
+
     /** 
      * Adds to the (perhaps non empty) set [aSet] an shape defined by
      * an instance of ShapeFunctor. The shape functor must be a model
@@ -123,6 +224,56 @@ namespace DGtal
     static void euclideanShaper( TDigitalSet & aSet,
                                  const TShapeFunctor & aFunctor,
                                  const double h = 1.0);
+
+    /** 
+     * Same as digitalShaper, but for a shape whose intersection with
+     * each scanline is an interval of points (see convexDigitalSpans).
+     * 
+     * @param aSet the set (modified) which will contain the shape.
+     * @param aFunctor a functor defining the shape.
+     * @tparam TDigitalSet a model of CDigitalSet.
+     * @tparam TShapeFunctor a model of CDigitalBoundedShape and
+     * CDigitalOrientedShape.
+     */
+    template <typename TDigitalSet, typename TShapeFunctor>
+    static void convexDigitalShaper( TDigitalSet & aSet,
+                                     const TShapeFunctor & aFunctor);
+
+    /** 
+     * Same as euclideanShaper, but for a convex Euclidean shape, whose
+     * Gauss digitization is digitized with convexDigitalShaper.
+     * 
+     * @param aSet the set (modified) which will contain the shape.
+     * @param aFunctor a functor defining the shape.
+     * @param h grid step for the Gauss digitization.
+     *
+     * @tparam TDigitalSet a model of CDigitalSet.
+     * @tparam TShapeFunctor a model of CEuclideanBoundedShape and
+     * CEuclideanOrientedShape.
+     */
+    template <typename TDigitalSet, typename TShapeFunctor>
+    static void convexEuclideanShaper( TDigitalSet & aSet,
+                                       const TShapeFunctor & aFunctor,
+                                       const double h = 1.0);
+
+    /**
+     * Appends to [spans] the spans of the discrete ball of center
+     * [aCenter] and radius [aRadius] (for the norm-1 if [norm1] is
+     * 'true', for the norm-2 otherwise) that are inside the domain
+     * [aDomain]. The spans are computed with integer arithmetic and
+     * appended in increasing order.
+     *
+     * @param spans (modified) the vector of spans.
+     * @param aDomain the domain clipping the ball.
+     * @param aCenter the center of the ball.
+     * @param aRadius the radius of the ball.
+     * @param norm1 'true' for the norm-1, 'false' for the norm-2.
+     */
+    static void ballSpans( std::vector<Span> & spans,
+                           const Domain & aDomain,
+                           const Point & aCenter,
+                           UnsignedInteger aRadius,
+                           bool norm1 );
     
     /**
      * Adds the discrete ball (norm-1) of center [aCenter] and radius
@@ -240,6 +391,93 @@ namespace DGtal
     // ------------------------- Internals ------------------------------------
   private:
 
+    /**
+     * Computes the spans of a shape functor on one scanline.
+     */
+    template <typename TShapeFunctor>
+    struct ShapeScanner
+    {
+      const TShapeFunctor & myShape;
+      bool myConvex;
+      ShapeScanner( const TShapeFunctor & aShape, bool convex )
+        : myShape( aShape ), myConvex( convex ) {}
+      void operator()( std::vector<Span> & spans,
+                       Point p, const Integer & hi ) const
+      {
+        Shapes<TDomain>::shapeScanlineSpans( spans, myShape, p, hi, myConvex );
+      }
+    };
+
+    /**
+     * Computes the spans of a discrete ball on one scanline.
+     */
+    struct BallScanner
+    {
+      const Point & myCenter;
+      Integer myRadius;
+      bool myNorm1;
+      BallScanner( const Point & aCenter, const Integer & aRadius, bool norm1 )
+        : myCenter( aCenter ), myRadius( aRadius ), myNorm1( norm1 ) {}
+      void operator()( std::vector<Span> & spans,
+                       Point p, const Integer & hi ) const
+      {
+        Shapes<TDomain>::ballScanlineSpans( spans, myCenter, myRadius, myNorm1,
+                                            p, hi );
+      }
+    };
+
+    /**
+     * Appends to [spans] the spans of all the scanlines of the box
+     * [aLower, aUpper], in increasing order. The scanlines are
+     * processed concurrently when WITH_OPENMP is defined.
+     *
+     * @param spans (modified) the vector of spans.
+     * @param aLower the lower point of the box.
+     * @param aUpper the upper point of the box.
+     * @param aScanner a functor computing the spans of one scanline,
+     * given its first point and the last coordinate of its last point.
+     * @tparam TScanner the type of the functor.
+     */
+    template <typename TScanner>
+    static void scanlineSpans( std::vector<Span> & spans,
+                               const Point & aLower, const Point & aUpper,
+                               const TScanner & aScanner );
+
+    /**
+     * Appends to [spans] the spans of the shape [aShape] on the
+     * scanline going from [p] to the point of last coordinate [hi].
+     *
+     * @param spans (modified) the vector of spans.
+     * @param aShape a functor defining the shape.
+     * @param p the first point of the scanline.
+     * @param hi the last coordinate of the last point of the scanline.
+     * @param convex when 'true', the intersection of the shape and the
+     * scanline is assumed to be an interval and is searched from the
+     * middle of the last span of [spans].
+     */
+    template <typename TShapeFunctor>
+    static void shapeScanlineSpans( std::vector<Span> & spans,
+                                    const TShapeFunctor & aShape,
+                                    Point p, const Integer & hi,
+                                    bool convex );
+
+    /**
+     * Appends to [spans] the span of a discrete ball on the scanline
+     * going from [p] to the point of last coordinate [hi].
+     *
+     * @param spans (modified) the vector of spans.
+     * @param aCenter the center of the ball.
+     * @param aRadius the radius of the ball.
+     * @param norm1 'true' for the norm-1, 'false' for the norm-2.
+     * @param p the first point of the scanline.
+     * @param hi the last coordinate of the last point of the scanline.
+     */
+    static void ballScanlineSpans( std::vector<Span> & spans,
+                                   const Point & aCenter,
+                                   const Integer & aRadius,
+                                   bool norm1,
+                                   Point p, const Integer & hi );
+
   }; // end of class Shapes
 
 
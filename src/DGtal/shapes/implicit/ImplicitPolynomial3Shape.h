@@ -46,6 +46,7 @@
 #include "DGtal/base/CPredicate.h"
 #include "DGtal/kernel/NumberTraits.h"
 #include "DGtal/math/MPolynomial.h"
+#include "DGtal/math/CompiledMPolynomial.h"
 #include "DGtal/shapes/implicit/CImplicitFunction.h"
 //////////////////////////////////////////////////////////////////////////////
 
@@ -75,6 +76,7 @@ namespace DGtal
     typedef typename RealPoint::Coordinate Ring;
     typedef typename Space::Integer Integer;
     typedef MPolynomial< 3, Ring > Polynomial3;
+    typedef CompiledMPolynomial< 3, Ring > CompiledPolynomial3;
     typedef Ring Value;
 
     BOOST_STATIC_ASSERT(( Space::dimension == 3 ));
@@ -137,6 +139,34 @@ namespace DGtal
     inline
     RealVector gradient( const RealPoint &aPoint ) const;
 
+    /**
+       Evaluates the polynomial at [nb] points given by the arrays of
+       their coordinates.
+
+       @param nb the number of points.
+       @param x the x-coordinates of the points.
+       @param y the y-coordinates of the points.
+       @param z the z-coordinates of the points.
+       @param values (returns) the values of the polynomial at the points.
+    */
+    void evaluate( std::size_t nb, const Ring* x, const Ring* y, const Ring* z,
+                   Ring* values ) const;
+
+    /**
+       Computes the gradient vectors at [nb] points given by the
+       arrays of their coordinates.
+
+       @param nb the number of points.
+       @param x the x-coordinates of the points.
+       @param y the y-coordinates of the points.
+       @param z the z-coordinates of the points.
+       @param gx (returns) the x-coordinates of the gradients.
+       @param gy (returns) the y-coordinates of the gradients.
+       @param gz (returns) the z-coordinates of the gradients.
+    */
+    void gradients( std::size_t nb, const Ring* x, const Ring* y, const Ring* z,
+                    Ring* gx, Ring* gy, Ring* gz ) const;
+
 // ------------------------------------------------------------ Added by Anis Benyoub
 
     /**
@@ -205,28 +235,27 @@ namespace DGtal
   private:
     /// The 3-polynomial defining the implicit shape.
     Polynomial3 myPolynomial;
+    /// Its compiled form, used for evaluations.
+    CompiledPolynomial3 myCompiledPolynomial;
 
-    // Partial deriatives
-    Polynomial3 myFx;
-    Polynomial3 myFy;
-    Polynomial3 myFz;
+    // Partial deriatives (compiled)
+    CompiledPolynomial3 myFx;
+    CompiledPolynomial3 myFy;
+    CompiledPolynomial3 myFz;
 
-    Polynomial3 myFxx;
-    Polynomial3 myFxy;
-    Polynomial3 myFxz;
+    CompiledPolynomial3 myFxx;
+    CompiledPolynomial3 myFxy;
+    CompiledPolynomial3 myFxz;
 
-    Polynomial3 myFyx;
-    Polynomial3 myFyy;
-    Polynomial3 myFyz;
+    CompiledPolynomial3 myFyy;
+    CompiledPolynomial3 myFyz;
 
-    Polynomial3 myFzx;
-    Polynomial3 myFzy;
-    Polynomial3 myFzz;
+    CompiledPolynomial3 myFzz;
 
 
-    // Precomputed Polynoms useful for curvature computations
-    Polynomial3 myUpPolynome;
-    Polynomial3 myLowPolynome;
+    // Precomputed Polynoms useful for curvature computations (compiled)
+    CompiledPolynomial3 myUpPolynome;
+    CompiledPolynomial3 myLowPolynome;
 
 
     // ------------------------- Hidden services ------------------------------
@@ -0,0 +1,157 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file LipschitzBlockBound.h
+ * @author Jacques-Olivier Lachaud (\c jacques-olivier.lachaud@univ-savoie.fr )
+ * Laboratory of Mathematics (CNRS, UMR 5807), University of Savoie, France
+ *
+ * @date 2026/10/19
+ *
+ * Header file for module LipschitzBlockBound.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(LipschitzBlockBound_RECURSES)
+#error Recursive header files inclusion detected in LipschitzBlockBound.h
+#else // defined(LipschitzBlockBound_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define LipschitzBlockBound_RECURSES
+
+#if !defined LipschitzBlockBound_h
+/** Prevents repeated inclusion of headers. */
+#define LipschitzBlockBound_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include "DGtal/base/Common.h"
+#include "DGtal/shapes/implicit/CImplicitFunction.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class LipschitzBlockBound
+  /**
+   * Description of template class 'LipschitzBlockBound' <p>
+   * \brief Aim: Classifies whole boxes of the Euclidean space with
+   * respect to an implicit function f, which is positive inside the
+   * shape, knowing a Lipschitz constant L of f (i.e. |f(x)-f(y)| <=
+   * L |x-y| for all x, y).
+   *
+   * If c is the center of a box and r its half diagonal, f is
+   * positive on the whole box when f(c) > L r and is non positive on
+   * the whole box when f(c) <= -L r. A single evaluation of f thus
+   * decides for the whole box when it is far enough from the zero
+   * level set of f.
+   *
+   * It is a block bound for OctreeDigitizer. For instance, an
+   * ImplicitBall is 1-Lipschitz.
+   *
+   * @tparam TImplicitFunction a model of CImplicitFunction.
+   *
+   * @see OctreeDigitizer, MPolynomialBlockBound
+   */
+  template <typename TImplicitFunction>
+  class LipschitzBlockBound
+  {
+    BOOST_CONCEPT_ASSERT(( CImplicitFunction<TImplicitFunction> ));
+
+    // ----------------------- Types ------------------------------
+  public:
+    typedef TImplicitFunction ImplicitFunction;
+    typedef typename ImplicitFunction::RealPoint RealPoint;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Constructor.
+     * @param aFunction the implicit function (only referenced).
+     * @param aLipschitzConstant a Lipschitz constant of the function.
+     */
+    LipschitzBlockBound( const ImplicitFunction & aFunction,
+                         double aLipschitzConstant );
+
+    /**
+     * Destructor.
+     */
+    ~LipschitzBlockBound();
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * @param aLow the lower point of a box.
+     * @param anUp the upper point of the box.
+     * @return INSIDE if the function is positive on the whole box,
+     * OUTSIDE if it is non positive on the whole box, ON otherwise.
+     */
+    Orientation operator()( const RealPoint & aLow,
+                            const RealPoint & anUp ) const;
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    /// The implicit function.
+    const ImplicitFunction* myFunction;
+    /// Its Lipschitz constant.
+    double myLipschitzConstant;
+
+  }; // end of class LipschitzBlockBound
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'LipschitzBlockBound'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'LipschitzBlockBound' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TImplicitFunction>
+  std::ostream&
+  operator<< ( std::ostream & out, const LipschitzBlockBound<TImplicitFunction> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/shapes/implicit/LipschitzBlockBound.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined LipschitzBlockBound_h
+
+#undef LipschitzBlockBound_RECURSES
+#endif // else defined(LipschitzBlockBound_RECURSES)
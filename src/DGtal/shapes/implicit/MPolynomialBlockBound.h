@@ -0,0 +1,271 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file MPolynomialBlockBound.h
+ * @author Jacques-Olivier Lachaud (\c jacques-olivier.lachaud@univ-savoie.fr )
+ * Laboratory of Mathematics (CNRS, UMR 5807), University of Savoie, France
+ *
+ * @date 2026/10/19
+ *
+ * Header file for module MPolynomialBlockBound.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(MPolynomialBlockBound_RECURSES)
+#error Recursive header files inclusion detected in MPolynomialBlockBound.h
+#else // defined(MPolynomialBlockBound_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define MPolynomialBlockBound_RECURSES
+
+#if !defined MPolynomialBlockBound_h
+/** Prevents repeated inclusion of headers. */
+#define MPolynomialBlockBound_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include "DGtal/base/Common.h"
+#include "DGtal/math/MPolynomial.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /**
+   * Description of template class 'IntervalRounding' <p>
+   * \brief Aim: Rounds the bounds of an interval outward, so that
+   * an interval computed in floating-point arithmetic contains the
+   * exact result. Exact rings need no rounding.
+   *
+   * @tparam TRing the ring of the bounds.
+   */
+  template <typename TRing>
+  struct IntervalRounding
+  {
+    static TRing down( const TRing & x ) { return x; }
+    static TRing up( const TRing & x ) { return x; }
+  };
+
+  /**
+   * Specialization of IntervalRounding for float: one ulp outward.
+   */
+  template <>
+  struct IntervalRounding<float>
+  {
+    static float down( float x )
+    { return ::nextafterf( x, -std::numeric_limits<float>::infinity() ); }
+    static float up( float x )
+    { return ::nextafterf( x, std::numeric_limits<float>::infinity() ); }
+  };
+
+  /**
+   * Specialization of IntervalRounding for double: one ulp outward.
+   */
+  template <>
+  struct IntervalRounding<double>
+  {
+    static double down( double x )
+    { return ::nextafter( x, -std::numeric_limits<double>::infinity() ); }
+    static double up( double x )
+    { return ::nextafter( x, std::numeric_limits<double>::infinity() ); }
+  };
+
+  /**
+   * Specialization of IntervalRounding for long double: one ulp outward.
+   */
+  template <>
+  struct IntervalRounding<long double>
+  {
+    static long double down( long double x )
+    { return ::nextafterl( x, -std::numeric_limits<long double>::infinity() ); }
+    static long double up( long double x )
+    { return ::nextafterl( x, std::numeric_limits<long double>::infinity() ); }
+  };
+
+  /**
+   * Description of template class 'MPolynomialIntervalEvaluator' <p>
+   * \brief Aim: Computes an interval containing all the values of a
+   * multivariate polynomial on a box, with the Horner scheme in
+   * interval arithmetic. The bounds are rounded outward after each
+   * operation (see IntervalRounding).
+   *
+   * @tparam n the number of indeterminates.
+   * @tparam TRing the ring of coefficients.
+   * @tparam TAlloc the allocator of the polynomial.
+   */
+  template <int n, typename TRing, typename TAlloc>
+  struct MPolynomialIntervalEvaluator
+  {
+    typedef MPolynomial<n, TRing, TAlloc> Polynomial;
+
+    /**
+     * @param p any polynomial.
+     * @param lo the lower bounds of the n indeterminates.
+     * @param hi the upper bounds of the n indeterminates.
+     * @param rlo (returns) a lower bound of p on the box.
+     * @param rhi (returns) an upper bound of p on the box.
+     */
+    static void eval( const Polynomial & p,
+                      const TRing* lo, const TRing* hi,
+                      TRing & rlo, TRing & rhi )
+    {
+      typedef IntervalRounding<TRing> Rounding;
+      rlo = rhi = TRing( 0 );
+      for ( int i = p.degree(); i >= 0; --i )
+        {
+          if ( i != p.degree() )
+            { // [rlo,rhi] *= [lo[0],hi[0]]
+              TRing a = rlo * lo[ 0 ], b = rlo * hi[ 0 ];
+              TRing c = rhi * lo[ 0 ], d = rhi * hi[ 0 ];
+              rlo = Rounding::down( std::min( std::min( a, b ), std::min( c, d ) ) );
+              rhi = Rounding::up( std::max( std::max( a, b ), std::max( c, d ) ) );
+            }
+          TRing clo, chi;
+          MPolynomialIntervalEvaluator<n-1, TRing, TAlloc>
+            ::eval( p[ i ], lo + 1, hi + 1, clo, chi );
+          rlo = Rounding::down( rlo + clo );
+          rhi = Rounding::up( rhi + chi );
+        }
+    }
+  };
+
+  /**
+   * Specialization of MPolynomialIntervalEvaluator for constant
+   * polynomials.
+   */
+  template <typename TRing, typename TAlloc>
+  struct MPolynomialIntervalEvaluator<0, TRing, TAlloc>
+  {
+    typedef MPolynomial<0, TRing, TAlloc> Polynomial;
+
+    static void eval( const Polynomial & p,
+                      const TRing*, const TRing*,
+                      TRing & rlo, TRing & rhi )
+    {
+      rlo = rhi = (const TRing &) p;
+    }
+  };
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class MPolynomialBlockBound
+  /**
+   * Description of template class 'MPolynomialBlockBound' <p>
+   * \brief Aim: Classifies whole boxes of the Euclidean space with
+   * respect to a polynomial implicit function P, which is positive
+   * inside the shape (like ImplicitPolynomial3Shape), by interval
+   * arithmetic.
+   *
+   * An interval containing P(box) is computed with the Horner scheme
+   * on intervals, whose bounds are rounded outward by one ulp after
+   * each operation. It is not tight but it always contains the exact
+   * values of P on the box, and it gets tighter as the boxes get
+   * smaller.
+   *
+   * It is a block bound for OctreeDigitizer.
+   *
+   * @tparam TSpace the digital space, whose dimension is the number of
+   * indeterminates of the polynomial.
+   *
+   * @see OctreeDigitizer, LipschitzBlockBound
+   */
+  template <typename TSpace>
+  class MPolynomialBlockBound
+  {
+    // ----------------------- Types ------------------------------
+  public:
+    typedef TSpace Space;
+    typedef typename Space::RealPoint RealPoint;
+    typedef typename RealPoint::Coordinate Ring;
+    typedef MPolynomial< Space::dimension, Ring > Polynomial;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Constructor.
+     * @param aPolynomial the polynomial (copied).
+     */
+    MPolynomialBlockBound( const Polynomial & aPolynomial );
+
+    /**
+     * Destructor.
+     */
+    ~MPolynomialBlockBound();
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * @param aLow the lower point of a box.
+     * @param anUp the upper point of the box.
+     * @return INSIDE if the polynomial is positive on the whole box,
+     * OUTSIDE if it is non positive on the whole box, ON otherwise.
+     */
+    Orientation operator()( const RealPoint & aLow,
+                            const RealPoint & anUp ) const;
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    /// The polynomial.
+    Polynomial myPolynomial;
+
+  }; // end of class MPolynomialBlockBound
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'MPolynomialBlockBound'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'MPolynomialBlockBound' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TSpace>
+  std::ostream&
+  operator<< ( std::ostream & out, const MPolynomialBlockBound<TSpace> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/shapes/implicit/MPolynomialBlockBound.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined MPolynomialBlockBound_h
+
+#undef MPolynomialBlockBound_RECURSES
+#endif // else defined(MPolynomialBlockBound_RECURSES)
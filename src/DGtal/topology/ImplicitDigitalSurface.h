@@ -47,6 +47,7 @@
 #include "DGtal/topology/Topology.h"
 #include "DGtal/topology/SurfelAdjacency.h"
 #include "DGtal/topology/SurfelNeighborhood.h"
+#include "DGtal/topology/helpers/Surfaces.h"
 //////////////////////////////////////////////////////////////////////////////
 
 namespace DGtal
@@ -178,6 +179,8 @@ namespace DGtal
     typedef typename KSpace::SCell SCell;
     typedef typename KSpace::CellSet CellSet;
     typedef typename KSpace::SCellSet SCellSet;
+    /// Durations of the phases of the extraction of the surfels.
+    typedef typename Surfaces<KSpace>::TrackingTimings TrackingTimings;
 
     // ----------------------- Standard services ------------------------------
   public:
@@ -210,9 +213,14 @@ namespace DGtal
        @param closed when 'true', the surface is known to be closed,
        hence faster extraction can be performed, default is 'false'.
 
+       @param timings when not 0, (modified) the durations of the
+       phases of the extraction.
+
        NB: O(N) computational complexity operation, where N is the
        number of surfels of the surface. This is due to the fact that,
-       at construction, the surface is extracted and stored.
+       at construction, the surface is extracted and stored (in
+       parallel when OpenMP is enabled, see
+       Surfaces::parallelTrackBoundary).
 
        @see computeSurfels
       */
@@ -220,7 +228,8 @@ namespace DGtal
                             const PointPredicate & aPP,
                             const Adjacency & adj,
                             const Surfel & s,
-                            bool closed = false );
+                            bool closed = false,
+                            TrackingTimings* timings = 0 );
 
     /// accessor to surfel adjacency.
     const Adjacency & surfelAdjacency() const;
@@ -308,9 +317,12 @@ namespace DGtal
        @param closed when 'true', the surface is known to be closed,
        hence faster extraction can be performed.
 
+       @param timings when not 0, (modified) the durations of the
+       phases of the extraction.
     */
     void computeSurfels( const Surfel & p,
-                         bool closed );
+                         bool closed,
+                         TrackingTimings* timings = 0 );
 
 
   private:
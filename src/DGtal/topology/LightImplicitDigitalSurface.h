@@ -47,6 +47,7 @@
 #include "DGtal/topology/Topology.h"
 #include "DGtal/topology/SurfelAdjacency.h"
 #include "DGtal/topology/SurfelNeighborhood.h"
+#include "DGtal/topology/helpers/Surfaces.h"
 #include "DGtal/topology/BreadthFirstVisitor.h"
 //////////////////////////////////////////////////////////////////////////////
 
@@ -177,6 +178,8 @@ namespace DGtal
     typedef typename KSpace::SCell SCell;
     typedef typename KSpace::CellSet CellSet;
     typedef typename KSpace::SCellSet SCellSet;
+    /// Durations of the phases of the extraction of the surfels.
+    typedef typename Surfaces<KSpace>::TrackingTimings TrackingTimings;
 
 
     // ----------------- UndirectedSimplePreGraph types ------------------
@@ -332,6 +335,24 @@ namespace DGtal
     // ----------------------- Interface --------------------------------------
   public:
 
+    /**
+       Extracts at once all the surfels of this digital surface, in
+       parallel when OpenMP is enabled (see
+       Surfaces::parallelTrackBoundary). This is much faster than
+       visiting the surface through begin() and end(), where the
+       neighbors of each surfel are computed one after the other.
+
+       @tparam TSCellSet a model of a set of SCell (e.g., SCellSet).
+
+       @param surface (modified) the set of all the surfels of the surface.
+
+       @param timings when not 0, (modified) the durations of the
+       phases of the extraction.
+    */
+    template <typename TSCellSet>
+    void computeSurfels( TSCellSet & surface,
+                         TrackingTimings* timings = 0 ) const;
+
     /**
      * Writes/Displays the object on an output stream.
      * @param out the output stream where the object is written.
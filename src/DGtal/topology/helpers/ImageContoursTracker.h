@@ -0,0 +1,494 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file ImageContoursTracker.h
+ * @author Jacques-Olivier Lachaud (\c jacques-olivier.lachaud@univ-savoie.fr )
+ * Laboratory of Mathematics (CNRS, UMR 5807), University of Savoie, France
+ *
+ * @date 2026/10/19
+ *
+ * Header file for module ImageContoursTracker.ih
+ *
+ * This file is part of the DGtal library.
+ *
+ * @see testImageContoursTracker.cpp
+ */
+
+#if defined(ImageContoursTracker_RECURSES)
+#error Recursive header files inclusion detected in ImageContoursTracker.h
+#else // defined(ImageContoursTracker_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define ImageContoursTracker_RECURSES
+
+#if !defined ImageContoursTracker_h
+/** Prevents repeated inclusion of headers. */
+#define ImageContoursTracker_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/images/CConstImage.h"
+#include "DGtal/topology/SurfelAdjacency.h"
+#include "DGtal/topology/SurfelNeighborhood.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class ImageContoursTracker
+  /**
+     Description of template class 'ImageContoursTracker' <p> \brief
+     Aim: extracts all the 2D contours of the regions of a labelled
+     image in a single raster scan, and streams each contour to a
+     visitor (or directly into the storage of a curve like GridCurve)
+     without building intermediate vectors of surfels.
+
+     A region is a connected set of pixels having the same value (its
+     label), connectedness being given by the surfel adjacency. The
+     image is scanned row by row. Whenever a vertical linel separates
+     a pixel of some label from a pixel of another label (or from the
+     outside of the domain) and this linel has not been visited yet
+     by the contour of the region of this pixel, the contour is
+     tracked from it in the direct orientation. Each vertical linel
+     is marked twice at most (once for the region on its left, once
+     for the region on its right), so that the whole extraction is
+     linear in the number of pixels plus the total length of the
+     contours. Contrary to Surfaces::extractAll2DSCellContours, no
+     set of boundary surfels nor random tries are needed.
+
+     The contours are sent to a visitor, which must provide the
+     following methods:
+     @code
+     void beginContour( const Value & label );
+     void addSurfel( const SCell & surfel );
+     void endContour();
+     @endcode
+
+     The method extractCurves() fills directly a vector of curves
+     (e.g. GridCurve), using their method pushBack. When DGtal is
+     built WITH_OPENMP, the first surfel of each contour is found by
+     findContours(), which does not track the contours, then each
+     contour is tracked once and written into its curve concurrently.
+
+     @tparam TKSpace the type of cellular grid space, of dimension 2
+     (e.g. a KhalimskySpaceND<2>).
+
+     @tparam TImage the type of the labelled image, a model of
+     CConstImage (e.g. an ImageContainerBySTLVector).
+
+     @code
+     KSpace K;
+     K.init( image.domain().lowerBound() - Point::diagonal(1),
+             image.domain().upperBound() + Point::diagonal(1), true );
+     ImageContoursTracker<KSpace,Image> tracker( K, image, SurfelAdjacency<2>( true ) );
+     tracker.setBackground( 0 );
+     std::vector< GridCurve<KSpace> > curves;
+     std::vector< Image::Value > labels;
+     tracker.extractCurves( curves, labels );
+     @endcode
+   */
+  template <typename TKSpace, typename TImage>
+  class ImageContoursTracker
+  {
+    BOOST_CONCEPT_ASSERT(( CConstImage<TImage> ));
+
+    // ----------------------- Types ------------------------------
+  public:
+    typedef TKSpace KSpace;
+    typedef TImage Image;
+    typedef typename KSpace::Integer Integer;
+    typedef typename KSpace::Point Point;
+    typedef typename KSpace::SCell SCell;
+    typedef typename Image::Value Value;
+    typedef typename Image::Domain Domain;
+
+    BOOST_STATIC_ASSERT(( KSpace::dimension == 2 ));
+
+    /**
+       Characteristic function of one region of the image: true for
+       the points of the domain having the given label.
+    */
+    struct LabelPredicate
+    {
+      typedef typename ImageContoursTracker::Point Point;
+
+      /**
+         Constructor.
+         @param anImage the labelled image.
+         @param aLabel the label of the region.
+      */
+      LabelPredicate( const Image & anImage, const Value & aLabel )
+        : myImage( &anImage ), myLabel( aLabel )
+      {}
+
+      /**
+         @param p any point.
+         @return 'true' iff p is in the domain and has the label.
+      */
+      bool operator()( const Point & p ) const
+      {
+        return myImage->domain().isInside( p )
+          && ( (*myImage)( p ) == myLabel );
+      }
+
+      /// The labelled image.
+      const Image* myImage;
+      /// The label of the region.
+      Value myLabel;
+    };
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+       Constructor.
+
+       @param K a space of dimension 2 whose bounds strictly contain
+       the domain of the image (i.e. with a margin of one pixel), so
+       that every contour is closed.
+
+       @param anImage the labelled image (only aliased).
+
+       @param aSurfelAdj the surfel adjacency chosen for the tracking
+       (interior to exterior for 4-connected regions).
+    */
+    ImageContoursTracker( const KSpace & K, const Image & anImage,
+                          const SurfelAdjacency<2> & aSurfelAdj );
+
+    /**
+     * Destructor.
+     */
+    ~ImageContoursTracker();
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+       The regions having the label @a aLabel are not tracked
+       (their contours are nevertheless tracked as contours of the
+       neighboring regions).
+
+       @param aLabel the label of the background.
+    */
+    void setBackground( const Value & aLabel );
+
+    /**
+       Every region is tracked (default).
+    */
+    void unsetBackground();
+
+    /**
+       Scans the image once and sends every contour to the visitor as
+       soon as it is found. The contours are given in the raster order
+       of their first vertical linel.
+
+       @tparam ContourVisitor the type of visitor (see class
+       description).
+
+       @param visitor (modified) the visitor receiving the contours.
+
+       @return the number of contours.
+    */
+    template <typename ContourVisitor>
+    unsigned int extract( ContourVisitor & visitor ) const;
+
+    /**
+       Scans the image and returns the first surfel of every contour,
+       together with the label of the tracked region, in the same
+       order as extract(). The contours are not tracked: each vertical
+       bel is only linked to the next vertical bel of its contour (the
+       rows are processed concurrently WITH_OPENMP), and the first
+       vertical bel of each cycle of links in raster order is its
+       start. The contours may then be tracked independently by
+       track().
+
+       @param labels (returns) the label of each contour.
+       @param starts (returns) the first surfel of each contour.
+    */
+    void findContours( std::vector<Value> & labels,
+                       std::vector<SCell> & starts ) const;
+
+    /**
+       Links each vertical bel of the rows [row0,row1] to the next
+       vertical bel of its contour (see nextVerticalBel), without
+       tracking the whole contours. Distinct rows may be linked
+       concurrently.
+
+       @param row0 the first row.
+       @param row1 the last row.
+       @param next (modified) for each vertical bel index of the image
+       (see nextVerticalBel), the index of the next vertical bel, or
+       left untouched if it is not a bel of a tracked region.
+    */
+    void linkVerticalBels( Integer row0, Integer row1,
+                           std::vector<std::size_t> & next ) const;
+
+    /**
+       @param s the index of a vertical bel (see nextVerticalBel).
+       @param label (returns) the label of its inner pixel.
+       @return the vertical bel.
+    */
+    SCell verticalBel( std::size_t s, Value & label ) const;
+
+    /**
+       Follows a contour from a vertical bel up to the next vertical
+       bel.
+
+       @param aLabel the label of the tracked region.
+       @param aStart a vertical bel of the contour, whose inner pixel
+       has the label @a aLabel.
+       @return the index of the next vertical bel, i.e. twice the
+       index of its linel, plus one if the region lies on its right
+       (the linel between the pixels (x-1,y) and (x,y) has the index
+       (y-ymin)*(width+1)+(x-xmin), as in scan()).
+    */
+    std::size_t nextVerticalBel( const Value & aLabel,
+                                 const SCell & aStart ) const;
+
+    /**
+       Tracks one contour in the direct orientation and sends its
+       surfels to the visitor.
+
+       @tparam ContourVisitor the type of visitor (see class
+       description).
+
+       @param visitor (modified) the visitor receiving the contour.
+       @param aLabel the label of the tracked region.
+       @param aStart a surfel of the contour, whose inner pixel has
+       the label @a aLabel.
+
+       @return the number of surfels of the contour.
+    */
+    template <typename ContourVisitor>
+    unsigned int track( ContourVisitor & visitor,
+                        const Value & aLabel,
+                        const SCell & aStart ) const;
+
+    /**
+       Tracks one contour in the direct orientation and pushes its
+       surfels into the curve.
+
+       @tparam TCurve a curve with a method pushBack( const SCell & ),
+       like GridCurve.
+
+       @param curve (modified) the curve receiving the surfels.
+       @param aLabel the label of the tracked region.
+       @param aStart a surfel of the contour, whose inner pixel has
+       the label @a aLabel.
+
+       @return the number of surfels of the contour.
+    */
+    template <typename TCurve>
+    unsigned int trackCurve( TCurve & curve,
+                             const Value & aLabel,
+                             const SCell & aStart ) const;
+
+    /**
+       Extracts every contour into its own curve, whose surfels are
+       directly pushed into its storage. When WITH_OPENMP is defined,
+       the contours are tracked concurrently.
+
+       @tparam TCurves a container of curves (std::vector, or better
+       std::deque which never copies the curves when it grows) with
+       methods push_back, back and operator[]. The curves must be
+       constructible from a KSpace and have a method pushBack( const
+       SCell & ), like GridCurve.
+
+       @param curves (returns) the contours (the space K is aliased
+       by each curve).
+       @param labels (returns) the label of each contour.
+
+       @return the number of contours.
+    */
+    template <typename TCurves>
+    unsigned int extractCurves( TCurves & curves,
+                                std::vector<Value> & labels ) const;
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    /// The cellular space.
+    const KSpace* myKPtr;
+    /// The labelled image.
+    const Image* myImage;
+    /// The surfel adjacency.
+    SurfelAdjacency<2> mySurfelAdj;
+    /// The background label (if myHasBackground).
+    Value myBackground;
+    /// 'true' if the regions of label myBackground are not tracked.
+    bool myHasBackground;
+    /// Lower bound of the domain.
+    Point myLower;
+    /// Upper bound of the domain.
+    Point myUpper;
+    /// Number of vertical linels in a row (width + 1).
+    std::size_t myRowSize;
+
+    // ------------------------- Hidden services ------------------------------
+  protected:
+
+    /**
+     * Constructor.
+     * Forbidden by default (protected to avoid g++ warnings).
+     */
+    ImageContoursTracker();
+
+  private:
+
+    /**
+     * Copy constructor.
+     * @param other the object to clone.
+     * Forbidden by default.
+     */
+    ImageContoursTracker ( const ImageContoursTracker & other );
+
+    /**
+     * Assignment.
+     * @param other the object to copy.
+     * @return a reference on 'this'.
+     * Forbidden by default.
+     */
+    ImageContoursTracker & operator= ( const ImageContoursTracker & other );
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+       Visitor pushing the surfels into a given curve.
+    */
+    template <typename TCurve>
+    struct CurveVisitor
+    {
+      CurveVisitor( TCurve & aCurve ) : myCurve( &aCurve ) {}
+      void beginContour( const Value & ) {}
+      void addSurfel( const SCell & s ) { myCurve->pushBack( s ); }
+      void endContour() {}
+      TCurve* myCurve;
+    };
+
+    /**
+       Visitor appending a new curve for each contour.
+    */
+    template <typename TCurves>
+    struct CurvesVisitor
+    {
+      typedef typename TCurves::value_type Curve;
+      CurvesVisitor( const KSpace & K, TCurves & curves )
+        : myKPtr( &K ), myCurves( &curves ) {}
+      void beginContour( const Value & )
+      {
+        myCurves->push_back( Curve( *myKPtr ) );
+      }
+      void addSurfel( const SCell & s ) { myCurves->back().pushBack( s ); }
+      void endContour() {}
+      const KSpace* myKPtr;
+      TCurves* myCurves;
+    };
+
+    /**
+       Scans the image, tracks every contour that has not been marked
+       yet and reports it to the visitor.
+
+       @param visitor (modified) the visitor receiving the contours.
+       @param labels (returns) the label of each contour.
+       @param starts (returns) the first surfel of each contour.
+       @return the number of contours.
+    */
+    template <typename ContourVisitor>
+    unsigned int scan( ContourVisitor & visitor,
+                       std::vector<Value> & labels,
+                       std::vector<SCell> & starts ) const;
+
+    /**
+       Tracks one contour, reports its surfels to the visitor and
+       marks its vertical linels.
+
+       @param visitor (modified) the visitor receiving the contour.
+       @param aLabel the label of the tracked region.
+       @param aStart the first surfel of the contour.
+       @param leftMarks (modified) for each vertical linel, 1 if it
+       has been visited by the contour of the region on its left, or
+       0 if no marking is required.
+       @param rightMarks (modified) the same for the region on the
+       right of each vertical linel.
+       @return the number of surfels of the contour.
+    */
+    template <typename ContourVisitor>
+    unsigned int trackAndMark( ContourVisitor & visitor,
+                               const Value & aLabel,
+                               const SCell & aStart,
+                               std::vector<char>* leftMarks,
+                               std::vector<char>* rightMarks ) const;
+
+    /**
+       @param p a pixel.
+       @param label (returns) its label, if it is in the domain.
+       @return 'true' if p is in the domain.
+    */
+    bool labelOf( const Point & p, Value & label ) const;
+
+    /**
+       @param label any label.
+       @return 'true' if the regions of this label must be tracked.
+    */
+    bool isTracked( const Value & label ) const;
+
+  }; // end of class ImageContoursTracker
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'ImageContoursTracker'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'ImageContoursTracker' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TKSpace, typename TImage>
+  std::ostream&
+  operator<< ( std::ostream & out,
+               const ImageContoursTracker<TKSpace, TImage> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/topology/helpers/ImageContoursTracker.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined ImageContoursTracker_h
+
+#undef ImageContoursTracker_RECURSES
+#endif // else defined(ImageContoursTracker_RECURSES)
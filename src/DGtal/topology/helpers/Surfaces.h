@@ -86,6 +86,38 @@ namespace DGtal
     typedef typename KSpace::SCell SCell;
     typedef typename KSpace::DirIterator DirIterator;
 
+    /**
+       Durations (in ms) of the phases of parallelTrackBoundary, and
+       size of the breadth-first traversal.
+    */
+    struct TrackingTimings
+    {
+      /// the number of levels (fronts) of the breadth-first traversal.
+      unsigned int nbLevels;
+      /// the number of surfels found as neighbors of some front.
+      unsigned int nbCandidates;
+      /// wall time (ms) spent in computing the neighbors of the fronts.
+      double neighbors;
+      /// wall time (ms) spent in merging the neighbors into the surface.
+      double merge;
+
+      TrackingTimings()
+        : nbLevels( 0 ), nbCandidates( 0 ), neighbors( 0.0 ), merge( 0.0 )
+      {}
+
+      /**
+       * Writes/Displays the object on an output stream.
+       * @param out the output stream where the object is written.
+       */
+      void selfDisplay( std::ostream & out ) const
+      {
+        out << "[TrackingTimings levels=" << nbLevels
+            << " candidates=" << nbCandidates
+            << " neighbors=" << neighbors << "ms"
+            << " merge=" << merge << "ms]";
+      }
+    };
+
     // ----------------------- Static services ------------------------------
   public:
 
@@ -225,6 +257,52 @@ namespace DGtal
             const SCell & start_surfel );
 
 
+    /**
+       Function that extracts the boundary of a nD digital shape
+       (specified by a predicate on point), closed or not, in a nD
+       KSpace. The boundary is returned as a set of surfels, which is
+       the same as the one given by trackBoundary (or
+       trackClosedBoundary when @a closed is 'true').
+
+       The tracking is a level-synchronous breadth-first traversal:
+       the neighbors of all the surfels of the current front are
+       computed concurrently (one SurfelNeighborhood per thread, the
+       surface being only read), then the new ones are merged into the
+       surface and form the next front. Without OpenMP, the same
+       algorithm is run by a single thread.
+
+       @tparam SCellSet a model of a set of SCell (e.g., std::set<SCell>),
+       whose 'find' may be called concurrently.
+
+       @tparam PointPredicate a model of CPointPredicate, which may be
+       called concurrently.
+
+       @param surface (modified) a set of cells (which are all surfels),
+       the boundary component of [spelset] which touches [start_surfel].
+
+       @param K any space.
+       @param surfel_adj the surfel adjacency chosen for the tracking.
+       @param pp an instance of a model of CPointPredicate.
+
+       @param start_surfel a signed surfel which should be between an
+       element of [shape] and an element not in [shape].
+
+       @param closed when 'true', the boundary is known to be closed
+       and only direct orientations are followed.
+
+       @param timings when not 0, (modified) the durations of the
+       phases of the tracking.
+    */
+    template <typename SCellSet, typename PointPredicate >
+    static
+    void parallelTrackBoundary( SCellSet & surface,
+                                const KSpace & K,
+                                const SurfelAdjacency<KSpace::dimension> & surfel_adj,
+                                const PointPredicate & pp,
+                                const SCell & start_surfel,
+                                bool closed = false,
+                                TrackingTimings* timings = 0 );
+
     /**
        Function that extracts a n-1 digital surface (specified by a
        predicate on surfel), closed or open, in a nD KSpace. The
@@ -0,0 +1,59 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file DigitalSetTestHelpers.h
+ * @ingroup Tests
+ * @author Jacques-Olivier Lachaud (\c jacques-olivier.lachaud@univ-savoie.fr )
+ * Laboratory of Mathematics (CNRS, UMR 5807), University of Savoie, France
+ *
+ * @date 2026/10/19
+ *
+ * Functions shared by the tests comparing digital sets.
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(DigitalSetTestHelpers_RECURSES)
+#error Recursive header files inclusion detected in DigitalSetTestHelpers.h
+#else // defined(DigitalSetTestHelpers_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define DigitalSetTestHelpers_RECURSES
+
+#if !defined DigitalSetTestHelpers_h
+/** Prevents repeated inclusion of headers. */
+#define DigitalSetTestHelpers_h
+
+/**
+ * @param s1 any set with a ConstIterator, begin() and end().
+ * @param s2 any set with size() and find() on the points of [s1].
+ * @return 'true' if both sets contain the same points.
+ */
+template <typename TSet1, typename TSet2>
+bool sameSets( const TSet1 & s1, const TSet2 & s2 )
+{
+  if ( s1.size() != s2.size() ) return false;
+  for ( typename TSet1::ConstIterator it = s1.begin(); it != s1.end(); ++it )
+    if ( s2.find( *it ) == s2.end() ) return false;
+  return true;
+}
+
+#endif // !defined DigitalSetTestHelpers_h
+
+#undef DigitalSetTestHelpers_RECURSES
+#endif // else defined(DigitalSetTestHelpers_RECURSES)
@@ -0,0 +1,185 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testConcurrentSternBrocot.cpp
+ * @ingroup Tests
+ * @author Jacques-Olivier Lachaud (\c jacques-olivier.lachaud@univ-savoie.fr )
+ * Laboratory of Mathematics (CNRS, UMR 5127), University of Savoie, France
+ *
+ * @date 2026/10/19
+ *
+ * Functions for testing class ConcurrentSternBrocot.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/arithmetic/IntegerComputer.h"
+#include "DGtal/arithmetic/SternBrocot.h"
+#include "DGtal/arithmetic/ConcurrentSternBrocot.h"
+#include "DGtal/arithmetic/Pattern.h"
+#include "DGtal/arithmetic/StandardDSLQ0.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+typedef SternBrocot<DGtal::int64_t,DGtal::int32_t> SB;
+typedef ConcurrentSternBrocot<DGtal::int64_t,DGtal::int32_t> CSB;
+
+/// A query: a DSL (a,b,mu) and the abscissas of two of its points.
+struct Query
+{
+  DGtal::int64_t a, b, mu, x1, x2;
+};
+
+std::vector<Query> randomQueries( unsigned int nb, DGtal::int64_t moda,
+                                  DGtal::int64_t modb, DGtal::int64_t modx )
+{
+  IntegerComputer<DGtal::int64_t> ic;
+  std::vector<Query> queries;
+  while ( queries.size() < nb )
+    {
+      Query q;
+      q.a = random() % moda + 1;
+      q.b = random() % modb + 1;
+      if ( ic.gcd( q.a, q.b ) != 1 ) continue;
+      q.mu = random() % ( moda + modb );
+      q.x1 = random() % modx;
+      q.x2 = q.x1 + 1 + ( random() % modx );
+      queries.push_back( q );
+    }
+  return queries;
+}
+
+/// Computes the smartDSS of the query, returned as (a,b,mu).
+template <typename Fraction>
+void smartDSS( const Query & q, DGtal::int64_t result[ 3 ] )
+{
+  typedef StandardDSLQ0<Fraction> DSL;
+  DSL D( q.a, q.b, q.mu );
+  DSL S = D.smartDSS( D.lowestY( q.x1 ), D.lowestY( q.x2 ) );
+  result[ 0 ] = S.a();
+  result[ 1 ] = S.b();
+  result[ 2 ] = S.mu();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class ConcurrentSternBrocot.
+///////////////////////////////////////////////////////////////////////////////
+
+bool testFractions()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  trace.beginBlock ( "Testing block: fractions and continued fractions." );
+  const long nbFractions = 2000;
+  std::vector<DGtal::int64_t> p( nbFractions ), q( nbFractions );
+  for ( long i = 0; i < nbFractions; ++i )
+    {
+      p[ i ] = random() % 5000 + 1;
+      q[ i ] = random() % 5000 + 1;
+    }
+  std::vector<CSB::Fraction> fractions( nbFractions );
+#ifdef WITH_OPENMP
+#pragma omp parallel for schedule(dynamic,16)
+#endif
+  for ( long i = 0; i < nbFractions; ++i )
+    fractions[ i ] = CSB::fraction( p[ i ], q[ i ] );
+
+  unsigned int nbErrors = 0;
+  for ( long i = 0; i < nbFractions; ++i )
+    {
+      SB::Fraction f = SB::fraction( p[ i ], q[ i ] );
+      CSB::Fraction g = fractions[ i ];
+      std::vector<DGtal::int32_t> cf, cg;
+      f.getCFrac( cf );
+      g.getCFrac( cg );
+      if ( ( f.p() != g.p() ) || ( f.q() != g.q() ) || ( f.u() != g.u() )
+           || ( f.k() != g.k() ) || ( cf != cg )
+           || ( g != CSB::fraction( g.p(), g.q() ) )
+           || ( g.left().father() != g ) || ( g.right().father() != g )
+           || ( g.inverse().inverse() != g ) )
+        ++nbErrors;
+    }
+  nbok += ( nbErrors == 0 ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "same fractions as SternBrocot, nbErrors=" << nbErrors << std::endl;
+  nbok += ( CSB::instance().nbFractions <= CSB::instance().nbNodes() ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << CSB::instance().nbFractions << " fractions in "
+               << CSB::instance().nbNodes() << " nodes" << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+
+bool testSmartDSS()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  trace.beginBlock ( "Testing block: concurrent smartDSS." );
+  std::vector<Query> queries = randomQueries( 500, 12000, 12000, 1000 );
+  const long nbQueries = (long) queries.size();
+  std::vector<DGtal::int64_t> results( 3 * nbQueries );
+#ifdef WITH_OPENMP
+#pragma omp parallel for schedule(dynamic,8)
+#endif
+  for ( long i = 0; i < nbQueries; ++i )
+    smartDSS<CSB::Fraction>( queries[ i ], &results[ 3 * i ] );
+
+  unsigned int nbErrors = 0;
+  for ( long i = 0; i < nbQueries; ++i )
+    {
+      DGtal::int64_t expected[ 3 ];
+      smartDSS<SB::Fraction>( queries[ i ], expected );
+      if ( ( expected[ 0 ] != results[ 3 * i ] )
+           || ( expected[ 1 ] != results[ 3 * i + 1 ] )
+           || ( expected[ 2 ] != results[ 3 * i + 2 ] ) )
+        ++nbErrors;
+    }
+  nbok += ( nbErrors == 0 ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "same smartDSS as with SternBrocot, nbErrors=" << nbErrors << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Testing class ConcurrentSternBrocot" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  bool res = testFractions() && testSmartDSS();
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
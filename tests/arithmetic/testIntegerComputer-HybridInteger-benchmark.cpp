@@ -0,0 +1,103 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testIntegerComputer-HybridInteger-benchmark.cpp
+ * @ingroup Tests
+ * @author Jacques-Olivier Lachaud (\c jacques-olivier.lachaud@univ-savoie.fr )
+ * Laboratory of Mathematics (CNRS, UMR 5127), University of Savoie, France
+ *
+ * @date 2026/10/19
+ *
+ * Compares IntegerComputer with int64_t, BigInteger and HybridInteger
+ * on gcd, continued fractions and Bezout vectors of random integers.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/kernel/HybridInteger.h"
+#include "DGtal/arithmetic/IntegerComputer.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for benchmarking IntegerComputer.
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Computes gcd, continued fraction and Bezout vector of the pairs
+ * (a[i],b[i]).
+ * @return a checksum of the results.
+ */
+template <typename Integer>
+DGtal::int64_t benchIntegerComputer( const std::vector<DGtal::int64_t> & a,
+                                     const std::vector<DGtal::int64_t> & b )
+{
+  typedef IntegerComputer<Integer> IC;
+  IC ic;
+  Integer sum = 0;
+  std::vector<Integer> quotients;
+  for ( unsigned int i = 0; i < a.size(); ++i )
+    {
+      Integer x( a[ i ] );
+      Integer y( b[ i ] );
+      Integer g = ic.gcd( x, y );
+      quotients.clear();
+      ic.getCFrac( quotients, x / g, y / g );
+      typename IC::Vector2I v = ic.extendedEuclid( x / g, y / g, 1 );
+      sum += g + Integer( (DGtal::int64_t) quotients.size() ) 
+        + v[ 0 ] + ic.floorDiv( x, y ) + ic.ceilDiv( y, x );
+    }
+  return NumberTraits<Integer>::castToInt64_t( sum );
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv)
+{
+  unsigned int nb = ( argc > 1 ) ? atoi( argv[ 1 ] ) : 200000;
+  DGtal::int64_t mod = ( argc > 2 ) ? atoll( argv[ 2 ] ) : 1000000000;
+  std::vector<DGtal::int64_t> a( nb ), b( nb );
+  for ( unsigned int i = 0; i < nb; ++i )
+    {
+      a[ i ] = ( (DGtal::int64_t) random() * random() ) % mod + 1;
+      b[ i ] = ( (DGtal::int64_t) random() * random() ) % mod + 1;
+    }
+  std::cout << "# integer pairs time(ms) checksum" << std::endl;
+  trace.beginBlock( "IntegerComputer<int64_t>" );
+  DGtal::int64_t s = benchIntegerComputer<DGtal::int64_t>( a, b );
+  long time = trace.endBlock();
+  std::cout << "int64_t " << nb << " " << time << " " << s << std::endl;
+  trace.beginBlock( "IntegerComputer<BigInteger>" );
+  s = benchIntegerComputer<DGtal::BigInteger>( a, b );
+  time = trace.endBlock();
+  std::cout << "BigInteger " << nb << " " << time << " " << s << std::endl;
+  trace.beginBlock( "IntegerComputer<HybridInteger>" );
+  s = benchIntegerComputer<DGtal::HybridInteger>( a, b );
+  time = trace.endBlock();
+  std::cout << "HybridInteger " << nb << " " << time << " " << s << std::endl;
+  return 0;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,136 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testPatternCache-rasterize-benchmark.cpp
+ * @ingroup Tests
+ * @author Jacques-Olivier Lachaud (\c jacques-olivier.lachaud@univ-savoie.fr )
+ * Laboratory of Mathematics (CNRS, UMR 5127), University of Savoie, France
+ *
+ * @date 2026/10/19
+ *
+ * Throughput of PatternCache::rasterize compared to the iteration
+ * over a StandardDSLQ0, on long digital straight segments.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/arithmetic/IntegerComputer.h"
+#include "DGtal/arithmetic/SternBrocot.h"
+#include "DGtal/arithmetic/StandardDSLQ0.h"
+#include "DGtal/arithmetic/PatternCache.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+typedef SternBrocot<DGtal::int64_t,DGtal::int32_t> SB;
+typedef SB::Fraction Fraction;
+typedef Fraction::Integer Integer;
+typedef StandardDSLQ0<Fraction> DSL;
+typedef PatternCache<Fraction> Cache;
+typedef Cache::Point2I Point2I;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for benchmarking the rasterization of DSLs.
+///////////////////////////////////////////////////////////////////////////////
+
+Integer checksum( const std::vector<Point2I> & points )
+{
+  Integer sum = 0;
+  for ( unsigned int i = 0; i < points.size(); i += 97 )
+    sum += points[ i ][ 0 ] + 3 * points[ i ][ 1 ];
+  return sum + points.back()[ 0 ] + points.back()[ 1 ];
+}
+
+Integer benchIterator( const std::vector<DSL> & dsls,
+                       std::vector<Point2I> & points )
+{
+  Integer sum = 0;
+  for ( unsigned int i = 0; i < dsls.size(); ++i )
+    {
+      DSL::ConstIterator it = dsls[ i ].begin( dsls[ i ].U() );
+      for ( unsigned int j = 0; j < points.size(); ++j, ++it )
+        points[ j ] = *it;
+      sum += checksum( points );
+    }
+  return sum;
+}
+
+Integer benchRasterize( Cache & cache, const std::vector<DSL> & dsls,
+                        std::vector<Point2I> & points )
+{
+  Integer sum = 0;
+  for ( unsigned int i = 0; i < dsls.size(); ++i )
+    {
+      cache.rasterize( points.begin(), dsls[ i ], dsls[ i ].U(),
+                       points.size() );
+      sum += checksum( points );
+    }
+  return sum;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv)
+{
+  unsigned int nbtries = ( argc > 1 ) ? atoi( argv[ 1 ] ) : 100;
+  Integer moda = ( argc > 2 ) ? atoll( argv[ 2 ] ) : 1000;
+  Integer modb = ( argc > 3 ) ? atoll( argv[ 3 ] ) : 1000;
+  unsigned int length = ( argc > 4 ) ? atoi( argv[ 4 ] ) : 1000000;
+  unsigned int nbLines = ( argc > 5 ) ? atoi( argv[ 5 ] ) : 10;
+
+  // nbLines parallel lines per slope, so that the cache is used.
+  IntegerComputer<Integer> ic;
+  std::vector<DSL> dsls;
+  for ( unsigned int i = 0; i < nbtries; ++i )
+    {
+      Integer a( random() % moda + 1 );
+      Integer b( random() % modb + 1 );
+      if ( ic.gcd( a, b ) != 1 ) continue;
+      for ( unsigned int l = 0; l < nbLines; ++l )
+        dsls.push_back( DSL( a, b, random() % ( moda + modb ) ) );
+    }
+  std::vector<Point2I> points( length );
+  const double nbPoints = (double) dsls.size() * length;
+  const double mbytes = nbPoints * sizeof( Point2I ) / ( 1024.0 * 1024.0 );
+
+  Cache cache;
+  std::cout << "# method points time(ms) points/ms MB/s checksum" << std::endl;
+  for ( int mode = 0; mode < 2; ++mode )
+    {
+      const char* name = ( mode == 0 ) ? "iterator" : "rasterize";
+      trace.beginBlock( name );
+      Integer sum = ( mode == 0 )
+        ? benchIterator( dsls, points )
+        : benchRasterize( cache, dsls, points );
+      long time = trace.endBlock();
+      std::cout << name << " " << nbPoints << " " << time << " "
+                << ( time > 0 ? nbPoints / time : 0.0 ) << " "
+                << ( time > 0 ? 1000.0 * mbytes / time : 0.0 ) << " "
+                << sum << std::endl;
+    }
+  trace.info() << cache << std::endl;
+  return 0;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,190 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testPatternCache.cpp
+ * @ingroup Tests
+ * @author Jacques-Olivier Lachaud (\c jacques-olivier.lachaud@univ-savoie.fr )
+ * Laboratory of Mathematics (CNRS, UMR 5127), University of Savoie, France
+ *
+ * @date 2026/10/19
+ *
+ * Functions for testing class PatternCache.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+#include <iterator>
+#include "DGtal/base/Common.h"
+#include "DGtal/arithmetic/IntegerComputer.h"
+#include "DGtal/arithmetic/SternBrocot.h"
+#include "DGtal/arithmetic/Pattern.h"
+#include "DGtal/arithmetic/StandardDSLQ0.h"
+#include "DGtal/arithmetic/PatternCache.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class PatternCache.
+///////////////////////////////////////////////////////////////////////////////
+
+typedef SternBrocot<DGtal::int64_t,DGtal::int32_t>::Fraction Fraction;
+typedef PatternCache<Fraction> Cache;
+typedef Cache::Point2I Point2I;
+typedef StandardDSLQ0<Fraction> DSL;
+
+/**
+ * Compares the descriptors with the patterns for all the slopes p/q
+ * with p,q < max.
+ */
+bool testDescriptors( DGtal::int64_t max )
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  trace.beginBlock ( "Testing block: descriptors vs Pattern." );
+  IntegerComputer<DGtal::int64_t> ic;
+  Cache cache;
+  for ( DGtal::int64_t p = 1; p < max; ++p )
+    for ( DGtal::int64_t q = 1; q < max; ++q )
+      {
+        if ( ic.gcd( p, q ) != 1 ) continue;
+        Fraction f( p, q );
+        Pattern<Fraction> pattern( f );
+        Cache::DescriptorPtr d = cache.descriptor( f );
+        bool ok = ( d->rE() == pattern.rE() )
+          && ( d->bezout() == pattern.bezout() )
+          && ( d->v() == pattern.v() );
+        for ( int k = 0; k < 3; ++k )
+          ok = ok && ( d->posU( k ) == pattern.posU( k ) )
+            && ( d->posL( k ) == pattern.posL( k ) )
+            && ( d->U( k ) == pattern.U( k ) )
+            && ( d->L( k ) == pattern.L( k ) );
+        // Prefix points and positions of the leaning points.
+        ok = ok && ( d->point( d->length() ) == pattern.U( 1 ) )
+          && ( d->point( (Cache::Size) pattern.posL( 0 ) ) == pattern.L( 0 ) )
+          && ( d->position( 0 ) == 0 );
+        nbok += ok ? 1 : 0;
+        nb++;
+      }
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "rE, posU, posL, U, L, bezout, point" << std::endl;
+  // The degenerate patterns 0/1 and 1/0.
+  nbok += ( cache.descriptor( Fraction( 0, 1 ) )->rE() == "0" ) ? 1 : 0;
+  nb++;
+  nbok += ( cache.descriptor( Fraction( 1, 0 ) )->rE() == "1" ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "rE(0/1) == 0, rE(1/0) == 1" << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+
+/**
+ * Compares the rasterization with the iteration over StandardDSLQ0.
+ */
+bool testRasterize( unsigned int nbtries, DGtal::int64_t max )
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  trace.beginBlock ( "Testing block: rasterize vs StandardDSLQ0::ConstIterator." );
+  IntegerComputer<DGtal::int64_t> ic;
+  Cache cache( 16 );
+  Cache uncached( 16, 0 );
+  for ( unsigned int i = 0; i < nbtries; ++i )
+    {
+      DGtal::int64_t a = random() % max + 1;
+      DGtal::int64_t b = random() % max + 1;
+      if ( ic.gcd( a, b ) != 1 ) continue;
+      DGtal::int64_t mu = random() % ( 2 * max ) - max;
+      DSL D( a, b, mu );
+      Point2I start = D.lowestY( random() % ( 4 * max ) - 2 * max );
+      Cache::Size n = random() % ( 3 * ( a + b ) + 200 ) + 1;
+      std::vector<Point2I> expected, points, points2;
+      DSL::ConstIterator it = D.begin( start );
+      for ( Cache::Size j = 0; j < n; ++j, ++it )
+        expected.push_back( *it );
+      cache.rasterize( std::back_inserter( points ), D, start, n );
+      uncached.rasterize( std::back_inserter( points2 ), D, start, n );
+      nbok += ( ( points == expected ) && ( points2 == expected ) ) ? 1 : 0;
+      nb++;
+    }
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "same points as the DSL iterator" << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+
+/**
+ * Checks the LRU policy of the cache.
+ */
+bool testLRU()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  trace.beginBlock ( "Testing block: LRU eviction." );
+  Cache cache( 2, 100 );
+  Cache::DescriptorPtr d1 = cache.descriptor( Fraction( 1, 2 ) );
+  cache.descriptor( Fraction( 2, 3 ) );
+  cache.descriptor( Fraction( 1, 2 ) ); // hit, 2/3 becomes the oldest
+  cache.descriptor( Fraction( 3, 4 ) ); // evicts 2/3
+  cache.descriptor( Fraction( 1, 2 ) ); // hit
+  cache.descriptor( Fraction( 2, 3 ) ); // miss
+  cache.descriptor( Fraction( 100, 1 ) ); // too long, not cached
+  nbok += ( cache.size() == 2 ) ? 1 : 0;
+  nb++;
+  nbok += ( ( cache.nbHits() == 2 ) && ( cache.nbMisses() == 5 ) ) ? 1 : 0;
+  nb++;
+  nbok += cache.isValid() ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << cache << std::endl;
+  // Evicted descriptors remain valid as long as they are used.
+  cache.clear();
+  nbok += ( ( cache.size() == 0 ) && ( d1->rE() == "001" ) ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "descriptor outlives the cache entry" << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Testing class PatternCache" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  unsigned int nbtries = ( argc > 1 ) ? atoi( argv[ 1 ] ) : 1000;
+  bool res = testDescriptors( 40 )
+    && testRasterize( nbtries, 200 )
+    && testLRU();
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,158 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testStandardDSLQ0-CSB-smartDSS-benchmark.cpp
+ * @ingroup Tests
+ * @author Jacques-Olivier Lachaud (\c jacques-olivier.lachaud@univ-savoie.fr )
+ * Laboratory of Mathematics (CNRS, UMR 5127), University of Savoie, France
+ *
+ * @date 2026/10/19
+ *
+ * Benchmark of smartDSS with ConcurrentSternBrocot on several threads.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/kernel/CPointPredicate.h"
+#include "DGtal/arithmetic/IntegerComputer.h"
+#include "DGtal/arithmetic/ConcurrentSternBrocot.h"
+#include "DGtal/arithmetic/Pattern.h"
+#include "DGtal/arithmetic/StandardDSLQ0.h"
+#ifdef WITH_OPENMP
+#include <omp.h>
+#endif
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class ConcurrentSternBrocot.
+///////////////////////////////////////////////////////////////////////////////
+
+/// A DSL (a,b,mu) and the abscissas of two of its points.
+template <typename Integer>
+struct Query
+{
+  Integer a, b, mu, x1, x2;
+};
+
+template <typename Integer>
+void randomQueries( std::vector< Query<Integer> > & queries, unsigned int nbtries,
+                    Integer moda, Integer modb, Integer modx )
+{
+  IntegerComputer<Integer> ic;
+  queries.clear();
+  for ( unsigned int i = 0; i < nbtries; ++i )
+    {
+      Integer a( random() % moda + 1 );
+      Integer b( random() % modb + 1 );
+      if ( ic.gcd( a, b ) == 1 )
+        {
+          for ( Integer mu = 0; mu < 5; ++mu )
+            {
+              Query<Integer> q;
+              q.a = a;
+              q.b = b;
+              q.mu = random() % (moda+modb);
+              for ( Integer x = 0; x < 10; ++x )
+                {
+                  q.x1 = random() % modx;
+                  q.x2 = q.x1 + 1 + ( random() % modx );
+                  queries.push_back( q );
+                }
+            }
+        }
+    }
+}
+
+/**
+ * Computes the smartDSS of all the queries on [nbThreads] threads.
+ * @return a checksum of the resulting DSS characteristics.
+ */
+template <typename Fraction>
+typename Fraction::Integer
+benchSubStandardDSLQ0( const std::vector< Query<typename Fraction::Integer> > & queries,
+                       int nbThreads )
+{
+  typedef StandardDSLQ0<Fraction> DSL;
+  typedef typename Fraction::Integer Integer;
+  const long nb = (long) queries.size();
+  std::vector<Integer> sums( nbThreads, Integer( 0 ) );
+  boost::ignore_unused_variable_warning( nbThreads );
+#ifdef WITH_OPENMP
+#pragma omp parallel for schedule(dynamic,64) num_threads(nbThreads)
+#endif
+  for ( long i = 0; i < nb; ++i )
+    {
+      const Query<Integer> & q = queries[ i ];
+      DSL D( q.a, q.b, q.mu );
+      DSL S = D.smartDSS( D.lowestY( q.x1 ), D.lowestY( q.x2 ) );
+#ifdef WITH_OPENMP
+      Integer & sum = sums[ omp_get_thread_num() ];
+#else
+      Integer & sum = sums[ 0 ];
+#endif
+      sum += S.a() + S.b() + S.mu();
+    }
+  Integer sum = 0;
+  for ( int t = 0; t < nbThreads; ++t )
+    sum += sums[ t ];
+  return sum;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv)
+{
+  typedef ConcurrentSternBrocot<DGtal::int64_t,DGtal::int32_t> SB;
+  typedef SB::Fraction Fraction;
+  typedef Fraction::Integer Integer;
+  unsigned int nbtries = ( argc > 1 ) ? atoi( argv[ 1 ] ) : 10000;
+  Integer moda = ( argc > 2 ) ? atoll( argv[ 2 ] ) : 12000;
+  Integer modb = ( argc > 3 ) ? atoll( argv[ 3 ] ) : 12000;
+  Integer modx = ( argc > 4 ) ? atoll( argv[ 4 ] ) : 1000;
+#ifdef WITH_OPENMP
+  int maxThreads = ( argc > 5 ) ? atoi( argv[ 5 ] ) : omp_get_max_threads();
+#else
+  int maxThreads = 1;
+#endif
+
+  // Each run draws new queries, so that the tree keeps growing
+  // concurrently.
+  std::vector< Query<Integer> > queries;
+  std::cout << "# threads queries time(ms) checksum fractions nodes" << std::endl;
+  for ( int nbThreads = 1; nbThreads <= maxThreads; ++nbThreads )
+    {
+      randomQueries( queries, nbtries, moda, modb, modx );
+      trace.beginBlock( "smartDSS with ConcurrentSternBrocot" );
+      Integer sum = benchSubStandardDSLQ0<Fraction>( queries, nbThreads );
+      long time = trace.endBlock();
+      std::cout << nbThreads << " " << queries.size() << " " << time
+                << " " << sum << " " << SB::instance().nbFractions
+                << " " << SB::instance().nbNodes() << std::endl;
+    }
+  return 0;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
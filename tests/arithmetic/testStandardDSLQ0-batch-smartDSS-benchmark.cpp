@@ -0,0 +1,181 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testStandardDSLQ0-batch-smartDSS-benchmark.cpp
+ * @ingroup Tests
+ * @author Jacques-Olivier Lachaud (\c jacques-olivier.lachaud@univ-savoie.fr )
+ * Laboratory of Mathematics (CNRS, UMR 5127), University of Savoie, France
+ *
+ * @date 2026/10/19
+ *
+ * Throughput of the batch smartDSS and reversedSmartDSS compared to
+ * one call per subsegment.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/arithmetic/IntegerComputer.h"
+#include "DGtal/arithmetic/ConcurrentSternBrocot.h"
+#include "DGtal/arithmetic/StandardDSLQ0.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+typedef ConcurrentSternBrocot<DGtal::int64_t,DGtal::int32_t> SB;
+typedef SB::Fraction Fraction;
+typedef Fraction::Integer Integer;
+typedef StandardDSLQ0<Fraction> DSL;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for benchmarking the batch queries of StandardDSLQ0.
+///////////////////////////////////////////////////////////////////////////////
+
+/// A DSL and subsegments of it.
+struct Batch
+{
+  DSL dsl;
+  std::vector<DSL::Query> queries;
+};
+
+/**
+ * Draws random DSLs and, on each one, all the subsegments starting at
+ * [nbStarts] random abscissas with [nbLengths] random lengths, as
+ * when computing the segments of a curve at several scales.
+ */
+void randomBatches( std::vector<Batch> & batches, unsigned int nbtries,
+                    Integer moda, Integer modb, Integer modx,
+                    unsigned int nbStarts, unsigned int nbLengths )
+{
+  IntegerComputer<Integer> ic;
+  batches.clear();
+  for ( unsigned int i = 0; i < nbtries; ++i )
+    {
+      Integer a( random() % moda + 1 );
+      Integer b( random() % modb + 1 );
+      if ( ic.gcd( a, b ) != 1 ) continue;
+      Batch batch;
+      batch.dsl = DSL( a, b, random() % (moda+modb) );
+      for ( unsigned int s = 0; s < nbStarts; ++s )
+        {
+          Integer x1 = random() % modx;
+          for ( unsigned int l = 0; l < nbLengths; ++l )
+            {
+              Integer x2 = x1 + 1 + ( random() % modx );
+              batch.queries.push_back
+                ( std::make_pair( batch.dsl.lowestY( x1 ),
+                                  batch.dsl.lowestY( x2 ) ) );
+            }
+        }
+      batches.push_back( batch );
+    }
+}
+
+Integer checksum( const std::vector<DSL> & results )
+{
+  Integer sum = 0;
+  for ( unsigned int i = 0; i < results.size(); ++i )
+    sum += results[ i ].a() + results[ i ].b() + results[ i ].mu();
+  return sum;
+}
+
+/// One call per subsegment.
+Integer benchSingle( const std::vector<Batch> & batches, bool reversed )
+{
+  Integer sum = 0;
+  std::vector<DSL> results;
+  for ( unsigned int i = 0; i < batches.size(); ++i )
+    {
+      const Batch & batch = batches[ i ];
+      results.clear();
+      for ( unsigned int j = 0; j < batch.queries.size(); ++j )
+        results.push_back
+          ( reversed
+            ? batch.dsl.reversedSmartDSS( batch.queries[ j ].first,
+                                          batch.queries[ j ].second )
+            : batch.dsl.smartDSS( batch.queries[ j ].first,
+                                  batch.queries[ j ].second ) );
+      sum += checksum( results );
+    }
+  return sum;
+}
+
+/// One batch per DSL.
+Integer benchBatch( const std::vector<Batch> & batches, bool reversed,
+                    bool parallel )
+{
+  Integer sum = 0;
+  std::vector<DSL> results;
+  for ( unsigned int i = 0; i < batches.size(); ++i )
+    {
+      const Batch & batch = batches[ i ];
+      if ( reversed )
+        batch.dsl.reversedSmartDSS( results, batch.queries, parallel );
+      else
+        batch.dsl.smartDSS( results, batch.queries, parallel );
+      sum += checksum( results );
+    }
+  return sum;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv)
+{
+  unsigned int nbtries = ( argc > 1 ) ? atoi( argv[ 1 ] ) : 1000;
+  Integer moda = ( argc > 2 ) ? atoll( argv[ 2 ] ) : 12000;
+  Integer modb = ( argc > 3 ) ? atoll( argv[ 3 ] ) : 12000;
+  Integer modx = ( argc > 4 ) ? atoll( argv[ 4 ] ) : 1000;
+  unsigned int nbStarts = ( argc > 5 ) ? atoi( argv[ 5 ] ) : 8;
+  unsigned int nbLengths = ( argc > 6 ) ? atoi( argv[ 6 ] ) : 64;
+
+  std::vector<Batch> batches;
+  randomBatches( batches, nbtries, moda, modb, modx, nbStarts, nbLengths );
+  unsigned int nbQueries = 0;
+  for ( unsigned int i = 0; i < batches.size(); ++i )
+    nbQueries += batches[ i ].queries.size();
+  // Fills the Stern-Brocot tree once, so that all the methods are
+  // timed on the same tree.
+  benchSingle( batches, false );
+
+  const char* names[ 2 ] = { "smartDSS", "reversedSmartDSS" };
+  std::cout << "# method mode queries time(ms) queries/ms checksum" << std::endl;
+  for ( int r = 0; r < 2; ++r )
+    for ( int mode = 0; mode < 3; ++mode )
+      {
+        const char* modeName = ( mode == 0 ) ? "single"
+          : ( mode == 1 ) ? "batch" : "parallel-batch";
+        trace.beginBlock( std::string( names[ r ] ) + " " + modeName );
+        Integer sum = ( mode == 0 )
+          ? benchSingle( batches, r == 1 )
+          : benchBatch( batches, r == 1, mode == 2 );
+        long time = trace.endBlock();
+        std::cout << names[ r ] << " " << modeName << " " << nbQueries
+                  << " " << time << " "
+                  << ( time > 0 ? (double) nbQueries / time : 0.0 )
+                  << " " << sum << std::endl;
+      }
+  return 0;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
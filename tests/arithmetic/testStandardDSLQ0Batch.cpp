@@ -0,0 +1,178 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testStandardDSLQ0Batch.cpp
+ * @ingroup Tests
+ * @author Jacques-Olivier Lachaud (\c jacques-olivier.lachaud@univ-savoie.fr )
+ * Laboratory of Mathematics (CNRS, UMR 5127), University of Savoie, France
+ *
+ * @date 2026/10/19
+ *
+ * Functions for testing the batch smartDSS and reversedSmartDSS of
+ * class StandardDSLQ0.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/arithmetic/SternBrocot.h"
+#include "DGtal/arithmetic/ConcurrentSternBrocot.h"
+#include "DGtal/arithmetic/StandardDSLQ0.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing the batch queries of class StandardDSLQ0.
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Draws queries starting at a few abscissas, with many lengths, some
+ * of them duplicated, some of them translated by periods.
+ */
+template <typename DSL>
+void randomQueries( std::vector<typename DSL::Query> & queries,
+                    const DSL & D, unsigned int nbStarts,
+                    unsigned int nbLengths, DGtal::int64_t modx )
+{
+  queries.clear();
+  for ( unsigned int s = 0; s < nbStarts; ++s )
+    {
+      DGtal::int64_t x1 = random() % modx - modx / 2;
+      for ( unsigned int l = 0; l < nbLengths; ++l )
+        {
+          DGtal::int64_t x2 = x1 + 1 + ( random() % modx );
+          DGtal::int64_t k = random() % 3 - 1;
+          queries.push_back( std::make_pair( D.lowestY( x1 + k * D.b() ),
+                                             D.uppermostY( x2 + k * D.b() ) ) );
+          if ( random() % 8 == 0 )
+            queries.push_back( queries.back() );
+        }
+    }
+}
+
+template <typename DSL>
+bool sameDSL( const DSL & D1, const DSL & D2 )
+{
+  return ( D1.a() == D2.a() ) && ( D1.b() == D2.b() ) && ( D1.mu() == D2.mu() );
+}
+
+template <typename Fraction>
+bool testBatch( unsigned int nbtries, bool parallel )
+{
+  typedef StandardDSLQ0<Fraction> DSL;
+  typedef typename DSL::Query Query;
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  trace.beginBlock ( parallel ? "Testing block: parallel batch queries."
+                     : "Testing block: batch queries." );
+  unsigned int nbQueries = 0;
+  unsigned int nbErrors = 0;
+  unsigned int nbReversedErrors = 0;
+  for ( unsigned int i = 0; i < nbtries; ++i )
+    {
+      DGtal::int64_t a = random() % 200 + 1;
+      DGtal::int64_t b = random() % 200 + 1;
+      if ( IntegerComputer<DGtal::int64_t>().gcd( a, b ) != 1 ) continue;
+      DSL D( a, b, random() % 400 );
+      std::vector<Query> queries;
+      randomQueries( queries, D, 4, 20, 500 );
+      std::vector<DSL> results, reversedResults;
+      D.smartDSS( results, queries, parallel );
+      D.reversedSmartDSS( reversedResults, queries, parallel );
+      for ( unsigned int j = 0; j < queries.size(); ++j )
+        {
+          DSL S = D.smartDSS( queries[ j ].first, queries[ j ].second );
+          DSL R = D.reversedSmartDSS( queries[ j ].first, queries[ j ].second );
+          if ( ! sameDSL( S, results[ j ] ) )
+            {
+              if ( nbErrors == 0 )
+                trace.warning() << D << " A=" << queries[ j ].first
+                                << " B=" << queries[ j ].second
+                                << " smartDSS=" << S
+                                << " batch=" << results[ j ] << std::endl;
+              ++nbErrors;
+            }
+          if ( ! sameDSL( R, reversedResults[ j ] ) )
+            ++nbReversedErrors;
+        }
+      nbQueries += queries.size();
+    }
+  nbok += ( nbErrors == 0 ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "batch smartDSS == smartDSS, nbQueries=" << nbQueries
+               << " nbErrors=" << nbErrors << std::endl;
+  nbok += ( nbReversedErrors == 0 ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "batch reversedSmartDSS == reversedSmartDSS, nbErrors="
+               << nbReversedErrors << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+
+bool testEmptyBatch()
+{
+  typedef SternBrocot<DGtal::int64_t,DGtal::int32_t>::Fraction Fraction;
+  typedef StandardDSLQ0<Fraction> DSL;
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  trace.beginBlock ( "Testing block: empty batch." );
+  DSL D( 3, 5, 0 );
+  std::vector<DSL::Query> queries;
+  std::vector<DSL> results( 3 );
+  D.smartDSS( results, queries );
+  nbok += results.empty() ? 1 : 0;
+  nb++;
+  D.reversedSmartDSS( results, queries );
+  nbok += results.empty() ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "no query, no result" << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  typedef SternBrocot<DGtal::int64_t,DGtal::int32_t>::Fraction SBFraction;
+  typedef ConcurrentSternBrocot<DGtal::int64_t,DGtal::int32_t>::Fraction CSBFraction;
+  trace.beginBlock ( "Testing batch queries of class StandardDSLQ0" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  unsigned int nbtries = ( argc > 1 ) ? atoi( argv[ 1 ] ) : 100;
+  bool res = testEmptyBatch()
+    && testBatch<SBFraction>( nbtries, false )
+    && testBatch<CSBFraction>( nbtries, true );
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,133 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testArrayDeque.cpp
+ * @ingroup Tests
+ * @author Tristan Roussillon (\c tristan.roussillon@liris.cnrs.fr )
+ * Laboratoire d'InfoRmatique en Image et Systèmes d'information - LIRIS (CNRS, UMR 5205), CNRS, France
+ *
+ * @date 2026/10/19
+ *
+ * Functions for testing class ArrayDeque.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <deque>
+#include <algorithm>
+#include <cstdlib>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/ArrayDeque.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class ArrayDeque.
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @return 'true' if both containers have the same elements.
+ */
+bool sameElements( const ArrayDeque<int> & d1, const std::deque<int> & d2 )
+{
+  return ( d1.size() == d2.size() )
+    && std::equal( d1.begin(), d1.end(), d2.begin() )
+    && std::equal( d1.rbegin(), d1.rend(), d2.rbegin() );
+}
+
+/**
+ * Random insertions and deletions at both ends, compared with
+ * std::deque.
+ */
+bool testArrayDeque()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Insertions and deletions at both ends..." );
+  ArrayDeque<int> d( 2 );
+  std::deque<int> ref;
+  srand( 0 );
+  bool ok = true;
+  for ( int i = 0; i < 10000; ++i )
+    {
+      int r = rand() % 5;
+      if ( ( r < 2 ) || ref.empty() )
+        {
+          if ( r % 2 ) { d.push_front( i ); ref.push_front( i ); }
+          else { d.push_back( i ); ref.push_back( i ); }
+        }
+      else if ( r == 2 ) { d.pop_front(); ref.pop_front(); }
+      else if ( r == 3 ) { d.pop_back(); ref.pop_back(); }
+      else if ( ( d.front() != ref.front() ) || ( d.back() != ref.back() ) )
+        ok = false;
+      ok = ok && d.isValid();
+    }
+  ok = ok && sameElements( d, ref );
+  nbok += ok ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "same as std::deque, size=" << d.size()
+               << " capacity=" << d.capacity() << std::endl;
+  trace.endBlock();
+
+  trace.beginBlock ( "Memory reuse..." );
+  ArrayDeque<int>::size_type capacity = d.capacity();
+  d.clear();
+  for ( int i = 0; i < (int) capacity; ++i )
+    ( i % 2 ) ? d.push_front( i ) : d.push_back( i );
+  nbok += ( ( d.size() == capacity ) && ( d.capacity() == capacity ) ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "no reallocation after clear()" << std::endl;
+  ArrayDeque<int> e;
+  e = d;
+  ArrayDeque<int> f( e );
+  nbok += ( std::equal( d.begin(), d.end(), e.begin() )
+            && std::equal( d.begin(), d.end(), f.begin() )
+            && ( d[ 3 ] == f[ 3 ] ) && ( d.end() - d.begin() == (int) d.size() ) )
+    ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "copy and assignment" << std::endl;
+  trace.endBlock();
+
+  return nbok == nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Testing class ArrayDeque" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  bool res = testArrayDeque(); // && ... other tests
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,208 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testBenchmark.cpp
+ * @ingroup Tests
+ * @author David Coeurjolly (\c david.coeurjolly@liris.cnrs.fr )
+ * Laboratoire d'InfoRmatique en Image et Systèmes d'information - LIRIS (CNRS, UMR 5205), CNRS, France
+ *
+ * @date 2026/10/19
+ *
+ * Functions for testing class Benchmark.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/Benchmark.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class Benchmark.
+///////////////////////////////////////////////////////////////////////////////
+
+/// A case counting its calls.
+struct CountingCase
+{
+  unsigned int* nbCalls;
+  unsigned int n;
+  CountingCase( unsigned int* calls, unsigned int size )
+    : nbCalls( calls ), n( size ) {}
+  double operator()()
+  {
+    ++*nbCalls;
+    double s = 0.0;
+    for ( unsigned int i = 1; i <= n; ++i )
+      s += 1.0 / i;
+    return s;
+  }
+};
+
+bool testRun()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  trace.beginBlock ( "Testing block: warmup, repetitions and filter." );
+  Benchmark bench( 2, 5 );
+  unsigned int calls = 0;
+  bench.setFilter( "harmonic" );
+  bool run1 = bench.run( "harmonic", "n100000", 100000, CountingCase( &calls, 100000 ) );
+  bool run2 = bench.run( "other", "n10", 10, CountingCase( &calls, 10 ) );
+  bool run3 = bench.run( "other", "harmonic-n10", 10, CountingCase( &calls, 10 ) );
+  nbok += ( run1 && ! run2 && run3 && ( calls == 14 ) ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "2 runs of 2+5 calls " << bench << std::endl;
+  const Benchmark::Result & r = bench.results()[ 0 ];
+  nbok += ( ( bench.results().size() == 2 ) && ( r.repetitions == 5 )
+            && ( r.min <= r.median ) && ( r.median <= r.max ) 
+            && ( r.min <= r.mean ) && ( r.mean <= r.max )
+            && ( r.stddev >= 0.0 ) && ( r.min > 0.0 ) ) ? 1 : 0;
+  nb++;
+  nbok += ( ( r.checksum > 12.0 ) && ( r.checksum < 12.1 ) ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "median=" << r.median << " min=" << r.min 
+               << " max=" << r.max << " checksum=" << r.checksum << std::endl;
+
+  // Thread CPU time, with the hardware events when available.
+  Benchmark cpuBench( 0, 2, Clock::THREAD_CPU_TIME );
+  const bool events = cpuBench.setCountEvents( true );
+  cpuBench.run( "harmonic", "n100000", 100000, CountingCase( &calls, 100000 ) );
+  const Benchmark::Result & c = cpuBench.results()[ 0 ];
+  nbok += ( ( cpuBench.mode() == Clock::THREAD_CPU_TIME ) && ( c.min > 0.0 )
+            && ( ! events || ( c.counters[ PerfCounters::INSTRUCTIONS ] > 100000.0 ) ) ) 
+    ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << cpuBench << " events=" << events 
+               << " instructions=" << c.counters[ PerfCounters::INSTRUCTIONS ] << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+
+bool testJSONAndComparison()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  trace.beginBlock ( "Testing block: JSON output and baseline comparison." );
+  Benchmark bench( 0, 3 );
+  std::vector<double> d1, d2, d3;
+  d1.push_back( 10.0 ); d1.push_back( 12.0 ); d1.push_back( 11.0 );
+  d2.push_back( 5.0 ); d2.push_back( 5.0 ); d2.push_back( 5.0 );
+  d3.push_back( 1.0 );
+  bench.addResult( "dt", "ball \"r32\"", 1000, d1, 42.0 );
+  bench.addResult( "track", "goursat", 2000, d2, 7.0 );
+  bench.addResult( "isSimple", "flower", 3000, d3, 1.0 );
+  std::ostringstream out;
+  bench.writeJSON( out );
+  trace.info() << out.str();
+  std::istringstream in( out.str() );
+  std::vector<Benchmark::Result> read = Benchmark::readJSON( in );
+  nbok += ( read.size() == 3 ) ? 1 : 0;
+  nb++;
+  nbok += ( ( read.size() == 3 ) && ( read[ 0 ].dataset == "ball \"r32\"" )
+            && ( read[ 0 ].median == 11.0 ) && ( read[ 0 ].size == 1000 )
+            && ( read[ 0 ].mean == 11.0 ) && ( read[ 0 ].min == 10.0 )
+            && ( read[ 1 ].checksum == 7.0 ) ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "JSON read back" << std::endl;
+
+  // Baseline: dt was faster, track was slower with another checksum,
+  // isSimple is new, and thinning is not measured any more.
+  std::vector<Benchmark::Result> baseline( read.begin(), read.begin() + 3 );
+  baseline[ 0 ].median = 5.0;
+  baseline[ 1 ].median = 10.0;
+  baseline[ 1 ].checksum = 8.0;
+  baseline[ 2 ].name = "thinning";
+  std::vector<Benchmark::Comparison> comparisons;
+  unsigned int nbFailures = bench.compare( comparisons, baseline, 0.1 );
+  Benchmark::writeComparisons( trace.info(), comparisons );
+  nbok += ( ( nbFailures == 2 ) && ( comparisons.size() == 4 ) ) ? 1 : 0;
+  nb++;
+  nbok += ( comparisons[ 0 ].regression && ( comparisons[ 0 ].ratio == 2.2 )
+            && ! comparisons[ 0 ].checksumChanged ) ? 1 : 0;
+  nb++;
+  nbok += ( comparisons[ 1 ].improvement && comparisons[ 1 ].checksumChanged ) ? 1 : 0;
+  nb++;
+  nbok += ( comparisons[ 2 ].added && ! comparisons[ 2 ].regression ) ? 1 : 0;
+  nb++;
+  nbok += ( comparisons[ 3 ].missing && ( comparisons[ 3 ].name == "thinning" )
+            && ! comparisons[ 3 ].added ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "regression, improvement, checksum change, new and missing cases" << std::endl;
+  // The cases of the baseline not selected by the filter are not missing.
+  bench.setFilter( "track" );
+  nbFailures = bench.compare( comparisons, baseline, 0.1 );
+  nbok += ( ( nbFailures == 1 ) && ( comparisons.size() == 3 ) ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "filtered cases of the baseline are not missing" << std::endl;
+
+  bool thrown = false;
+  std::istringstream bad( "{\"results\": [ {\"name\": \"dt\" " );
+  try { Benchmark::readJSON( bad ); }
+  catch ( DGtal::IOException & ) { thrown = true; }
+  nbok += thrown ? 1 : 0;
+  nb++;
+  std::istringstream other( "{\"other\": [1, {\"a\": null}, true], \"results\": [] }" );
+  nbok += Benchmark::readJSON( other ).empty() ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "malformed JSON rejected, unknown keys skipped" << std::endl;
+  std::istringstream counted( "{\"clock\": \"wall\", \"results\": [ {\"name\": \"dt\", "
+                              "\"counters\": {\"instructions\": 1234, \"other\": 5} } ] }" );
+  read = Benchmark::readJSON( counted );
+  nbok += ( ( read.size() == 1 ) 
+            && ( read[ 0 ].counters[ PerfCounters::INSTRUCTIONS ] == 1234.0 )
+            && ( read[ 0 ].counters[ PerfCounters::CYCLES ] == 0.0 ) ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "hardware counters read back" << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Testing class Benchmark" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  bool res = testRun()
+    && testJSONAndComparison();
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
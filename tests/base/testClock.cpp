@@ -69,7 +69,7 @@ bool test_loopTick()
     return (tick >= 0);
 }
 
-/// Test several loops
+/// Test several loops (nested clocks)
 bool test_MultipleLoop()
 {
     double tick1,tick2,tmp=0;
@@ -91,7 +91,7 @@ bool test_MultipleLoop()
 
     tick1 = c.stopClock();
     trace.info()<< "Loop tick1: "<< tick1 <<" Loop tick2: "<< tick2 <<endl;
-    return (tick1 >= 0);
+    return (tick1 >= tick2) && (tick2 >= 0);
 }
 
 
@@ -0,0 +1,94 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testPerfCounters.cpp
+ * @ingroup Tests
+ * @author David Coeurjolly (\c david.coeurjolly@liris.cnrs.fr )
+ * Laboratoire d'InfoRmatique en Image et Systèmes d'information - LIRIS (CNRS, UMR 5205), CNRS, France
+ *
+ * @date 2026/10/19
+ *
+ * Functions for testing class PerfCounters.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/PerfCounters.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class PerfCounters.
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * The counters may be unavailable (other systems, restricted kernels,
+ * virtual machines): the values must then be 0.
+ */
+bool testPerfCounters()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  trace.beginBlock ( "Testing block: counting a loop." );
+  PerfCounters counters;
+  counters.start();
+  volatile double s = 0.0;
+  for ( unsigned int i = 1; i <= 1000000; ++i )
+    s = s + 1.0 / i;
+  counters.stop();
+  trace.info() << counters << " (" << s << ")" << std::endl;
+  for ( unsigned int e = 0; e < PerfCounters::NB_EVENTS; ++e )
+    {
+      const PerfCounters::Event event = (PerfCounters::Event) e;
+      nbok += ( counters.isAvailable( event ) || ( counters.value( event ) == 0 ) ) ? 1 : 0;
+      nb++;
+    }
+  nbok += ( ! counters.isAvailable( PerfCounters::INSTRUCTIONS )
+            || ( counters.value( PerfCounters::INSTRUCTIONS ) > 1000000 ) ) ? 1 : 0;
+  nb++;
+  nbok += ( std::string( PerfCounters::name( PerfCounters::CACHE_MISSES ) ) 
+            == "cache-misses" ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "available=" << counters.isAvailable() << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Testing class PerfCounters" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  bool res = testPerfCounters();
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
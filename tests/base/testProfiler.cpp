@@ -0,0 +1,284 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testProfiler.cpp
+ * @ingroup Tests
+ * @author David Coeurjolly (\c david.coeurjolly@liris.cnrs.fr )
+ * Laboratoire d'InfoRmatique en Image et Systèmes d'information - LIRIS (CNRS, UMR 5205), CNRS, France
+ *
+ * @date 2026/10/19
+ *
+ * Functions for testing class Profiler.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/Profiler.h"
+#ifdef WITH_OPENMP
+#include <omp.h>
+#endif
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class Profiler.
+///////////////////////////////////////////////////////////////////////////////
+
+volatile double sink = 0.0;
+
+void work( unsigned int n )
+{
+  double s = 0.0;
+  for ( unsigned int i = 0; i < n; ++i )
+    s += 1.0 / ( 1.0 + i );
+  sink = sink + s;
+}
+
+const Profiler::Record* findRecord( const std::vector<Profiler::Record> & records,
+                                    const std::string & name )
+{
+  for ( unsigned int i = 0; i < records.size(); ++i )
+    if ( records[ i ].name == name ) return &records[ i ];
+  return 0;
+}
+
+bool testAggregation()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  trace.beginBlock ( "Testing block: nested scopes, total and self times." );
+  Profiler p;
+  Profiler::SiteId outer = p.site( "outer" );
+  Profiler::SiteId inner = p.site( "inner" );
+  nbok += ( ( p.site( "outer" ) == outer ) && ( p.name( inner ) == "inner" ) ) ? 1 : 0;
+  nb++;
+  for ( unsigned int i = 0; i < 10; ++i )
+    {
+      p.begin( outer );
+      work( 10000 );
+      for ( unsigned int j = 0; j < 3; ++j )
+        {
+          p.begin( inner );
+          work( 20000 );
+          p.end();
+        }
+      p.end();
+    }
+  std::vector<Profiler::Record> records;
+  p.aggregate( records );
+  const Profiler::Record* ro = findRecord( records, "outer" );
+  const Profiler::Record* ri = findRecord( records, "inner" );
+  nbok += ( ( records.size() == 2 ) && ( ro != 0 ) && ( ri != 0 ) ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "two sites recorded " << p << std::endl;
+  if ( ( ro == 0 ) || ( ri == 0 ) ) return false;
+  nbok += ( ( ro->calls == 10 ) && ( ri->calls == 30 ) ) ? 1 : 0;
+  nb++;
+  nbok += ( ( ri->self == ri->total ) && ( ro->self + ri->total == ro->total ) 
+            && ( ro->self > 0 ) ) ? 1 : 0;
+  nb++;
+  nbok += ( records[ 0 ].name == "outer" ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "outer total=" << ro->total << " self=" << ro->self
+               << ", inner total=" << ri->total << std::endl;
+  std::vector<Profiler::Event> events;
+  p.getEvents( events, 0 );
+  bool ordered = events.size() == 40;
+  for ( unsigned int i = 1; ordered && ( i < events.size() ); ++i )
+    ordered = events[ i - 1 ].end <= events[ i ].end;
+  nbok += ( ordered && ( events[ 0 ].depth == 1 ) && ( events[ 3 ].depth == 0 ) 
+            && ( events[ 3 ].site == outer ) ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "events in completion order with depths" << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+
+bool testRing()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  trace.beginBlock ( "Testing block: ring buffer overflow." );
+  Profiler p( 8 );
+  Profiler::SiteId s = p.site( "s" );
+  for ( unsigned int i = 0; i < 20; ++i )
+    {
+      p.begin( s );
+      p.end();
+    }
+  std::vector<Profiler::Event> events;
+  p.getEvents( events, 0 );
+  std::vector<Profiler::Record> records;
+  p.aggregate( records );
+  nbok += ( ( p.nbEvents() == 20 ) && ( p.nbDropped() == 12 ) 
+            && ( events.size() == 8 ) ) ? 1 : 0;
+  nb++;
+  nbok += ( ( records.size() == 1 ) && ( records[ 0 ].calls == 20 ) ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "8 events kept, statistics exact " << p << std::endl;
+  p.clear( 4 );
+  p.getEvents( events, 0 );
+  p.aggregate( records );
+  nbok += ( ( p.nbEvents() == 0 ) && events.empty() && records.empty() ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "clear" << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+
+bool testOutput()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  trace.beginBlock ( "Testing block: Chrome trace and CSV outputs." );
+  Profiler p;
+  Profiler::SiteId s1 = p.site( "a \"quoted\", name" );
+  Profiler::SiteId s2 = p.site( "b" );
+  p.begin( s1 );
+  p.begin( s2 );
+  p.end();
+  p.end();
+  std::ostringstream json, csv;
+  p.writeChromeTrace( json );
+  p.writeCSV( csv );
+  trace.info() << json.str();
+  trace.info() << csv.str();
+  nbok += ( json.str().find( "{\"traceEvents\":[" ) == 0 ) ? 1 : 0;
+  nb++;
+  nbok += ( json.str().find( "\"name\":\"a \\\"quoted\\\", name\"" ) 
+            != std::string::npos ) ? 1 : 0;
+  nb++;
+  nbok += ( json.str().find( "\"ph\":\"X\"" ) != std::string::npos ) ? 1 : 0;
+  nb++;
+  nbok += ( csv.str().find( "name,calls,total_ns,self_ns,mean_ns\n"
+                            "\"a \"\"quoted\"\", name\",1," ) == 0 ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "escaped names, event phases, CSV header" << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+
+bool testThreads()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  trace.beginBlock ( "Testing block: per-thread buffers." );
+  Profiler p;
+  Profiler::SiteId s = p.site( "task" );
+  int nbThreads = 1;
+#ifdef WITH_OPENMP
+#pragma omp parallel
+  {
+#pragma omp single
+    nbThreads = omp_get_num_threads();
+#pragma omp for schedule(dynamic)
+    for ( long i = 0; i < 100; ++i )
+      {
+        p.begin( s );
+        work( 1000 );
+        p.end();
+      }
+  }
+#else
+  for ( long i = 0; i < 100; ++i )
+    {
+      p.begin( s );
+      work( 1000 );
+      p.end();
+    }
+#endif
+  std::vector<Profiler::Record> records;
+  p.aggregate( records );
+  nbok += ( ( records.size() == 1 ) && ( records[ 0 ].calls == 100 ) ) ? 1 : 0;
+  nb++;
+  nbok += ( ( p.nbThreads() >= 1 ) && ( (int) p.nbThreads() <= nbThreads ) ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "100 calls over " << nbThreads << " threads " << p << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+
+bool testGlobalProfiler()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  trace.beginBlock ( "Testing block: DGTAL_PROFILE_SCOPE and Trace blocks." );
+  profiler.clear();
+  for ( unsigned int i = 0; i < 5; ++i )
+    {
+      DGTAL_PROFILE_SCOPE( "testGlobalProfiler loop" );
+      work( 1000 );
+    }
+  trace.beginBlock( "traced block" );
+  trace.endBlock();
+  std::vector<Profiler::Record> records;
+  profiler.aggregate( records );
+#ifdef WITH_PROFILING
+  const Profiler::Record* r = findRecord( records, "testGlobalProfiler loop" );
+  nbok += ( ( r != 0 ) && ( r->calls == 5 ) ) ? 1 : 0;
+  nb++;
+  nbok += ( findRecord( records, "traced block" ) != 0 ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "scopes and blocks recorded" << std::endl;
+#else
+  nbok += records.empty() ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "nothing recorded without WITH_PROFILING" << std::endl;
+#endif
+  trace.endBlock();
+  return nbok == nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Testing class Profiler" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  bool res = testAggregation()
+    && testRing()
+    && testOutput()
+    && testThreads()
+    && testGlobalProfiler();
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
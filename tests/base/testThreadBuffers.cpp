@@ -0,0 +1,101 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testThreadBuffers.cpp
+ * @ingroup Tests
+ * @author Jacques-Olivier Lachaud (\c jacques-olivier.lachaud@univ-savoie.fr )
+ * Laboratory of Mathematics (CNRS, UMR 5127), University of Savoie, France
+ *
+ * @date 2026/10/19
+ *
+ * Functions for testing class ThreadBuffers.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <vector>
+#include <algorithm>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/ThreadBuffers.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class ThreadBuffers.
+///////////////////////////////////////////////////////////////////////////////
+
+bool testOrder()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  trace.beginBlock ( "Testing block: the buffers give the sequential order." );
+  // Iteration i outputs i%3 values, as a sequential loop would.
+  const int n = 1000;
+  std::vector<int> expected;
+  for ( int i = 0; i < n; ++i )
+    for ( int j = 0; j < i % 3; ++j )
+      expected.push_back( i );
+  ThreadBuffers<int> buffers;
+#ifdef WITH_OPENMP
+#pragma omp parallel
+#endif
+  {
+    std::vector<int> & local = buffers.local();
+#ifdef WITH_OPENMP
+#pragma omp for schedule(static)
+#endif
+    for ( int i = 0; i < n; ++i )
+      for ( int j = 0; j < i % 3; ++j )
+        local.push_back( i );
+  }
+  std::vector<int> result( 1, -1 );
+  buffers.appendTo( result );
+  trace.info() << buffers << std::endl;
+  nbok += buffers.isValid() ? 1 : 0;
+  nb++;
+  nbok += ( ( result.size() == expected.size() + 1 ) && ( result[ 0 ] == -1 )
+            && std::equal( expected.begin(), expected.end(), result.begin() + 1 ) )
+    ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << expected.size() << " values appended in order" << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Testing class ThreadBuffers" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  bool res = testOrder();
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
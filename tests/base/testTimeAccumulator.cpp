@@ -0,0 +1,177 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testTimeAccumulator.cpp
+ * @ingroup Tests
+ * @author David Coeurjolly (\c david.coeurjolly@liris.cnrs.fr )
+ * Laboratoire d'InfoRmatique en Image et Systèmes d'information - LIRIS (CNRS, UMR 5205), CNRS, France
+ *
+ * @date 2026/10/19
+ *
+ * Functions for testing class TimeAccumulator.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <cmath>
+#include <iostream>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/TimeAccumulator.h"
+#ifdef WITH_OPENMP
+#include <omp.h>
+#endif
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class TimeAccumulator.
+///////////////////////////////////////////////////////////////////////////////
+
+double work( unsigned int n )
+{
+  double s = 0.0;
+  for ( unsigned int i = 1; i <= n; ++i )
+    s += std::cos( s + i );
+  return s;
+}
+
+bool testClockModes()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  trace.beginBlock ( "Testing block: nanosecond clocks, nested, in each mode." );
+  Clock outer( Clock::WALL_TIME );
+  Clock inner( Clock::THREAD_CPU_TIME );
+  Clock process( Clock::PROCESS_CPU_TIME );
+  outer.startClock();
+  process.startClock();
+  double s = work( 10 );
+  inner.startClock();
+  s += work( 200000 );
+  const Clock::Time tInner = inner.elapsed();
+  s += work( 200000 );
+  const Clock::Time tOuter = outer.elapsed();
+  const Clock::Time tProcess = process.elapsed();
+  nbok += ( ( tInner > 0 ) && ( tOuter > tInner ) && ( tProcess > tInner ) ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "inner=" << tInner << " ns outer=" << tOuter 
+               << " ns process=" << tProcess << " ns (" << s << ")" << std::endl;
+  Clock::Time t0 = Clock::now(), t1 = Clock::now();
+  nbok += ( ( t1 >= t0 ) && ( outer.stopClock() == (long) ( outer.elapsed() / 1000000 ) ) ) 
+    ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "two successive now(): " << t1 - t0 << " ns " << outer << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+
+bool testAccumulator()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  trace.beginBlock ( "Testing block: accumulation and scopes." );
+  TimeAccumulator acc( "work", Clock::WALL_TIME );
+  nbok += ( ( acc.count() == 0 ) && ( acc.total() == 0 ) && ( acc.min() == 0 )
+            && ( acc.mean() == 0.0 ) && acc.isValid() ) ? 1 : 0;
+  nb++;
+  acc.add( 10 );
+  acc.add( 30 );
+  acc.add( 20 );
+  nbok += ( ( acc.count() == 3 ) && ( acc.total() == 60 ) && ( acc.min() == 10 )
+            && ( acc.max() == 30 ) && ( acc.mean() == 20.0 ) ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") " << acc << std::endl;
+  acc.reset();
+  double s = 0.0;
+  for ( unsigned int i = 0; i < 10; ++i )
+    {
+      TimerScope scope( acc );
+      s += work( 1000 );
+    }
+  nbok += ( ( acc.count() == 10 ) && ( acc.min() > 0 ) && ( acc.min() <= acc.max() )
+            && ( acc.total() >= 10 * acc.min() ) ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") " << acc 
+               << " (" << s << ")" << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+
+bool testThreads()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  trace.beginBlock ( "Testing block: per-thread accumulation." );
+  TimeAccumulator acc( "parallel work", Clock::THREAD_CPU_TIME );
+  const long n = 64;
+  std::vector<double> results( n );
+#ifdef WITH_OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+  for ( long i = 0; i < n; ++i )
+    {
+      TimerScope scope( acc );
+      results[ i ] = work( 2000 );
+    }
+  boost::uint64_t nbBySlots = 0;
+  for ( unsigned int i = 0; i < acc.nbSlots(); ++i )
+    nbBySlots += acc.count( i );
+  nbok += ( ( acc.count() == (boost::uint64_t) n ) && ( nbBySlots == acc.count() )
+            && ( acc.total() > 0 ) ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") " << acc << std::endl;
+#ifdef WITH_OPENMP
+  // More threads than omp_get_max_threads(): each has its own slot.
+  TimeAccumulator acc2( "oversubscribed work" );
+  const int nbThreads = 4 * omp_get_max_threads();
+#pragma omp parallel num_threads( nbThreads )
+  for ( long i = 0; i < n; ++i )
+    {
+      TimerScope scope( acc2 );
+    }
+  nbok += ( ( acc2.count() == (boost::uint64_t) ( n * nbThreads ) )
+            && ( acc2.nbSlots() <= (unsigned int) nbThreads ) ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") " << acc2 << std::endl;
+#endif
+  trace.endBlock();
+  return nbok == nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Testing class TimeAccumulator" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  bool res = testClockModes() && testAccumulator() && testThreads();
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
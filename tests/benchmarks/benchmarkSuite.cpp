@@ -0,0 +1,546 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file benchmarkSuite.cpp
+ * @ingroup Tests
+ * @author David Coeurjolly (\c david.coeurjolly@liris.cnrs.fr )
+ * Laboratoire d'InfoRmatique en Image et Systèmes d'information - LIRIS (CNRS, UMR 5205), CNRS, France
+ *
+ * @date 2026/10/19
+ *
+ * Unified benchmark of the main algorithms of DGtal (distance
+ * transformation, boundary extraction, simple points, segmentation
+ * and estimators) on reproducible datasets, with JSON output and
+ * comparison with a baseline.
+ *
+ * Usage: benchmarkSuite [--output results.json] [--baseline base.json]
+ *   [--tolerance 0.1] [--warmup 1] [--repetitions 5] [--scale 2]
+ *   [--filter name] [--clock wall|process-cpu|thread-cpu] [--events]
+ *
+ * The exit status is 1 when a regression is found, or when a case of
+ * the baseline is not measured any more.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <cstdlib>
+#include <cstring>
+#include <cmath>
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/CountedPtr.h"
+#include "DGtal/base/Benchmark.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/kernel/sets/SetPredicate.h"
+#include "DGtal/math/MPolynomial.h"
+#include "DGtal/io/readers/MPolynomialReader.h"
+#include "DGtal/shapes/Shapes.h"
+#include "DGtal/shapes/GaussDigitizer.h"
+#include "DGtal/shapes/parametric/Ball2D.h"
+#include "DGtal/shapes/parametric/Flower2D.h"
+#include "DGtal/shapes/implicit/ImplicitBall.h"
+#include "DGtal/shapes/implicit/ImplicitPolynomial3Shape.h"
+#include "DGtal/topology/helpers/Surfaces.h"
+#include "DGtal/geometry/volumes/distance/DistanceTransformation.h"
+#include "DGtal/geometry/curves/ArithmeticalDSS.h"
+#include "DGtal/geometry/curves/GreedySegmentation.h"
+#include "DGtal/geometry/curves/estimation/SegmentComputerEstimators.h"
+#include "DGtal/geometry/curves/estimation/MostCenteredMaximalSegmentEstimator.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Reproducible datasets.
+///////////////////////////////////////////////////////////////////////////////
+
+/// Linear congruential generator, identical on all platforms.
+struct Random
+{
+  DGtal::uint64_t state;
+  Random( DGtal::uint64_t seed ) : state( seed ) {}
+  /// @return a uniform number in [0,1[.
+  double uniform()
+  {
+    state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+    return (double) ( state >> 11 ) / 9007199254740992.0;
+  }
+};
+
+/// A named digital shape.
+template <typename TSpace>
+struct Dataset
+{
+  typedef HyperRectDomain<TSpace> Domain;
+  typedef typename DigitalSetSelector< Domain, BIG_DS+HIGH_BEL_DS >::Type DigitalSet;
+  std::string name;
+  Domain domain;
+  DigitalSet set;
+  Dataset( const std::string & aName, const Domain & aDomain )
+    : name( aName ), domain( aDomain ), set( domain ) {}
+};
+
+typedef Dataset<Z2i::Space> Dataset2D;
+typedef Dataset<Z3i::Space> Dataset3D;
+
+std::string datasetName( const std::string & prefix, double value )
+{
+  std::ostringstream s;
+  s << prefix << value;
+  return s.str();
+}
+
+/// Gauss digitization of [shape] with step [h], the domain being
+/// enlarged by [margin] points in each direction.
+template <typename TSpace, typename TShape>
+Dataset<TSpace>* digitize( const std::string & name, const TShape & shape,
+                           typename TSpace::RealPoint lower,
+                           typename TSpace::RealPoint upper,
+                           double h, double margin )
+{
+  typedef GaussDigitizer<TSpace, TShape> Digitizer;
+  typedef typename Dataset<TSpace>::Domain Domain;
+  for ( Dimension i = 0; i < TSpace::dimension; ++i )
+    {
+      lower[ i ] -= margin * h;
+      upper[ i ] += margin * h;
+    }
+  Digitizer dig;
+  dig.attach( shape );
+  dig.init( lower, upper, h );
+  Dataset<TSpace>* d = new Dataset<TSpace>( name, dig.getDomain() );
+  Shapes<Domain>::digitalShaper( d->set, dig );
+  return d;
+}
+
+/// Complement of a digital set (copyable, unlike NotPointPredicate).
+template <typename TDigitalSet>
+struct OutsidePredicate
+{
+  typedef typename TDigitalSet::Point Point;
+  const TDigitalSet* set;
+  OutsidePredicate( const TDigitalSet & aSet ) : set( &aSet ) {}
+  bool operator()( const Point & aPoint ) const
+  {
+    return set->find( aPoint ) == set->end();
+  }
+};
+
+/**
+ * Kanungo noise: each point at Euclidean distance d of the other
+ * side of the shape (d=1 for the points adjacent to it) changes side
+ * with probability alpha^d.
+ */
+template <typename TSpace>
+void addNoise( Dataset<TSpace> & d, double alpha, DGtal::uint64_t seed )
+{
+  typedef Dataset<TSpace> Data;
+  typedef SetPredicate<typename Data::DigitalSet> Inside;
+  typedef OutsidePredicate<typename Data::DigitalSet> Outside;
+  typedef DistanceTransformation<TSpace, Inside, 2> DTIn;
+  typedef DistanceTransformation<TSpace, Outside, 2> DTOut;
+  Inside inside( d.set );
+  Outside outside( d.set );
+  DTIn dtIn( d.domain, inside );
+  DTOut dtOut( d.domain, outside );
+  typename DTIn::OutputImage in = dtIn.compute();
+  typename DTOut::OutputImage out = dtOut.compute();
+  Random random( seed );
+  typename Data::DigitalSet noisy( d.domain );
+  for ( typename Data::Domain::ConstIterator it = d.domain.begin(), 
+          itEnd = d.domain.end(); it != itEnd; ++it )
+    {
+      const bool isIn = inside( *it );
+      // The border of the domain stays outside of the shape.
+      bool border = false;
+      for ( Dimension i = 0; i < TSpace::dimension; ++i )
+        border = border || ( (*it)[ i ] == d.domain.lowerBound()[ i ] )
+          || ( (*it)[ i ] == d.domain.upperBound()[ i ] );
+      const double dist = std::sqrt( (double) ( isIn ? in( *it ) : out( *it ) ) );
+      const bool flip = ( random.uniform() < std::pow( alpha, dist ) ) && ! border;
+      if ( isIn != flip )
+        noisy.insertNew( *it );
+    }
+  d.set = noisy;
+}
+
+Dataset2D* ball2D( double radius )
+{
+  Ball2D<Z2i::Space> shape( 0.0, 0.0, radius );
+  return digitize<Z2i::Space>( datasetName( "ball2d-r", radius ), shape,
+                               shape.getLowerBound(), shape.getUpperBound(),
+                               1.0, 2.0 );
+}
+
+Dataset2D* noisyFlower2D( double radius, double alpha, DGtal::uint64_t seed )
+{
+  Flower2D<Z2i::Space> shape( 0.0, 0.0, radius, radius / 3.0, 5, 0.3 );
+  Dataset2D* d = digitize<Z2i::Space>( datasetName( "noisy-flower2d-r", radius ),
+                                       shape, shape.getLowerBound(),
+                                       shape.getUpperBound(), 1.0, 4.0 );
+  addNoise( *d, alpha, seed );
+  return d;
+}
+
+Dataset3D* ball3D( double radius )
+{
+  ImplicitBall<Z3i::Space> shape( Z3i::RealPoint( 0.0, 0.0, 0.0 ), radius );
+  return digitize<Z3i::Space>( datasetName( "ball3d-r", radius ), shape,
+                               shape.getLowerBound(), shape.getUpperBound(),
+                               1.0, 2.0 );
+}
+
+/// Implicit polynomial shape (inside where P > 0) in [-bound,bound]^3.
+Dataset3D* polynomial3D( const std::string & name, const std::string & poly,
+                         double bound, double h )
+{
+  typedef MPolynomial<3, double> Polynomial3;
+  Polynomial3 P;
+  MPolynomialReader<3, double> reader;
+  std::string::const_iterator it = reader.read( P, poly.begin(), poly.end() );
+  if ( it != poly.end() )
+    {
+      trace.error() << "Unable to read polynomial " << poly << std::endl;
+      return 0;
+    }
+  ImplicitPolynomial3Shape<Z3i::Space> shape( P );
+  return digitize<Z3i::Space>( datasetName( name + "-h", h ), shape,
+                               Z3i::RealPoint( -bound, -bound, -bound ),
+                               Z3i::RealPoint( bound, bound, bound ), h, 2.0 );
+}
+
+/// A bel between the first point of the set and the first point
+/// outside the shape on its left.
+template <typename KSpace, typename TSpace, typename Predicate>
+typename KSpace::SCell 
+firstBel( const KSpace & K, const Dataset<TSpace> & d, const Predicate & pred )
+{
+  typename TSpace::Point inside = *d.set.begin();
+  typename TSpace::Point outside = inside;
+  while ( pred( outside ) )
+    {
+      inside = outside;
+      --outside[ 0 ];
+    }
+  return Surfaces<KSpace>::findABel( K, pred, outside, inside );
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Benchmark cases.
+///////////////////////////////////////////////////////////////////////////////
+
+/// Separable Euclidean distance transformation of the shape.
+template <typename TSpace>
+struct DTCase
+{
+  const Dataset<TSpace>* d;
+  DTCase( const Dataset<TSpace>* aDataset ) : d( aDataset ) {}
+  double operator()()
+  {
+    typedef SetPredicate<typename Dataset<TSpace>::DigitalSet> Predicate;
+    typedef DistanceTransformation<TSpace, Predicate, 2> DT;
+    Predicate pred( d->set );
+    DT dt( d->domain, pred );
+    typename DT::OutputImage image = dt.compute();
+    double sum = 0.0;
+    for ( typename DT::OutputImage::ConstIterator it = image.begin(), 
+            itEnd = image.end(); it != itEnd; ++it )
+      sum += (double) *it;
+    return sum;
+  }
+};
+
+/// Tracking of the boundary of the shape from a bel.
+template <typename KSpace>
+struct TrackCase
+{
+  typedef typename KSpace::Space Space;
+  const Dataset<Space>* d;
+  TrackCase( const Dataset<Space>* aDataset ) : d( aDataset ) {}
+  double operator()()
+  {
+    typedef SetPredicate<typename Dataset<Space>::DigitalSet> Predicate;
+    Predicate pred( d->set );
+    KSpace K;
+    K.init( d->domain.lowerBound(), d->domain.upperBound(), true );
+    SurfelAdjacency<KSpace::dimension> adj( true );
+    typename KSpace::SurfelSet surface;
+    Surfaces<KSpace>::trackBoundary( surface, K, adj, pred, firstBel( K, *d, pred ) );
+    return (double) surface.size();
+  }
+};
+
+/// Extraction of all the boundary surfels of the shape.
+template <typename KSpace>
+struct MakeBoundaryCase
+{
+  typedef typename KSpace::Space Space;
+  const Dataset<Space>* d;
+  MakeBoundaryCase( const Dataset<Space>* aDataset ) : d( aDataset ) {}
+  double operator()()
+  {
+    typedef SetPredicate<typename Dataset<Space>::DigitalSet> Predicate;
+    Predicate pred( d->set );
+    KSpace K;
+    K.init( d->domain.lowerBound(), d->domain.upperBound(), true );
+    typename KSpace::SurfelSet boundary;
+    Surfaces<KSpace>::sMakeBoundary( boundary, K, pred, 
+                                     d->domain.lowerBound(), d->domain.upperBound() );
+    return (double) boundary.size();
+  }
+};
+
+typedef std::vector<Z2i::Point> Contour;
+typedef Contour::const_iterator ContourIterator;
+typedef ArithmeticalDSS<ContourIterator, Z2i::Integer, 4> DSS4;
+
+/// Extraction of all the 4-connected contours of the shape.
+struct ContoursCase
+{
+  const Dataset2D* d;
+  ContoursCase( const Dataset2D* aDataset ) : d( aDataset ) {}
+  double operator()()
+  {
+    typedef SetPredicate<Dataset2D::DigitalSet> Predicate;
+    Predicate pred( d->set );
+    Z2i::KSpace K;
+    K.init( d->domain.lowerBound(), d->domain.upperBound(), true );
+    SurfelAdjacency<2> adj( true );
+    std::vector<Contour> contours;
+    Surfaces<Z2i::KSpace>::extractAllPointContours4C( contours, K, pred, adj );
+    double nb = 0.0;
+    for ( unsigned int i = 0; i < contours.size(); ++i )
+      nb += (double) contours[ i ].size();
+    return nb;
+  }
+};
+
+/// Simplicity of the border points of the (4,8) object.
+struct IsSimpleCase
+{
+  const Z2i::Object4_8* object;
+  const std::vector<Z2i::Point>* points;
+  IsSimpleCase( const Z2i::Object4_8* anObject,
+                const std::vector<Z2i::Point>* somePoints )
+    : object( anObject ), points( somePoints ) {}
+  double operator()()
+  {
+    unsigned int nb = 0;
+    for ( unsigned int i = 0; i < points->size(); ++i )
+      if ( object->isSimple( (*points)[ i ] ) ) ++nb;
+    return (double) nb;
+  }
+};
+
+/// Greedy segmentation of the contour into DSSs.
+struct SegmentationCase
+{
+  const Contour* contour;
+  SegmentationCase( const Contour* aContour ) : contour( aContour ) {}
+  double operator()()
+  {
+    typedef GreedySegmentation<DSS4> Segmentation;
+    DSS4 algo;
+    Segmentation s( contour->begin(), contour->end(), algo );
+    unsigned int nb = 0;
+    for ( Segmentation::SegmentComputerIterator it = s.begin(), itEnd = s.end();
+          it != itEnd; ++it )
+      ++nb;
+    return (double) nb;
+  }
+};
+
+/// Tangent estimation by the most centered maximal DSS.
+struct TangentCase
+{
+  const Contour* contour;
+  TangentCase( const Contour* aContour ) : contour( aContour ) {}
+  double operator()()
+  {
+    typedef TangentVectorFromDSSEstimator<DSS4> SCEstimator;
+    typedef MostCenteredMaximalSegmentEstimator<DSS4, SCEstimator> Estimator;
+    DSS4 sc;
+    SCEstimator f;
+    Estimator e( sc, f );
+    e.init( 1.0, contour->begin(), contour->end() );
+    std::vector<SCEstimator::Quantity> tangents;
+    e.eval( contour->begin(), contour->end(), std::back_inserter( tangents ) );
+    double sum = 0.0;
+    for ( unsigned int i = 0; i < tangents.size(); ++i )
+      sum += std::fabs( tangents[ i ][ 0 ] ) + std::fabs( tangents[ i ][ 1 ] );
+    return sum;
+  }
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+void usage( const char* name )
+{
+  std::cerr << "Usage: " << name << " [options]" << std::endl
+            << "  --output FILE      writes the results as JSON to FILE" << std::endl
+            << "  --baseline FILE    compares the results with FILE (JSON)" << std::endl
+            << "  --tolerance X      relative tolerance of the comparison (0.1)" << std::endl
+            << "  --warmup N         untimed runs of each case (1)" << std::endl
+            << "  --repetitions N    timed runs of each case (5)" << std::endl
+            << "  --scale N          number of resolutions of the datasets (2)" << std::endl
+            << "  --filter S         only the cases or datasets containing S" << std::endl
+            << "  --clock C          wall, process-cpu or thread-cpu time (wall)" << std::endl
+            << "  --events           counts the hardware events (Linux perf_event)" << std::endl;
+}
+
+int main( int argc, char** argv )
+{
+  std::string output, baseline, filter;
+  double tolerance = 0.1;
+  unsigned int warmup = 1, repetitions = 5, scale = 2;
+  Clock::Mode mode = Clock::WALL_TIME;
+  bool events = false;
+  for ( int i = 1; i < argc; ++i )
+    {
+      const std::string arg( argv[ i ] );
+      const bool hasValue = i + 1 < argc;
+      if ( ( arg == "--output" ) && hasValue )           output = argv[ ++i ];
+      else if ( ( arg == "--baseline" ) && hasValue )    baseline = argv[ ++i ];
+      else if ( ( arg == "--tolerance" ) && hasValue )   tolerance = atof( argv[ ++i ] );
+      else if ( ( arg == "--warmup" ) && hasValue )      warmup = atoi( argv[ ++i ] );
+      else if ( ( arg == "--repetitions" ) && hasValue ) repetitions = atoi( argv[ ++i ] );
+      else if ( ( arg == "--scale" ) && hasValue )       scale = atoi( argv[ ++i ] );
+      else if ( ( arg == "--filter" ) && hasValue )      filter = argv[ ++i ];
+      else if ( ( arg == "--clock" ) && hasValue )
+        {
+          const std::string clock( argv[ ++i ] );
+          if ( clock == "process-cpu" )     mode = Clock::PROCESS_CPU_TIME;
+          else if ( clock == "thread-cpu" ) mode = Clock::THREAD_CPU_TIME;
+          else if ( clock != "wall" )
+            {
+              usage( argv[ 0 ] );
+              return 2;
+            }
+        }
+      else if ( arg == "--events" )                       events = true;
+      else
+        {
+          usage( argv[ 0 ] );
+          return 2;
+        }
+    }
+
+  Benchmark bench( warmup, repetitions, mode );
+  bench.setFilter( filter );
+  if ( events && ! bench.setCountEvents( true ) )
+    trace.warning() << "Hardware events are not available." << std::endl;
+  trace.beginBlock( "DGtal benchmark suite" );
+
+  // 2D datasets: balls and noisy flowers at several resolutions.
+  std::vector< CountedPtr<Dataset2D> > datasets2D;
+  for ( unsigned int s = 0; s < scale; ++s )
+    {
+      const double radius = 64.0 * ( 1 << s );
+      datasets2D.push_back( CountedPtr<Dataset2D>( ball2D( radius ) ) );
+      datasets2D.push_back( CountedPtr<Dataset2D>( noisyFlower2D( radius, 0.5, 17 + s ) ) );
+    }
+  for ( unsigned int i = 0; i < datasets2D.size(); ++i )
+    {
+      const Dataset2D* d = datasets2D[ i ].get();
+      const Benchmark::Size size = d->set.size();
+      typedef SetPredicate<Dataset2D::DigitalSet> Predicate;
+      Predicate pred( d->set );
+      Z2i::KSpace K;
+      K.init( d->domain.lowerBound(), d->domain.upperBound(), true );
+      SurfelAdjacency<2> adj( true );
+      // The longest contour (the outer one for the noisy shapes).
+      std::vector<Contour> contours;
+      Surfaces<Z2i::KSpace>::extractAllPointContours4C( contours, K, pred, adj );
+      Contour contour;
+      for ( unsigned int j = 0; j < contours.size(); ++j )
+        if ( contours[ j ].size() > contour.size() ) 
+          contour = contours[ j ];
+      Z2i::Object4_8 object( Z2i::dt4_8, d->set );
+      const Z2i::Object4_8 objectBorder = object.border();
+      std::vector<Z2i::Point> border( objectBorder.pointSet().begin(),
+                                      objectBorder.pointSet().end() );
+
+      bench.run( "dt-l2", d->name, size, DTCase<Z2i::Space>( d ) );
+      bench.run( "boundary-contours", d->name, size, ContoursCase( d ) );
+      bench.run( "isSimple", d->name, border.size(), IsSimpleCase( &object, &border ) );
+      bench.run( "segmentation-greedy", d->name, contour.size(), 
+                 SegmentationCase( &contour ) );
+      bench.run( "tangent-mostcentered", d->name, contour.size(), 
+                 TangentCase( &contour ) );
+    }
+  datasets2D.clear();
+
+  // 3D datasets: balls and the tangle cube at several resolutions.
+  for ( unsigned int s = 0; s < scale; ++s )
+    {
+      std::vector< CountedPtr<Dataset3D> > datasets3D;
+      datasets3D.push_back( CountedPtr<Dataset3D>( ball3D( 16.0 * ( 1 << s ) ) ) );
+      datasets3D.push_back( CountedPtr<Dataset3D>
+                            ( polynomial3D( "tanglecube",
+                                            "5x^2+5y^2+5z^2-x^4-y^4-z^4-11.8",
+                                            3.0, 0.1 / ( 1 << s ) ) ) );
+      for ( unsigned int i = 0; i < datasets3D.size(); ++i )
+        {
+          const Dataset3D* d = datasets3D[ i ].get();
+          if ( d == 0 ) continue;
+          const Benchmark::Size size = d->set.size();
+          bench.run( "dt-l2", d->name, size, DTCase<Z3i::Space>( d ) );
+          bench.run( "boundary-track", d->name, size, TrackCase<Z3i::KSpace>( d ) );
+          bench.run( "boundary-make", d->name, size, MakeBoundaryCase<Z3i::KSpace>( d ) );
+        }
+    }
+  trace.endBlock();
+
+  bench.writeTable( std::cout );
+  if ( ! output.empty() )
+    {
+      std::ofstream out( output.c_str() );
+      bench.writeJSON( out );
+      if ( ! out.good() )
+        {
+          trace.error() << "Unable to write " << output << std::endl;
+          return 2;
+        }
+    }
+  unsigned int nbFailures = 0;
+  if ( ! baseline.empty() )
+    {
+      std::vector<Benchmark::Comparison> comparisons;
+      try 
+        {
+          nbFailures = bench.compare( comparisons, Benchmark::readJSON( baseline ),
+                                      tolerance );
+        }
+      catch ( DGtal::IOException & )
+        {
+          return 2;
+        }
+      std::cout << std::endl;
+      Benchmark::writeComparisons( std::cout, comparisons );
+      std::cout << nbFailures << " regression(s) or missing case(s)" << std::endl;
+    }
+  return ( nbFailures == 0 ) ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -60,6 +60,7 @@
 #include "DGtal/geometry/curves/estimation/MLPLengthEstimator.h"
 #include "DGtal/geometry/curves/estimation/FPLengthEstimator.h"
 #include "DGtal/geometry/curves/estimation/DSSLengthEstimator.h"
+#include "DGtal/geometry/curves/estimation/LengthEstimationCache.h"
 
 #include "ConfigTest.h"
 
@@ -176,6 +177,95 @@ bool testLengthEstimatorsOnBall(double radius, double h)
 
 
 
+/**
+ * Checks that the estimators initialized from a LengthEstimationCache
+ * return the same values as the ones initialized from ranges.
+ */
+bool testLengthEstimationCache(double radius, double h)
+{
+  typedef Ball2D<Z2i::Space> Shape;
+  typedef Z2i::Space::Point Point;
+  typedef Z2i::Space::RealPoint RealPoint;
+  typedef KhalimskySpaceND<Z2i::Space::dimension,Z2i::Integer> KSpace;
+  typedef KSpace::SCell SCell;
+  typedef GridCurve<KSpace>::PointsRange PointsRange;
+  typedef GridCurve<KSpace>::ArrowsRange ArrowsRange;
+
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  Shape aShape(Point(0,0), radius);
+  RealPoint xLow ( -radius-1, -radius-1 );
+  RealPoint xUp( radius+1, radius+1 );
+  GaussDigitizer<Z2i::Space,Shape> dig;  
+  dig.attach( aShape ); 
+  dig.init( xLow, xUp, h ); 
+  KSpace K;
+  if ( ! K.init( dig.getLowerBound(), dig.getUpperBound(), true ) )
+    return false;
+
+  SurfelAdjacency<KSpace::dimension> SAdj( true );
+  SCell bel = Surfaces<KSpace>::findABel( K, dig, 10000 );
+  std::vector<Point> points;
+  Surfaces<KSpace>::track2DBoundaryPoints( points, K, SAdj, dig, bel );
+  GridCurve<KSpace> gridcurve;
+  gridcurve.initFromVector( points );
+
+  ArrowsRange ra = gridcurve.getArrowsRange(); 
+  PointsRange rp = gridcurve.getPointsRange(); 
+
+  trace.beginBlock ( "Length estimation from a cache" );
+
+  LengthEstimationCache< PointsRange::ConstIterator > cache;
+  cache.init( rp.begin(), rp.end(), gridcurve.isClosed() );
+  trace.info() << cache << std::endl;
+
+  L1LengthEstimator< ArrowsRange::ConstIterator > l1, l1c;
+  l1.init(h, ra.begin(), ra.end());
+  l1c.init(h, cache);
+  nbok += ( l1.eval() == l1c.eval() ) ? 1 : 0; 
+  nb++;
+
+  BLUELocalLengthEstimator< ArrowsRange::ConstIterator > blue, bluec;
+  blue.init(h, ra.begin(), ra.end(), gridcurve.isClosed());
+  bluec.init(h, cache);
+  nbok += ( blue.eval() == bluec.eval() ) ? 1 : 0; 
+  nb++;
+
+  RosenProffittLocalLengthEstimator< ArrowsRange::ConstIterator > rp1, rp1c;
+  rp1.init(h, ra.begin(), ra.end(), gridcurve.isClosed());
+  rp1c.init(h, cache);
+  nbok += ( rp1.eval() == rp1c.eval() ) ? 1 : 0; 
+  nb++;
+
+  DSSLengthEstimator< PointsRange::ConstIterator > dss, dssc;
+  dss.init(h, rp.begin(), rp.end(), gridcurve.isClosed());
+  dssc.init(h, cache);
+  nbok += ( std::abs( dss.eval() - dssc.eval() ) < 1e-10 ) ? 1 : 0; 
+  nb++;
+
+  MLPLengthEstimator< PointsRange::ConstIterator > mlp, mlpc;
+  mlp.init(h, rp.begin(), rp.end(), gridcurve.isClosed());
+  mlpc.init(h, cache);
+  nbok += ( std::abs( mlp.eval() - mlpc.eval() ) < 1e-10 ) ? 1 : 0; 
+  nb++;
+
+  FPLengthEstimator< PointsRange::ConstIterator > fp, fpc;
+  fp.init(h, rp.begin(), rp.end(), gridcurve.isClosed());
+  fpc.init(h, cache);
+  nbok += ( std::abs( fp.eval() - fpc.eval() ) < 1e-10 ) ? 1 : 0; 
+  nb++;
+
+  trace.info() << l1c.eval() << " " << bluec.eval() << " " << rp1c.eval() 
+               << " " << dssc.eval() << " " << mlpc.eval() << " " << fpc.eval() << std::endl;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "estimations from the cache equal direct estimations" << std::endl;
+  trace.endBlock();
+
+  return nbok == nb;
+}
+
+
 bool testDisplay(double radius, double h)
 {
 
@@ -305,6 +395,7 @@ int main( int argc, char** argv )
     && testLengthEstimatorsOnBall(r,0.1)
     && testLengthEstimatorsOnBall(r,0.01)
     && testLengthEstimatorsOnBall(r,0.001)
+    && testLengthEstimationCache(r,0.1)
     && testDisplay(r,0.9);
   ;
 
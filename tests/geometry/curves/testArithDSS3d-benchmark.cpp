@@ -0,0 +1,146 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testArithDSS3d-benchmark.cpp
+ * @ingroup Tests
+ * @author Tristan Roussillon (\c
+ * tristan.roussillon@liris.cnrs.fr ) Laboratoire d'InfoRmatique en
+ * Image et Systèmes d'information - LIRIS (CNRS, UMR 5205), CNRS,
+ * France
+ *
+ * @date 2026/10/19
+ *
+ * Benchmark of the greedy decomposition of many 3d curves into 3d
+ * DSS: GreedySegmentation<ArithmeticalDSS3d> on each curve versus
+ * ArithmeticalDSS3dBatch.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <cmath>
+#include <cstdlib>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/geometry/curves/ArithmeticalDSS3d.h"
+#include "DGtal/geometry/curves/GreedySegmentation.h"
+#include "DGtal/geometry/curves/ArithmeticalDSS3dBatch.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+typedef PointVector<3,int> Point;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for benchmarking the decomposition of 3d curves.
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Creates a 6-connected sinusoidal curve, like
+ * examples/samples/sinus.dat, with random amplitudes and periods.
+ */
+void sinusCurve( std::vector<Point>& curve, unsigned int nbSamples )
+{
+  double ay = 2.0 + 10.0 * rand() / RAND_MAX;
+  double az = 2.0 + 10.0 * rand() / RAND_MAX;
+  double py = 5.0 + 20.0 * rand() / RAND_MAX;
+  double pz = 5.0 + 20.0 * rand() / RAND_MAX;
+  curve.clear();
+  Point p( 0, 0, (int) std::floor( az + 0.5 ) );
+  curve.push_back( p );
+  for ( unsigned int t = 1; t < nbSamples; ++t )
+    {
+      Point target( t, (int) std::floor( ay * std::sin( t / py ) + 0.5 ),
+                    (int) std::floor( az * std::cos( t / pz ) + 0.5 ) );
+      for ( unsigned int k = 0; k < 3; ++k )
+        while ( p[k] != target[k] )
+          {
+            p[k] += ( p[k] < target[k] ) ? 1 : -1;
+            curve.push_back( p );
+          }
+    }
+}
+
+bool benchmarkDecomposition( unsigned int nbCurves, unsigned int nbSamples )
+{
+  typedef std::vector<Point>::const_iterator Iterator;
+  typedef ArithmeticalDSS3d<Iterator,int,4> SegmentComputer;
+  typedef GreedySegmentation<SegmentComputer> Decomposition;
+  typedef ArithmeticalDSS3dBatch<Point,int,4> Batch;
+
+  trace.beginBlock ( "Creating the curves" );
+  srand( 0 );
+  std::vector< std::vector<Point> > curves( nbCurves );
+  std::size_t nbPoints = 0;
+  for ( unsigned int c = 0; c < nbCurves; ++c )
+    {
+      sinusCurve( curves[c], nbSamples );
+      nbPoints += curves[c].size();
+    }
+  trace.info() << nbCurves << " curves, " << nbPoints << " points" << std::endl;
+  trace.endBlock();
+
+  trace.beginBlock ( "GreedySegmentation<ArithmeticalDSS3d>" );
+  std::size_t nbSegments = 0;
+  for ( unsigned int c = 0; c < nbCurves; ++c )
+    {
+      SegmentComputer algo;
+      Decomposition theDecomposition( curves[c].begin(), curves[c].end(), algo );
+      Decomposition::SegmentComputerIterator i = theDecomposition.begin();
+      for ( ; i != theDecomposition.end(); ++i )
+        ++nbSegments;
+    }
+  trace.info() << nbSegments << " segments" << std::endl;
+  trace.endBlock();
+
+  Batch batch;
+  trace.beginBlock ( "ArithmeticalDSS3dBatch: projections" );
+  batch.reserve( nbCurves, nbPoints );
+  for ( unsigned int c = 0; c < nbCurves; ++c )
+    batch.addCurve( curves[c].begin(), curves[c].end() );
+  trace.endBlock();
+
+  trace.beginBlock ( "ArithmeticalDSS3dBatch: decomposition" );
+  std::size_t nbBatchSegments = batch.decompose();
+  trace.info() << batch << std::endl;
+  trace.endBlock();
+
+  return nbSegments == nbBatchSegments;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Benchmarking the decomposition of 3d curves" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  unsigned int nbCurves = ( argc > 1 ) ? atoi( argv[ 1 ] ) : 10000;
+  unsigned int nbSamples = ( argc > 2 ) ? atoi( argv[ 2 ] ) : 200;
+  bool res = benchmarkDecomposition( nbCurves, nbSamples );
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
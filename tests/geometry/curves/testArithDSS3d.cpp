@@ -47,6 +47,7 @@
 #include "DGtal/kernel/domains/HyperRectDomain.h"
 #include "DGtal/geometry/curves/ArithmeticalDSS3d.h"
 #include "DGtal/geometry/curves/GreedySegmentation.h"
+#include "DGtal/geometry/curves/ArithmeticalDSS3dBatch.h"
 
 using namespace DGtal;
 using namespace std;
@@ -154,6 +155,88 @@ bool testSegmentation()
   return (c==2);
 }
 
+/**
+ * Appends to a 3d curve a 6-connected path to a given point.
+ */
+template <typename Point>
+void pathTo( std::vector<Point>& curve, const Point& target )
+{
+  Point p = curve.back();
+  for ( unsigned int k = 0; k < 3; ++k )
+    while ( p[k] != target[k] )
+      {
+        p[k] += ( p[k] < target[k] ) ? 1 : -1;
+        curve.push_back( p );
+      }
+}
+
+/**
+ * comparison of the batch decomposition with the greedy
+ * segmentation, on sinusoidal curves
+ *
+ */
+bool testBatchDecomposition()
+{
+
+  typedef PointVector<3,int> Point;
+  typedef std::vector<Point>::const_iterator Iterator;
+  typedef ArithmeticalDSS3d<Iterator,int,4> SegmentComputer;
+  typedef GreedySegmentation<SegmentComputer> Decomposition;
+  typedef ArithmeticalDSS3dBatch<Point,int,4> Batch;
+
+  trace.beginBlock("Batch decomposition test");
+
+  //sinusoidal curves, the last one being disconnected
+  std::vector< std::vector<Point> > curves;
+  for ( unsigned int c = 0; c < 6; ++c )
+    {
+      std::vector<Point> curve;
+      curve.push_back( Point( 0, 0, 0 ) );
+      for ( unsigned int t = 1; t < 60; ++t )
+        pathTo( curve, Point( t, (int) std::floor( (3.0+c)*std::sin( t/(5.0+c) ) + 0.5 ),
+                             (int) std::floor( (2.0+c)*std::cos( t/(7.0-c) ) + 0.5 ) ) );
+      curves.push_back( curve );
+    }
+  curves.back().push_back( Point( 100, 100, 100 ) );
+  curves.back().push_back( Point( 101, 100, 100 ) );
+  curves.push_back( std::vector<Point>( 1, Point( 1, 2, 3 ) ) );
+
+  Batch batch;
+  for ( unsigned int c = 0; c < curves.size(); ++c )
+    batch.addCurve( curves[c].begin(), curves[c].end() );
+  batch.decompose();
+  trace.info() << batch << std::endl;
+
+  unsigned int nbok = 0;
+  for ( unsigned int c = 0; c < curves.size(); ++c )
+    {
+      SegmentComputer algo;
+      Decomposition theDecomposition( curves[c].begin(), curves[c].end(), algo );
+      bool same = true;
+      unsigned int k = 0;
+      Decomposition::SegmentComputerIterator i = theDecomposition.begin();
+      for ( ; i != theDecomposition.end(); ++i, ++k )
+        {
+          if ( k >= batch.nbSegments( c ) ) { same = false; break; }
+          std::pair<Batch::Index,Batch::Index> s = batch.segment( c, k );
+          same = same
+            && ( (Batch::Index) ( i->begin() - curves[c].begin() ) == s.first )
+            && ( (Batch::Index) ( i->end() - curves[c].begin() ) == s.second );
+          Point d1, d2;
+          Batch::PointD3d i1, i2, t1, t2;
+          i->getParameters( d1, i1, t1 );
+          batch.getParameters( c, k, d2, i2, t2 );
+          same = same && ( d1 == d2 ) && ( i1 == i2 ) && ( t1 == t2 );
+        }
+      same = same && ( k == batch.nbSegments( c ) );
+      trace.info() << "curve " << c << ": " << k << " segments" << std::endl;
+      if ( same ) ++nbok;
+    }
+
+  trace.endBlock();
+  return ( nbok == curves.size() ) && batch.isValid();
+}
+
 int main(int argc, char **argv)
 {
 
@@ -165,6 +248,7 @@ int main(int argc, char **argv)
 
   bool res = testDSSreco() 
         && testSegmentation()
+        && testBatchDecomposition()
   ;
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
   trace.endBlock();
@@ -0,0 +1,123 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testGeometricalDSS-benchmark.cpp
+ * @ingroup Tests
+ * @author Tristan Roussillon (\c tristan.roussillon@liris.cnrs.fr )
+ * Laboratoire d'InfoRmatique en Image et Systèmes d'information - LIRIS (CNRS, UMR 5205), CNRS, France
+ *
+ * @date 2026/10/19
+ *
+ * Benchmark of the computation of the maximal segments of the
+ * boundary of a digital disk with GeometricalDSS: by forward and
+ * backward extensions (SaturatedSegmentation) versus by retraction
+ * and extension (nextMaximalSegment of a DynamicSegmentComputer).
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <cstdlib>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/shapes/parametric/Ball2D.h"
+#include "DGtal/shapes/GaussDigitizer.h"
+#include "DGtal/topology/helpers/Surfaces.h"
+#include "DGtal/geometry/curves/GridCurve.h"
+#include "DGtal/geometry/curves/GeometricalDSS.h"
+#include "DGtal/geometry/curves/SaturatedSegmentation.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+using namespace DGtal::Z2i;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for benchmarking GeometricalDSS.
+///////////////////////////////////////////////////////////////////////////////
+
+bool benchmarkMaximalSegments( double h )
+{
+  typedef Ball2D<Space> Shape;
+  typedef GridCurve<KSpace>::IncidentPointsRange Range;
+  typedef Range::ConstIterator ConstIterator;
+  typedef GeometricalDSS<ConstIterator> SegmentComputer;
+  typedef SaturatedSegmentation<SegmentComputer> Segmentation;
+
+  trace.beginBlock ( "Digitization of a disk" );
+  Shape ball( RealPoint( 0.3, 0.1 ), 10.0 );
+  GaussDigitizer<Space,Shape> dig;
+  dig.attach( ball );
+  dig.init( ball.getLowerBound() - RealPoint( 1.0, 1.0 ),
+            ball.getUpperBound() + RealPoint( 1.0, 1.0 ), h );
+  KSpace K;
+  K.init( dig.getLowerBound(), dig.getUpperBound(), true );
+  SurfelAdjacency<2> SAdj( true );
+  SCell bel = Surfaces<KSpace>::findABel( K, dig, 1000000 );
+  std::vector<Point> points;
+  Surfaces<KSpace>::track2DBoundaryPoints( points, K, SAdj, dig, bel );
+  GridCurve<KSpace> c;
+  c.initFromVector( points );
+  Range r = c.getIncidentPointsRange();
+  trace.info() << r.size() << " pairs" << std::endl;
+  trace.endBlock();
+
+  trace.beginBlock ( "SaturatedSegmentation (extensions)" );
+  Segmentation theSegmentation( r.begin(), r.end(), SegmentComputer() );
+  unsigned int nb = 0;
+  for ( Segmentation::SegmentComputerIterator it = theSegmentation.begin(),
+          itEnd = theSegmentation.end(); it != itEnd; ++it )
+    ++nb;
+  trace.info() << nb << " maximal segments" << std::endl;
+  trace.endBlock();
+
+  trace.beginBlock ( "nextMaximalSegment (retractions)" );
+  SegmentComputer s;
+  firstMaximalSegment( s, r.begin(), r.begin(), r.end() );
+  unsigned int nb2 = 1;
+  while ( s.end() != r.end() )
+    {
+      nextMaximalSegment( s, r.end(), DynamicSegmentComputer() );
+      ++nb2;
+    }
+  trace.info() << nb2 << " maximal segments" << std::endl;
+  trace.endBlock();
+
+  return nb == nb2;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Benchmarking the maximal segments of GeometricalDSS" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  double h = ( argc > 1 ) ? atof( argv[ 1 ] ) : 0.001;
+  bool res = benchmarkMaximalSegments( h );
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -29,12 +29,14 @@
 
 ///////////////////////////////////////////////////////////////////////////////
 #include <iostream>
+#include <vector>
 #include "DGtal/base/Common.h"
 #include "DGtal/kernel/PointVector.h"
 #include "DGtal/topology/KhalimskySpaceND.h"
 #include "DGtal/geometry/curves/GridCurve.h"
 
 #include "DGtal/geometry/curves/CBidirectionalSegmentComputer.h"
+#include "DGtal/geometry/curves/CDynamicBidirectionalSegmentComputer.h"
 
 #include "DGtal/geometry/curves/GeometricalDSS.h"
 
@@ -185,6 +187,131 @@ void testGeometricalDSSConceptChecking()
    typedef GeometricalDSS<ConstIterator> GeomDSS; 
    BOOST_CONCEPT_ASSERT(( CDrawableWithBoard2D<GeomDSS> ));
    BOOST_CONCEPT_ASSERT(( CBidirectionalSegmentComputer<GeomDSS> ));
+   BOOST_CONCEPT_ASSERT(( CDynamicBidirectionalSegmentComputer<GeomDSS> ));
+}
+
+/**
+ * Retraction: the segments obtained by retraction 
+ * are compared with the segments obtained by extension
+ */
+template <typename TCurve>
+bool testRetraction(const TCurve& curve)
+{
+
+  typedef typename TCurve::IncidentPointsRange Range; //range
+  typedef typename Range::ConstIterator ConstIterator; //iterator
+  typedef GeometricalDSS<ConstIterator> SegmentComputer; //segment computer
+
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  Range r = curve.getIncidentPointsRange(); //range
+  ConstIterator itBegin (r.begin()); 
+  ConstIterator itEnd (r.end()); 
+
+  trace.beginBlock ( "Retraction operations" );
+  {
+    unsigned int nbRetractions = 0; 
+    unsigned int nbErrors = 0; 
+    SegmentComputer s, t; 
+    for (ConstIterator i = itBegin; i != itEnd; ++i) 
+    {
+      //forward retraction
+      s.init( i ); 
+      while ( (s.end() != itEnd) && (s.extendForward()) ) {}
+      while ( s.retractForward() ) 
+      {
+        t.init( s.begin() ); 
+        while ( (t.end() != s.end()) && (t.extendForward()) ) {}
+        if ( (s != t) || (t.end() != s.end()) ) ++nbErrors; 
+        ++nbRetractions; 
+      }
+      if ( s.begin() + 1 != s.end() ) ++nbErrors; 
+
+      //backward retraction
+      s.init( i ); 
+      while ( (s.end() != itEnd) && (s.extendForward()) ) {}
+      while ( s.retractBackward() ) 
+      {
+        t.init( s.begin() ); 
+        while ( (t.end() != s.end()) && (t.extendForward()) ) {}
+        if ( (s != t) || (t.end() != s.end()) ) ++nbErrors; 
+        ++nbRetractions; 
+      }
+      if ( s.begin() != i ) ++nbErrors; 
+    }
+    trace.info() << nbRetractions << " retractions, " 
+                 << nbErrors << " errors" << endl; 
+    nbok += (nbErrors == 0) ? 1 : 0; 
+    nb++;
+  }
+  trace.endBlock();
+
+  trace.beginBlock ( "Retraction and extension" );
+  {
+    //a segment that is retracted and extended again 
+    //is the same as before
+    SegmentComputer s, t; 
+    s.init( itBegin ); 
+    while ( (s.end() != itEnd) && (s.extendForward()) ) {}
+    t = s; 
+    unsigned int k = 0; 
+    while ( (k < 3) && (s.retractBackward()) ) ++k; 
+    while ( (s.end() != itEnd) && (s.extendForward()) ) {}
+    trace.info() << s << t << endl; 
+    nbok += ( (s == t) && (t == SegmentComputer(t)) ) ? 1 : 0; 
+    nb++;
+  }
+  trace.endBlock();
+
+  trace.beginBlock ( "Maximal segments by retraction" );
+  {
+    //maximal segments given by the saturated segmentation
+    typedef SaturatedSegmentation<SegmentComputer> Segmentation;
+    Segmentation theSegmentation( itBegin, itEnd, SegmentComputer() );
+    std::vector<std::pair<ConstIterator,ConstIterator> > segments; 
+    typename Segmentation::SegmentComputerIterator it = theSegmentation.begin();
+    typename Segmentation::SegmentComputerIterator itSegEnd = theSegmentation.end();
+    for ( ; it != itSegEnd; ++it) 
+      segments.push_back( std::make_pair( it->begin(), it->end() ) ); 
+
+    //maximal segments given by retraction and extension
+    SegmentComputer s; 
+    firstMaximalSegment( s, itBegin, itBegin, itEnd ); 
+    std::vector<std::pair<ConstIterator,ConstIterator> > segments2; 
+    segments2.push_back( std::make_pair( s.begin(), s.end() ) ); 
+    while ( s.end() != itEnd ) 
+    {
+      nextMaximalSegment( s, itEnd, DynamicSegmentComputer() ); 
+      segments2.push_back( std::make_pair( s.begin(), s.end() ) ); 
+    }
+    trace.info() << segments.size() << " " << segments2.size() << endl; 
+    nbok += ( segments == segments2 ) ? 1 : 0; 
+    nb++;
+
+    //the saturated segmentation uses the retraction operations
+    //(see SegmentComputerTraits) and gives the same maximal
+    //segments as the forward-only algorithms
+    BOOST_STATIC_ASSERT(( ConceptUtils::SameType
+                          < typename SegmentComputerTraits<SegmentComputer>::Category, 
+                          DynamicBidirectionalSegmentComputer >::value )); 
+    SegmentComputer f; 
+    firstMaximalSegment( f, itBegin, itBegin, itEnd, ForwardSegmentComputer() ); 
+    std::vector<std::pair<ConstIterator,ConstIterator> > segments3; 
+    segments3.push_back( std::make_pair( f.begin(), f.end() ) ); 
+    while ( f.end() != itEnd ) 
+    {
+      nextMaximalSegment( f, itEnd, ForwardSegmentComputer() ); 
+      segments3.push_back( std::make_pair( f.begin(), f.end() ) ); 
+    }
+    trace.info() << segments3.size() << " by forward extensions" << endl; 
+    nbok += ( segments == segments3 ) ? 1 : 0; 
+    nb++;
+  }
+  trace.endBlock();
+
+  trace.info() << "(" << nbok << "/" << nb << ") " << endl;
+  return nbok == nb;
 }
 
 template <typename TCurve>
@@ -298,7 +425,7 @@ int main( int argc, char** argv )
     GridCurve<KSpace> c; //grid curve
     c.initFromVectorStream(instream);
     
-    res = res && testSegmentation(c); 
+    res = res && testSegmentation(c) && testRetraction(c); 
   }
   
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
@@ -0,0 +1,263 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testLabelledImageContours.cpp
+ * @ingroup Tests
+ * @author Jacques-Olivier Lachaud (\c jacques-olivier.lachaud@univ-savoie.fr )
+ * Laboratory of Mathematics (CNRS, UMR 5807), University of Savoie, France
+ *
+ * @date 2026/10/19
+ *
+ * Functions for testing class LabelledImageContours.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/topology/helpers/Surfaces.h"
+#include "DGtal/geometry/curves/GridCurve.h"
+#include "DGtal/geometry/curves/LabelledImageContours.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+using namespace DGtal::Z2i;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class LabelledImageContours.
+///////////////////////////////////////////////////////////////////////////////
+
+typedef ImageContainerBySTLVector<Domain, int> Image;
+typedef LabelledImageContours<KSpace, Image> Contours;
+
+/**
+ * Fills a box of the image with a label.
+ */
+void fillBox( Image & image, const Point & low, const Point & up, int label )
+{
+  Domain box( low, up );
+  for ( Domain::ConstIterator it = box.begin(), itE = box.end();
+        it != itE; ++it )
+    image.setValue( *it, label );
+}
+
+/**
+ * @return 'true' if both extractions gave the same contours.
+ */
+bool sameContours( const Contours & c1, const Contours & c2 )
+{
+  if ( c1.size() != c2.size() ) return false;
+  for ( unsigned int i = 0; i < c1.size(); ++i )
+    if ( ( c1[ i ].label != c2[ i ].label )
+         || ( c1[ i ].isHole != c2[ i ].isHole )
+         || ( c1[ i ].parent != c2[ i ].parent )
+         || ( c1[ i ].firstPoint != c2[ i ].firstPoint )
+         || ( c1[ i ].codes != c2[ i ].codes ) )
+      return false;
+  return true;
+}
+
+/**
+ * Nested regions: a square (label 1), a ring (label 2) whose hole
+ * contains a single pixel (label 3), on a background of label 0.
+ */
+bool testHierarchy()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  Domain domain( Point( 0, 0 ), Point( 19, 13 ) );
+  Image image( domain );
+  fillBox( image, domain.lowerBound(), domain.upperBound(), 0 );
+  fillBox( image, Point( 2, 2 ), Point( 5, 5 ), 1 );
+  fillBox( image, Point( 8, 2 ), Point( 14, 9 ), 2 );
+  fillBox( image, Point( 10, 4 ), Point( 12, 7 ), 0 );
+  fillBox( image, Point( 11, 5 ), Point( 11, 5 ), 3 );
+  KSpace K;
+  K.init( domain.lowerBound() - Point::diagonal( 1 ),
+          domain.upperBound() + Point::diagonal( 1 ), true );
+
+  trace.beginBlock ( "Hierarchy of the foreground contours..." );
+  Contours contours( K, image, SurfelAdjacency<2>( true ) );
+  contours.setBackground( 0 );
+  contours.compute();
+  trace.info() << contours << std::endl;
+  nbok += ( ( contours.size() == 4 ) && ( contours.roots().size() == 2 ) )
+    ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "4 contours, 2 roots" << std::endl;
+  // Raster order: the square and the ring (outer), the hole, the pixel.
+  bool ok = ( contours.size() == 4 )
+    && ( contours[ 0 ].label == 1 ) && ( ! contours[ 0 ].isHole )
+    && ( contours[ 0 ].parent == -1 )
+    && ( contours[ 1 ].label == 2 ) && ( ! contours[ 1 ].isHole )
+    && ( contours[ 1 ].parent == -1 )
+    && ( contours[ 2 ].label == 2 ) && ( contours[ 2 ].isHole )
+    && ( contours[ 2 ].parent == 1 )
+    && ( contours[ 3 ].label == 3 ) && ( ! contours[ 3 ].isHole )
+    && ( contours[ 3 ].parent == 2 )
+    && ( contours[ 1 ].children.size() == 1 )
+    && ( contours[ 2 ].children.size() == 1 );
+  nbok += ok ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "labels, holes and parents" << std::endl;
+  trace.endBlock();
+
+  trace.beginBlock ( "Freeman chains and grid curves..." );
+  unsigned int nbClosed = 0;
+  unsigned int nbLoops = 0;
+  unsigned int nbCurves = 0;
+  for ( unsigned int i = 0; i < contours.size(); ++i )
+    {
+      Contours::FreemanChainType fc = contours.freemanChain( i );
+      if ( fc.isClosed() ) ++nbClosed;
+      int loops = fc.ccwLoops();
+      if ( loops == ( contours[ i ].isHole ? -1 : 1 ) ) ++nbLoops;
+      GridCurve<KSpace> curve( K );
+      contours.getGridCurve( i, curve );
+      if ( curve.isClosed() && ( curve.size() == fc.size() ) ) ++nbCurves;
+      trace.info() << contours[ i ].label << " " << contours[ i ].codes
+                   << std::endl;
+    }
+  nbok += ( nbClosed == contours.size() ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << nbClosed << " closed chains" << std::endl;
+  nbok += ( nbLoops == contours.size() ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << nbLoops << " chains with the expected orientation" << std::endl;
+  nbok += ( nbCurves == contours.size() ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << nbCurves << " grid curves" << std::endl;
+  trace.endBlock();
+
+  trace.beginBlock ( "Contours of the background..." );
+  Contours all( K, image, SurfelAdjacency<2>( true ) );
+  all.compute();
+  unsigned int nbOuter0 = 0;
+  unsigned int nbHoles0 = 0;
+  for ( unsigned int i = 0; i < all.size(); ++i )
+    if ( all[ i ].label == 0 )
+      {
+        if ( all[ i ].isHole ) ++nbHoles0;
+        else ++nbOuter0;
+      }
+  // Two components of label 0: the outer one has two holes, the
+  // one inside the ring has one hole.
+  nbok += ( ( all.size() == 9 ) && ( nbOuter0 == 2 ) && ( nbHoles0 == 3 )
+            && ( all.roots().size() == 1 ) ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << all.size() << " contours, " << nbOuter0 << " outer and "
+               << nbHoles0 << " holes of label 0" << std::endl;
+  trace.endBlock();
+
+  return nbok == nb;
+}
+
+/**
+ * Compares the band mode with the single scan, and the number of
+ * contours with Surfaces::extractAll2DSCellContours, on an image of
+ * pseudo-random blocks.
+ */
+bool testBands()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  Domain domain( Point( -10, -7 ), Point( 40, 33 ) );
+  Image image( domain );
+  unsigned int seed = 17;
+  for ( Domain::ConstIterator it = domain.begin(), itE = domain.end();
+        it != itE; ++it )
+    {
+      Point p = *it;
+      seed = seed * 1103515245 + 12345;
+      int label = ( ( ( p[ 0 ] + 10 ) / 3 + ( p[ 1 ] + 7 ) / 2 ) % 3 + ( seed >> 16 ) % 2 ) % 4;
+      image.setValue( p, label );
+    }
+  KSpace K;
+  K.init( domain.lowerBound() - Point::diagonal( 1 ),
+          domain.upperBound() + Point::diagonal( 1 ), true );
+  SurfelAdjacency<2> SAdj( true );
+
+  trace.beginBlock ( "Single scan versus bands..." );
+  Contours serial( K, image, SAdj );
+  serial.setBackground( 0 );
+  serial.compute();
+  trace.info() << serial << std::endl;
+  bool same = true;
+  for ( unsigned int nbBands = 1; nbBands <= 7; nbBands += 2 )
+    {
+      Contours bands( K, image, SAdj );
+      bands.setBackground( 0 );
+      bands.computeByBands( nbBands );
+      same = same && sameContours( serial, bands );
+    }
+  nbok += same ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "same contours with 1, 3, 5, 7 bands" << std::endl;
+  trace.endBlock();
+
+  trace.beginBlock ( "Comparison with Surfaces::extractAll2DSCellContours..." );
+  unsigned int nbContours = 0;
+  for ( int label = 1; label < 4; ++label )
+    {
+      std::vector< std::vector<SCell> > contours;
+      Surfaces<KSpace>::extractAll2DSCellContours
+        ( contours, K, SAdj,
+          ImageContoursTracker<KSpace, Image>::LabelPredicate( image, label ) );
+      nbContours += contours.size();
+    }
+  nbok += ( nbContours == serial.size() ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << serial.size() << " == " << nbContours
+               << " contours" << std::endl;
+  trace.endBlock();
+
+  return nbok == nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Testing class LabelledImageContours" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  bool res = testHierarchy() && testBands(); // && ... other tests
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
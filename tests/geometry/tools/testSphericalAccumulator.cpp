@@ -200,6 +200,93 @@ bool testSphericalMoreIntegerDir()
   return nbok == nb;
 }
 
+bool testSphericalBatch()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  
+  trace.beginBlock ( "Testing Spherical Accumulator batch insertion and merge ..." );
+  
+  typedef Z3i::RealVector Vector;
+  typedef SphericalAccumulator<Vector>::Size Size;
+  std::vector<Vector> dirs;
+  std::vector<Z3i::Vector> intDirs;
+  unsigned int seed = 7;
+  for(unsigned int k = 0; k < 20000; k++)
+    {
+      double c[3];
+      int ic[3];
+      for(unsigned int d = 0; d < 3; d++)
+        {
+          seed = seed * 1103515245u + 12345u;
+          ic[d] = (int) ((seed >> 8) % 21) - 10;
+          c[d] = ((seed >> 8) & 0xffff) / 32768.0 - 1.0;
+        }
+      dirs.push_back( Vector( c[0], c[1], c[2] ) );
+      if ( (ic[0] != 0) || (ic[1] != 0) || (ic[2] != 0) )
+        intDirs.push_back( Z3i::Vector( ic[0], ic[1], ic[2] ) );
+    }
+  // Directions on the axes and on the bin boundaries of the poles.
+  dirs.push_back( Vector( 0, 0, 1 ) );
+  dirs.push_back( Vector( 0, 0, -1 ) );
+  dirs.push_back( Vector( 1, 0, 0 ) );
+  dirs.push_back( Vector( -1, 0, 0 ) );
+  dirs.push_back( Vector( 0, -1, 0 ) );
+
+  SphericalAccumulator<Vector> accumulator(20);
+  SphericalAccumulator<Vector> batch(20);
+  unsigned int nbSame = 0;
+  for(unsigned int k = 0; k < dirs.size(); k++)
+    {
+      Size i,j,fi,fj;
+      accumulator.binCoordinates( dirs[k], i, j );
+      batch.fastBinCoordinates( dirs[k], fi, fj );
+      nbSame += ( (i == fi) && (j == fj) ) ? 1 : 0;
+      accumulator.addDirection( dirs[k] );
+    }
+  nbok += ( nbSame == dirs.size() ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+	       << nbSame << "/" << dirs.size() << " identical bins without trigonometry" 
+               << std::endl;
+
+  batch.addDirections( dirs.begin(), dirs.end() );
+  Size i1,j1,i2,j2;
+  accumulator.maxCountBin( i1, j1 );
+  batch.maxCountBin( i2, j2 );
+  nbok += ( std::equal( accumulator.begin(), accumulator.end(), batch.begin() )
+            && ( batch.samples() == accumulator.samples() )
+            && ( batch.count( i2, j2 ) == accumulator.count( i1, j1 ) ) ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+	       << "batch insertion " << batch << std::endl;
+
+  // Integer directions, inserted in two accumulators then merged.
+  SphericalAccumulator<Z3i::Vector> single(10);
+  SphericalAccumulator<Z3i::Vector> part1(10);
+  SphericalAccumulator<Z3i::Vector> part2(10);
+  for(unsigned int k = 0; k < intDirs.size(); k++)
+    single.addDirection( intDirs[k] );
+  std::vector<Z3i::Vector>::iterator mid = intDirs.begin() + intDirs.size()/3;
+  part1.addDirections( intDirs.begin(), mid );
+  part2.addDirections( mid, intDirs.end() );
+  part1.merge( part2 );
+  bool sameDirs = true;
+  for(SphericalAccumulator<Z3i::Vector>::ConstIterator it = single.begin(), 
+        it2 = part1.begin(), itend = single.end(); it != itend; ++it, ++it2)
+    sameDirs = sameDirs && ( single.representativeDirection( it ) 
+                             == part1.representativeDirection( it2 ) );
+  nbok += ( std::equal( single.begin(), single.end(), part1.begin() )
+            && sameDirs && ( part1.samples() == (int) intDirs.size() ) ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+	       << "merge " << part1 << std::endl;
+
+  trace.endBlock();
+    
+  return nbok == nb;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // Standard services - public :
 
@@ -212,7 +299,7 @@ int main( int argc, char** argv )
   trace.info() << endl;
 
   bool res = testSphericalAccumulator() && testSphericalMore()
-    && testSphericalMoreIntegerDir();
+    && testSphericalMoreIntegerDir() && testSphericalBatch();
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
   trace.endBlock();
   return res ? 0 : 1;
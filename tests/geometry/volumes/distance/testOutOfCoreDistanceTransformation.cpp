@@ -0,0 +1,201 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testOutOfCoreDistanceTransformation.cpp
+ * @ingroup Tests
+ * @author David Coeurjolly (\c david.coeurjolly@liris.cnrs.fr )
+ * Laboratoire d'InfoRmatique en Image et Systèmes d'information - LIRIS (CNRS, UMR 5205), CNRS, France
+ *
+ * @date 2026/10/19
+ *
+ * Functions for testing class OutOfCoreDistanceTransformation.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <fstream>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/images/imagesSetsUtils/SimpleThresholdForegroundPredicate.h"
+#include "DGtal/io/colormaps/GrayscaleColorMap.h"
+#include "DGtal/io/writers/VolWriter.h"
+#include "DGtal/geometry/volumes/distance/DistanceTransformation.h"
+#include "DGtal/geometry/volumes/distance/OutOfCoreDistanceTransformation.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+typedef ImageContainerBySTLVector<Z3i::Domain, unsigned char> Image;
+typedef SimpleThresholdForegroundPredicate<Image> Predicate;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class OutOfCoreDistanceTransformation.
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * A random volume: foreground everywhere except random seeds, and
+ * three planes without any background.
+ */
+void randomVolume( Image & image, unsigned int nbSeeds )
+{
+  const Z3i::Point ext = image.domain().upperBound() + Z3i::Point::diagonal( 1 );
+  for ( Image::Iterator it = image.begin(), itend = image.end(); it != itend; ++it )
+    *it = 255;
+  for ( unsigned int k = 0; k < nbSeeds; ++k )
+    {
+      Z3i::Point q( rand() % ext[ 0 ], rand() % ext[ 1 ], 3 + rand() % ( ext[ 2 ] - 3 ) );
+      image.setValue( q, 0 );
+    }
+}
+
+/**
+ * Compares the raw output file with the in-core distance transformation.
+ */
+template <typename OutputImage>
+bool sameAsFile( const OutputImage & expected, const std::string & filename )
+{
+  std::ifstream in( filename.c_str(), std::ios::in | std::ios::binary );
+  std::vector<DGtal::int64_t> values( expected.size() );
+  in.read( (char*) &values[ 0 ], values.size() * sizeof( DGtal::int64_t ) );
+  if ( ( ! in ) || ( in.peek() != EOF ) )
+    return false;
+  for ( unsigned int i = 0; i < values.size(); ++i )
+    if ( values[ i ] != expected[ i ] )
+      {
+        trace.info() << "Error at offset " << i << ": " << values[ i ]
+                     << " instead of " << expected[ i ] << std::endl;
+        return false;
+      }
+  return true;
+}
+
+template <DGtal::uint32_t p>
+bool testOutOfCore( const Z3i::Point & extent, unsigned int nbSeeds )
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  typedef DistanceTransformation<Z3i::Space, Predicate, p> DT;
+  typedef OutOfCoreDistanceTransformation<Z3i::Space, p> OOCDT;
+
+  Z3i::Domain domain( Z3i::Point( 0, 0, 0 ), extent - Z3i::Point::diagonal( 1 ) );
+  Image image( domain );
+  randomVolume( image, nbSeeds );
+  {
+    std::ofstream raw( "testOutOfCoreDT.raw", std::ios::out | std::ios::binary );
+    raw.write( (const char*) &image[ 0 ], image.size() );
+  }
+  VolWriter<Image, GrayscaleColorMap<unsigned char> >
+    ::exportVol( "testOutOfCoreDT.vol", image, 0, 255 );
+
+  Predicate predicate( image, 0 );
+  DT dt( domain, predicate );
+  typename DT::OutputImage expected = dt.compute();
+
+  // Room for one plane and a few columns only.
+  const unsigned int memory = extent[ 0 ] * extent[ 1 ] * 17;
+  OOCDT oocdt( memory, "testOutOfCoreDT.scratch" );
+  trace.info() << oocdt << std::endl;
+
+  oocdt.computeFromRaw8( "testOutOfCoreDT.raw", extent, "testOutOfCoreDT.dt" );
+  nbok += sameAsFile( expected, "testOutOfCoreDT.dt" ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "raw input, same values as DistanceTransformation" << std::endl;
+
+  Z3i::Vector volExtent = oocdt.computeFromVol( "testOutOfCoreDT.vol", "testOutOfCoreDT.dt" );
+  nbok += ( ( volExtent == extent ) && sameAsFile( expected, "testOutOfCoreDT.dt" ) ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "vol input, same values as DistanceTransformation" << std::endl;
+
+  std::ifstream scratch( "testOutOfCoreDT.scratch" );
+  nbok += ( ! scratch ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "scratch file removed" << std::endl;
+
+  OOCDT tooSmall( extent[ 0 ] * extent[ 1 ], "testOutOfCoreDT.scratch" );
+  bool thrown = false;
+  try
+    {
+      tooSmall.computeFromRaw8( "testOutOfCoreDT.raw", extent, "testOutOfCoreDT.dt" );
+    }
+  catch ( DGtal::MemoryException & )
+    {
+      thrown = true;
+    }
+  nbok += ( thrown && ! tooSmall.canProcess( extent ) ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "memory budget too small" << std::endl;
+
+  // The input ends too early: the scratch file is removed anyway.
+  thrown = false;
+  try
+    {
+      oocdt.computeFromRaw8( "testOutOfCoreDT.raw", extent, "testOutOfCoreDT.dt",
+                             0, (std::streamoff) extent[ 0 ] * extent[ 1 ] );
+    }
+  catch ( DGtal::IOException & )
+    {
+      thrown = true;
+    }
+  std::ifstream scratch2( "testOutOfCoreDT.scratch" );
+  nbok += ( thrown && ! scratch2 ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "truncated input, scratch file removed" << std::endl;
+
+  std::remove( "testOutOfCoreDT.raw" );
+  std::remove( "testOutOfCoreDT.vol" );
+  std::remove( "testOutOfCoreDT.dt" );
+  return nbok == nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Testing class OutOfCoreDistanceTransformation" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  srand( 0 );
+  trace.beginBlock( "Out-of-core l_2 DT" );
+  bool res = testOutOfCore<2>( Z3i::Point( 23, 17, 19 ), 20 );
+  trace.endBlock();
+  trace.beginBlock( "Out-of-core l_1 DT" );
+  res = res && testOutOfCore<1>( Z3i::Point( 11, 14, 25 ), 10 );
+  trace.endBlock();
+
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
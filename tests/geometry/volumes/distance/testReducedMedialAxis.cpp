@@ -0,0 +1,233 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testReducedMedialAxis.cpp
+ * @ingroup Tests
+ * @author David Coeurjolly (\c david.coeurjolly@liris.cnrs.fr )
+ * Laboratoire d'InfoRmatique en Image et Systèmes d'information - LIRIS (CNRS, UMR 5205), CNRS, France
+ *
+ * @date 2026/10/19
+ *
+ * Functions for testing class ReducedMedialAxis.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <cstdlib>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/images/imagesSetsUtils/SimpleThresholdForegroundPredicate.h"
+#include "DGtal/geometry/volumes/distance/DistanceTransformation.h"
+#include "DGtal/geometry/volumes/distance/ReducedMedialAxis.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class ReducedMedialAxis.
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Fills the image with a union of [nbBalls] random euclidean balls
+ * staying at distance 1 of the domain border.
+ */
+template <typename Image>
+void randomShape( Image & image, unsigned int nbBalls )
+{
+  typedef typename Image::Point Point;
+  typedef typename Image::Domain Domain;
+  const Point lower = image.domain().lowerBound();
+  const Point upper = image.domain().upperBound();
+  for ( unsigned int k = 0; k < nbBalls; ++k )
+    {
+      Point c;
+      for ( Dimension d = 0; d < Point::dimension; ++d )
+        c[ d ] = lower[ d ] + 3 + rand() % ( upper[ d ] - lower[ d ] - 5 );
+      int r = 1 + rand() % 5;
+      for ( typename Domain::ConstIterator it = image.domain().begin(),
+              itend = image.domain().end(); it != itend; ++it )
+        {
+          Point q = *it;
+          bool inside = true;
+          int d2 = 0;
+          for ( Dimension d = 0; d < Point::dimension; ++d )
+            {
+              inside = inside && ( q[ d ] > lower[ d ] ) && ( q[ d ] < upper[ d ] );
+              d2 += ( q[ d ] - c[ d ] ) * ( q[ d ] - c[ d ] );
+            }
+          if ( inside && ( d2 <= r * r ) )
+            image.setValue( q, 1 );
+        }
+    }
+}
+
+/**
+ * Checks that the union of the balls, for the l_p metric (p=1 or
+ * p=2), is exactly the shape.
+ */
+template <DGtal::uint32_t p, typename Image, typename Ball>
+bool checkReconstruction( const Image & image, const std::vector<Ball> & balls )
+{
+  typedef typename Image::Point Point;
+  typedef typename Image::Domain Domain;
+  for ( typename Domain::ConstIterator it = image.domain().begin(),
+          itend = image.domain().end(); it != itend; ++it )
+    {
+      bool covered = false;
+      for ( unsigned int i = 0; ( i < balls.size() ) && ! covered; ++i )
+        {
+          DGtal::int64_t d = 0;
+          for ( Dimension k = 0; k < Point::dimension; ++k )
+            {
+              DGtal::int64_t x = (*it)[ k ] - balls[ i ].center[ k ];
+              d += ( p == 1 ) ? ( x < 0 ? -x : x ) : x * x;
+            }
+          covered = ( d < balls[ i ].radius );
+        }
+      if ( covered != ( image( *it ) != 0 ) )
+        return false;
+    }
+  return true;
+}
+
+template <typename Space, DGtal::uint32_t p>
+bool testRDMA( const typename Space::Point & a, const typename Space::Point & b,
+               unsigned int nbBalls )
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  typedef HyperRectDomain<Space> Domain;
+  typedef ImageContainerBySTLVector<Domain, int> Image;
+  typedef SimpleThresholdForegroundPredicate<Image> Predicate;
+  typedef DistanceTransformation<Space, Predicate, p> DT;
+  typedef typename DT::OutputImage ImageDT;
+  typedef ReducedMedialAxis<ImageDT, p> RDMA;
+
+  Domain domain( a, b );
+  Image image( domain );
+  randomShape( image, nbBalls );
+  unsigned int nbPoints = 0;
+  for ( typename Image::ConstIterator it = image.begin(), itend = image.end();
+        it != itend; ++it )
+    if ( *it != 0 ) ++nbPoints;
+
+  Predicate predicate( image, 0 );
+  DT dt( domain, predicate );
+  ImageDT dtImage = dt.compute();
+
+  RDMA rdma;
+  std::vector<typename RDMA::Ball> balls, ballsSerial;
+  rdma.compute( balls, dtImage );
+  rdma.compute( ballsSerial, dtImage, false );
+  trace.info() << rdma << " " << balls.size() << " balls for "
+               << nbPoints << " points." << std::endl;
+
+  nbok += ( ( balls.size() > 0 ) && ( balls.size() < nbPoints ) ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "0 < #balls < #points" << std::endl;
+
+  bool sameRadii = true;
+  for ( unsigned int i = 0; i < balls.size(); ++i )
+    sameRadii = sameRadii && ( balls[ i ].radius == dtImage( balls[ i ].center ) )
+      && ( balls[ i ].radius > 0 );
+  nbok += sameRadii ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "balls centered on the shape with DT radii" << std::endl;
+
+  bool sameAsSerial = ( balls.size() == ballsSerial.size() );
+  for ( unsigned int i = 0; sameAsSerial && ( i < balls.size() ); ++i )
+    sameAsSerial = ( balls[ i ].center == ballsSerial[ i ].center )
+      && ( balls[ i ].radius == ballsSerial[ i ].radius );
+  nbok += sameAsSerial ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "parallel == serial" << std::endl;
+
+  nbok += checkReconstruction<p>( image, balls ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "union of the balls == shape" << std::endl;
+
+  return nbok == nb;
+}
+
+bool testEmpty()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  typedef ImageContainerBySTLVector<Z2i::Domain, DGtal::int64_t> ImageDT;
+  ImageDT dtImage( Z2i::Domain( Z2i::Point( -3, -3 ), Z2i::Point( 5, 7 ) ) );
+  ReducedMedialAxis<ImageDT> rdma;
+  std::vector<ReducedMedialAxis<ImageDT>::Ball> balls;
+  nbok += ( rdma.compute( balls, dtImage ) == 0 ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "empty shape, no ball" << std::endl;
+
+  // A single square: only its center is needed in l_2.
+  for ( int y = -1; y <= 1; ++y )
+    for ( int x = 0; x <= 2; ++x )
+      dtImage.setValue( Z2i::Point( x, y ), 1 );
+  dtImage.setValue( Z2i::Point( 1, 0 ), 4 );
+  rdma.compute( balls, dtImage );
+  nbok += ( ( balls.size() == 1 ) && ( balls[ 0 ].center == Z2i::Point( 1, 0 ) )
+            && ( balls[ 0 ].radius == 4 ) ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "3x3 square, one ball" << std::endl;
+  return nbok == nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Testing class ReducedMedialAxis" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  srand( 0 );
+  bool res = testEmpty();
+
+  trace.beginBlock( "RDMA l_2 in 2D" );
+  res = res && testRDMA<Z2i::Space, 2>( Z2i::Point( -2, 3 ), Z2i::Point( 40, 35 ), 12 );
+  trace.endBlock();
+  trace.beginBlock( "RDMA l_1 in 2D" );
+  res = res && testRDMA<Z2i::Space, 1>( Z2i::Point( 0, 0 ), Z2i::Point( 31, 27 ), 8 );
+  trace.endBlock();
+  trace.beginBlock( "RDMA l_2 in 3D" );
+  res = res && testRDMA<Z3i::Space, 2>( Z3i::Point( 0, 0, 0 ), Z3i::Point( 18, 15, 17 ), 6 );
+  trace.endBlock();
+
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
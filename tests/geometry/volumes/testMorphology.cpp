@@ -0,0 +1,242 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testMorphology.cpp
+ * @ingroup Tests
+ * @author David Coeurjolly (\c david.coeurjolly@liris.cnrs.fr )
+ * Laboratoire d'InfoRmatique en Image et Systèmes d'information - LIRIS (CNRS, UMR 5205), CNRS, France
+ *
+ * @date 2026/10/19
+ *
+ * Functions for testing class Morphology: the operators are compared
+ * with point by point definitions.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <cstdlib>
+#include <ctime>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/shapes/Shapes.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/geometry/volumes/Morphology.h"
+#include "DigitalSetTestHelpers.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class Morphology.
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @return 'true' iff q is in the structuring element [se] of radius
+ * [r] centered on p.
+ */
+template <typename TPoint, typename TSE>
+bool inElement( const TPoint & p, const TPoint & q, TSE se, double r )
+{
+  TPoint v = q - p;
+  if ( se == 0 ) return v.normInfinity() <= (unsigned int) floor( r );
+  if ( se == 1 ) return v.norm1() <= (unsigned int) floor( r );
+  return v.norm() <= r;
+}
+
+/**
+ * Point by point dilation or erosion of [aSet], as a reference.
+ */
+template <typename TDigitalSet, typename TSE>
+void referenceOperation( TDigitalSet & result, const TDigitalSet & aSet,
+                         TSE se, double r, bool erosion )
+{
+  typedef typename TDigitalSet::Domain Domain;
+  typedef typename Domain::Point Point;
+  const Domain & domain = aSet.domain();
+  int ir = (int) ceil( r );
+  for ( typename Domain::ConstIterator it = domain.begin(); it != domain.end(); ++it )
+    {
+      Domain box( (*it - Point::diagonal( ir )).sup( domain.lowerBound() ),
+                  (*it + Point::diagonal( ir )).inf( domain.upperBound() ) );
+      bool found = false;
+      for ( typename Domain::ConstIterator itq = box.begin();
+            ( itq != box.end() ) && ! found; ++itq )
+        if ( inElement( *it, *itq, se, r )
+             && ( ( aSet.find( *itq ) != aSet.end() ) != erosion ) )
+          found = true;
+      if ( found != erosion ) result.insert( *it );
+    }
+}
+
+/**
+ * Inserts random points and small balls in [aSet].
+ */
+template <typename TDigitalSet>
+void randomSet( TDigitalSet & aSet, int nb )
+{
+  typedef typename TDigitalSet::Domain Domain;
+  typedef typename Domain::Point Point;
+  const Domain & domain = aSet.domain();
+  Point ext = domain.upperBound() - domain.lowerBound();
+  for ( int i = 0; i < nb; ++i )
+    {
+      Point c;
+      for ( Dimension k = 0; k < Point::dimension; ++k )
+        c[ k ] = domain.lowerBound()[ k ] + rand() % ( ext[ k ] + 1 );
+      Shapes<Domain>::addNorm2Ball( aSet, c, rand() % 4 );
+    }
+}
+
+template <typename TDomain>
+bool testSetOperators( const TDomain & domain, int nbBalls )
+{
+  typedef Morphology<TDomain> Morpho;
+  typedef typename DigitalSetSelector
+    < TDomain, BIG_DS + HIGH_BEL_DS >::Type DigitalSet;
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  DigitalSet aSet( domain );
+  randomSet( aSet, nbBalls );
+  trace.info() << "Set of " << aSet.size() << " points in " << domain << std::endl;
+  const char* names[] = { "box", "norm-1 ball", "norm-2 ball" };
+  const double radii[] = { 1.0, 2.0, 2.5 };
+  for ( int se = 0; se < 3; ++se )
+    for ( int j = 0; j < 3; ++j )
+      {
+        DigitalSet dilation( aSet ), erosion( aSet );
+        Morpho::dilate( dilation, (typename Morpho::StructuringElement) se, radii[ j ] );
+        Morpho::erode( erosion, (typename Morpho::StructuringElement) se, radii[ j ] );
+        DigitalSet refDilation( domain ), refErosion( domain );
+        referenceOperation( refDilation, aSet, se, radii[ j ], false );
+        referenceOperation( refErosion, aSet, se, radii[ j ], true );
+        nbok += ( sameSets( dilation, refDilation ) && sameSets( erosion, refErosion ) )
+          ? 1 : 0;
+        nb++;
+        trace.info() << "(" << nbok << "/" << nb << ") " << names[ se ]
+                     << " r=" << radii[ j ] << " dilation=" << dilation.size()
+                     << " erosion=" << erosion.size() << std::endl;
+      }
+
+  DigitalSet opening( aSet ), closing( aSet ), tmp( aSet );
+  Morpho::open( opening, Morpho::NORM2_BALL, 2.5 );
+  Morpho::erode( tmp, Morpho::NORM2_BALL, 2.5 );
+  DigitalSet refOpening( domain );
+  referenceOperation( refOpening, tmp, 2, 2.5, false );
+  Morpho::close( closing, Morpho::BOX, 2 );
+  tmp = aSet;
+  Morpho::dilate( tmp, Morpho::BOX, 2 );
+  DigitalSet refClosing( domain );
+  referenceOperation( refClosing, tmp, 0, 2, true );
+  nbok += ( sameSets( opening, refOpening ) && sameSets( closing, refClosing ) ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") opening=" << opening.size()
+               << " closing=" << closing.size() << std::endl;
+  return nbok == nb;
+}
+
+bool testMorphology()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  srand( 0 );
+  trace.beginBlock ( "Binary operators on 2D sets..." );
+  nbok += testSetOperators( Z2i::Domain( Z2i::Point( -10, 3 ), Z2i::Point( 30, 28 ) ), 30 )
+    ? 1 : 0;
+  nb++;
+  trace.endBlock();
+
+  trace.beginBlock ( "Binary operators on 3D sets..." );
+  nbok += testSetOperators( Z3i::Domain( Z3i::Point( 0, 0, 0 ), Z3i::Point( 14, 11, 9 ) ), 12 )
+    ? 1 : 0;
+  nb++;
+  trace.endBlock();
+
+  trace.beginBlock ( "Gray-level box filters..." );
+  typedef ImageContainerBySTLVector<Z3i::Domain, int> Image;
+  Z3i::Domain domain( Z3i::Point( 0, 0, 0 ), Z3i::Point( 12, 9, 7 ) );
+  Image image( domain );
+  for ( Image::Iterator it = image.begin(); it != image.end(); ++it )
+    *it = rand() % 1000 - 500;
+  Image maxImage( image ), minImage( image );
+  Z3i::Point radii( 3, 1, 2 );
+  Morphology<Z3i::Domain>::maxFilter( maxImage, radii );
+  Morphology<Z3i::Domain>::minFilter( minImage, radii );
+  unsigned int nbErrors = 0;
+  for ( Z3i::Domain::ConstIterator it = domain.begin(); it != domain.end(); ++it )
+    {
+      Z3i::Domain box( ( *it - radii ).sup( domain.lowerBound() ),
+                       ( *it + radii ).inf( domain.upperBound() ) );
+      int vmax = image( *it ), vmin = image( *it );
+      for ( Z3i::Domain::ConstIterator itq = box.begin(); itq != box.end(); ++itq )
+        {
+          vmax = std::max( vmax, image( *itq ) );
+          vmin = std::min( vmin, image( *itq ) );
+        }
+      if ( ( vmax != maxImage( *it ) ) || ( vmin != minImage( *it ) ) ) ++nbErrors;
+    }
+  nbok += ( nbErrors == 0 ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << nbErrors << " errors" << std::endl;
+  trace.endBlock();
+
+  trace.beginBlock ( "Dilation by a large ball vs insertion of balls..." );
+  Z3i::Domain bigDomain( Z3i::Point( 0, 0, 0 ), Z3i::Point( 63, 63, 63 ) );
+  Z3i::DigitalSet aSet( bigDomain );
+  for ( int i = 0; i < 200; ++i )
+    aSet.insert( Z3i::Point( rand() % 64, rand() % 64, rand() % 64 ) );
+  Z3i::DigitalSet byBalls( bigDomain ), byDT( aSet );
+  clock_t c0 = clock();
+  for ( Z3i::DigitalSet::ConstIterator it = aSet.begin(); it != aSet.end(); ++it )
+    Shapes<Z3i::Domain>::addNorm2Ball( byBalls, *it, 12 );
+  clock_t c1 = clock();
+  Morphology<Z3i::Domain>::dilate( byDT, Morphology<Z3i::Domain>::NORM2_BALL, 12 );
+  clock_t c2 = clock();
+  nbok += sameSets( byBalls, byDT ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") " << byDT.size() << " points, "
+               << "balls: " << 1000.0 * ( c1 - c0 ) / CLOCKS_PER_SEC << " ms, "
+               << "distance transformation: " << 1000.0 * ( c2 - c1 ) / CLOCKS_PER_SEC
+               << " ms" << std::endl;
+  trace.endBlock();
+
+  return nbok == nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Testing class Morphology" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  bool res = testMorphology(); // && ... other tests
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
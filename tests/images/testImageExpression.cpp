@@ -0,0 +1,205 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testImageExpression.cpp
+ * @ingroup Tests
+ * @author Tristan Roussillon (\c tristan.roussillon@liris.cnrs.fr )
+ * Laboratoire d'InfoRmatique en Image et Systèmes d'information - LIRIS (CNRS, UMR 5205), CNRS, France
+ *
+ * @date 2026/10/19
+ *
+ * Functions for testing class ImageExpression: expressions evaluated
+ * at once are compared with point by point computations.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <cstdlib>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/images/ImageContainerBySTLMap.h"
+#include "DGtal/images/ImageExpression.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class ImageExpression.
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Absolute value, as a functor.
+ */
+struct AbsoluteValue
+{
+  int operator()( int v ) const { return v < 0 ? -v : v; }
+};
+
+/**
+ * Maximum, as a binary functor.
+ */
+struct Maximum
+{
+  typedef int result_type;
+  int operator()( int a, int b ) const { return a < b ? b : a; }
+};
+
+/**
+ * Fills an image with random values in [-50,50[.
+ */
+template <typename TImage>
+void randomFill( TImage & anImage )
+{
+  typedef typename TImage::Domain Domain;
+  for ( typename Domain::ConstIterator it = anImage.domain().begin(),
+          itE = anImage.domain().end(); it != itE; ++it )
+    anImage.setValue( *it, rand() % 100 - 50 );
+}
+
+bool testImageExpression()
+{
+  typedef ImageContainerBySTLVector<Z2i::Domain, int> Image;
+  typedef ImageContainerBySTLVector<Z2i::Domain, bool> BoolImage;
+  typedef ImageContainerBySTLMap<Z2i::Domain, int> MapImage;
+
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  srand( 0 );
+  Z2i::Domain domain( Z2i::Point( -20, -10 ), Z2i::Point( 40, 25 ) );
+  Z2i::Domain subDomain( Z2i::Point( -5, 0 ), Z2i::Point( 30, 20 ) );
+  Image a( domain ), b( domain ), c( domain ), d( subDomain );
+  randomFill( a );
+  randomFill( b );
+
+  trace.beginBlock ( "Arithmetic and thresholds on images of the same domain..." );
+  imageEvaluate( c, imageThreshold( imageExpression( a ) * 2
+                                    - imageExpression( b ), 10, 255, 0 ) );
+  unsigned int nbErrors = 0;
+  for ( Z2i::Domain::ConstIterator it = domain.begin(); it != domain.end(); ++it )
+    if ( c( *it ) != ( ( 2 * a( *it ) - b( *it ) > 10 ) ? 255 : 0 ) )
+      ++nbErrors;
+  nbok += ( nbErrors == 0 ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << nbErrors << " errors, linear evaluation of "
+               << imageExpression( a ) * 2 - imageExpression( b ) << std::endl;
+
+  imageEvaluate( c, 100 - imageMap<int>( imageExpression( a ), AbsoluteValue() )
+                 / 3 + imageMap( imageExpression( a ), imageExpression( b ),
+                                 Maximum() ) );
+  nbErrors = 0;
+  for ( Z2i::Domain::ConstIterator it = domain.begin(); it != domain.end(); ++it )
+    if ( c( *it ) != 100 - abs( a( *it ) ) / 3 + std::max( a( *it ), b( *it ) ) )
+      ++nbErrors;
+  nbok += ( nbErrors == 0 ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << nbErrors << " errors with functors" << std::endl;
+
+  Image a0( a );
+  imageEvaluate( a, imageExpression( a ) + imageExpression( a ) + 1 );
+  nbErrors = 0;
+  for ( Z2i::Domain::ConstIterator it = domain.begin(); it != domain.end(); ++it )
+    if ( a( *it ) != 2 * a0( *it ) + 1 )
+      ++nbErrors;
+  nbok += ( nbErrors == 0 ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << nbErrors << " errors in place" << std::endl;
+  trace.endBlock();
+
+  trace.beginBlock ( "Other domains and images..." );
+  // Destination on a smaller domain: scanline evaluation.
+  imageEvaluate( d, imageExpression( a ) - imageExpression( b ) );
+  nbErrors = 0;
+  for ( Z2i::Domain::ConstIterator it = subDomain.begin(); it != subDomain.end(); ++it )
+    if ( d( *it ) != a( *it ) - b( *it ) )
+      ++nbErrors;
+  nbok += ( nbErrors == 0 ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << nbErrors << " errors on a subdomain" << std::endl;
+
+  // Images that are not stored in a vector.
+  MapImage m( domain ), mc( subDomain );
+  randomFill( m );
+  imageEvaluate( mc, imageExpression( m ) * imageExpression( b ) );
+  imageEvaluate( c, imageExpression( b ) * imageExpression( m ) );
+  BoolImage bc( domain );
+  imageEvaluate( bc, imageThreshold( imageExpression( m ), 0, true, false ) );
+  nbErrors = 0;
+  for ( Z2i::Domain::ConstIterator it = domain.begin(); it != domain.end(); ++it )
+    {
+      if ( c( *it ) != m( *it ) * b( *it ) ) ++nbErrors;
+      if ( bc( *it ) != ( m( *it ) > 0 ) ) ++nbErrors;
+      if ( subDomain.isInside( *it ) && ( mc( *it ) != c( *it ) ) ) ++nbErrors;
+    }
+  nbok += ( nbErrors == 0 ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << nbErrors << " errors with a map image and a bool image"
+               << std::endl;
+  trace.endBlock();
+
+  return nbok == nb;
+}
+
+bool benchmarkImageExpression()
+{
+  typedef ImageContainerBySTLVector<Z3i::Domain, float> Image;
+  Z3i::Domain domain( Z3i::Point( 0, 0, 0 ), Z3i::Point( 127, 127, 127 ) );
+  Image a( domain ), b( domain ), c( domain );
+  randomFill( a );
+  randomFill( b );
+
+  trace.beginBlock ( "Point by point evaluation" );
+  for ( Z3i::Domain::ConstIterator it = domain.begin(), itE = domain.end();
+        it != itE; ++it )
+    c.setValue( *it, ( a( *it ) * 0.5f + b( *it ) > 0.0f ) ? 1.0f : 0.0f );
+  trace.endBlock();
+  Image ref( c );
+
+  trace.beginBlock ( "Fused evaluation" );
+  imageEvaluate( c, imageThreshold( imageExpression( a ) * 0.5f
+                                    + imageExpression( b ), 0.0f, 1.0f, 0.0f ) );
+  trace.endBlock();
+  return std::equal( c.begin(), c.end(), ref.begin() );
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Testing class ImageExpression" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  bool res = testImageExpression() && benchmarkImageExpression(); // && ... other tests
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
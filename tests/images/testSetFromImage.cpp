@@ -0,0 +1,167 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testSetFromImage.cpp
+ * @ingroup Tests
+ * @author David Coeurjolly (\c david.coeurjolly@liris.cnrs.fr )
+ * Laboratoire d'InfoRmatique en Image et Systèmes d'information - LIRIS (CNRS, UMR 5205), CNRS, France
+ *
+ * @date 2026/10/19
+ *
+ * Functions for testing the bulk conversions of SetFromImage and
+ * ImageFromSet, compared with the point by point conversions.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <cstdlib>
+#include <algorithm>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/images/imagesSetsUtils/SetFromImage.h"
+#include "DGtal/images/imagesSetsUtils/ImageFromSet.h"
+#include "DGtal/kernel/sets/DigitalSetBySTLVector.h"
+#include "DigitalSetTestHelpers.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing the bulk conversions between sets and images.
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Fills an image with random values in [0,100[.
+ */
+template <typename TImage>
+void randomFill( TImage & anImage )
+{
+  typedef typename TImage::Domain Domain;
+  for ( typename Domain::ConstIterator it = anImage.domain().begin(),
+          itE = anImage.domain().end(); it != itE; ++it )
+    anImage.setValue( *it, rand() % 100 );
+}
+
+bool testSetFromImage()
+{
+  typedef ImageContainerBySTLVector<Z2i::Domain, unsigned char> Image2;
+  typedef ImageContainerBySTLVector<Z3i::Domain, int> Image3;
+  typedef DigitalSetBySTLVector<Z3i::Domain> VectorSet3;
+
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  srand( 0 );
+
+  trace.beginBlock ( "SetFromImage::appendRuns..." );
+  Z2i::Domain domain2( Z2i::Point( -7, 3 ), Z2i::Point( 150, 41 ) );
+  Image2 image2( domain2 );
+  randomFill( image2 );
+  Z2i::DigitalSet s2( domain2 ), ref2( domain2 );
+  SetFromImage<Z2i::DigitalSet>::append<Image2>( ref2, image2, 20, 60 );
+  SetFromImage<Z2i::DigitalSet>::appendRuns( s2, image2, 20, 60 );
+  nbok += ( sameSets( s2, ref2 ) && std::equal( s2.begin(), s2.end(), ref2.begin() ) )
+    ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << s2.size() << " points in 2D" << std::endl;
+
+  Z3i::Domain domain3( Z3i::Point( 0, -5, 2 ), Z3i::Point( 90, 17, 30 ) );
+  Image3 image3( domain3 );
+  randomFill( image3 );
+  Z3i::DigitalSet s3( domain3 ), ref3( domain3 );
+  SetFromImage<Z3i::DigitalSet>::append<Image3>( ref3, image3, 50, 99 );
+  SetFromImage<Z3i::DigitalSet>::appendRuns( s3, image3, 50, 99 );
+  VectorSet3 v3( domain3 );
+  SetFromImage<VectorSet3>::appendRuns( v3, image3, 50, 99, false );
+  nbok += ( sameSets( s3, ref3 ) && sameSets( v3, ref3 )
+            && std::equal( v3.begin(), v3.end(), ref3.begin() ) ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << s3.size() << " points in 3D, sorted in a vector" << std::endl;
+
+  // Appending to a non empty set.
+  SetFromImage<Z3i::DigitalSet>::append<Image3>( ref3, image3, 10, 70 );
+  SetFromImage<Z3i::DigitalSet>::appendRuns( s3, image3, 10, 70 );
+  nbok += sameSets( s3, ref3 ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << s3.size() << " points after a second append" << std::endl;
+  trace.endBlock();
+
+  trace.beginBlock ( "ImageFromSet::appendRuns..." );
+  // Points of the set partly outside the domain of the image.
+  Z3i::Domain subDomain( Z3i::Point( 10, -2, 5 ), Z3i::Point( 60, 17, 20 ) );
+  Image3 image( subDomain ), ref( subDomain );
+  ImageFromSet<Image3>::append<Z3i::DigitalSet>( ref, s3, 7 );
+  ImageFromSet<Image3>::appendRuns( image, s3, 7 );
+  nbok += std::equal( image.begin(), image.end(), ref.begin() ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "same image as point by point" << std::endl;
+  trace.endBlock();
+
+  return nbok == nb;
+}
+
+bool benchmarkSetFromImage()
+{
+  typedef ImageContainerBySTLVector<Z3i::Domain, unsigned char> Image;
+  Z3i::Domain domain( Z3i::Point( 0, 0, 0 ), Z3i::Point( 99, 99, 99 ) );
+  Image image( domain );
+  randomFill( image );
+  Z3i::DigitalSet s( domain ), ref( domain );
+
+  trace.beginBlock ( "Point by point threshold" );
+  SetFromImage<Z3i::DigitalSet>::append<Image>( ref, image, 30, 99 );
+  trace.endBlock();
+  trace.beginBlock ( "Threshold by slabs" );
+  SetFromImage<Z3i::DigitalSet>::appendRuns( s, image, 30, 99 );
+  trace.endBlock();
+
+  Image image2( domain ), ref2( domain );
+  trace.beginBlock ( "Point by point image" );
+  ImageFromSet<Image>::append<Z3i::DigitalSet>( ref2, s, 1 );
+  trace.endBlock();
+  trace.beginBlock ( "Image by runs" );
+  ImageFromSet<Image>::appendRuns( image2, s, 1 );
+  trace.endBlock();
+  return sameSets( s, ref )
+    && std::equal( image2.begin(), image2.end(), ref2.begin() );
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Testing SetFromImage and ImageFromSet" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  bool res = testSetFromImage() && benchmarkSetFromImage(); // && ... other tests
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
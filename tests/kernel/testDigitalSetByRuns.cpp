@@ -0,0 +1,231 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testDigitalSetByRuns.cpp
+ * @ingroup Tests
+ * @author Jacques-Olivier Lachaud (\c jacques-olivier.lachaud@univ-savoie.fr )
+ * Laboratory of Mathematics (CNRS, UMR 5807), University of Savoie, France
+ *
+ * @date 2026/10/19
+ *
+ * Functions for testing class DigitalSetByRuns: the run-wise set
+ * operations are compared with DigitalSetBySTLSet.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <cstdlib>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/kernel/sets/CDigitalSet.h"
+#include "DGtal/kernel/sets/DigitalSetInserter.h"
+#include "DGtal/kernel/sets/DigitalSetByRuns.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DigitalSetTestHelpers.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class DigitalSetByRuns.
+///////////////////////////////////////////////////////////////////////////////
+
+typedef DigitalSetByRuns<Z3i::Domain> RunSet;
+
+/**
+ * Inserts in both sets the points of a few random boxes.
+ */
+void randomBoxes( RunSet & s, Z3i::DigitalSet & ref, int nb )
+{
+  const Z3i::Domain & domain = s.domain();
+  Z3i::Point ext = domain.upperBound() - domain.lowerBound();
+  for ( int i = 0; i < nb; ++i )
+    {
+      Z3i::Point a, b;
+      for ( Dimension k = 0; k < 3; ++k )
+        {
+          a[ k ] = domain.lowerBound()[ k ] + rand() % ( ext[ k ] + 1 );
+          b[ k ] = std::min( a[ k ] + rand() % 8, domain.upperBound()[ k ] );
+        }
+      Z3i::Domain box( a, b );
+      for ( Z3i::Domain::ConstIterator it = box.begin(); it != box.end(); ++it )
+        {
+          s.insert( *it );
+          ref.insert( *it );
+        }
+    }
+}
+
+bool testDigitalSetByRuns()
+{
+  BOOST_CONCEPT_ASSERT(( CDigitalSet< RunSet > ));
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Insertions, deletions and iteration..." );
+  Z3i::Domain domain( Z3i::Point( -5, 0, 2 ), Z3i::Point( 30, 20, 17 ) );
+  srand( 0 );
+  RunSet a( domain );
+  Z3i::DigitalSet refA( domain );
+  randomBoxes( a, refA, 40 );
+  unsigned int nbErrors = 0;
+  for ( int i = 0; i < 500; ++i )
+    {
+      Z3i::Point p( -5 + rand() % 36, rand() % 21, 2 + rand() % 16 );
+      if ( rand() % 2 ) { a.insert( p ); refA.insert( p ); }
+      else if ( a.erase( p ) != refA.erase( p ) ) ++nbErrors;
+    }
+  nbok += ( nbErrors == 0 ) && sameSets( a, refA ) && sameSets( refA, a )
+    && a.isValid() ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") " << a
+               << " vs " << refA.size() << " points" << std::endl;
+  unsigned int nbForward = 0, nbBackward = 0;
+  Z3i::Point last;
+  bool ordered = true;
+  for ( RunSet::ConstIterator it = a.begin(); it != a.end(); ++it, ++nbForward )
+    {
+      if ( ( nbForward > 0 ) && ( &a.runs( *it ) == &a.runs( last ) )
+           && ( (*it)[ 0 ] <= last[ 0 ] ) )
+        ordered = false;
+      last = *it;
+    }
+  RunSet::ConstIterator it = a.end();
+  while ( it != a.begin() ) { --it; ++nbBackward; }
+  nbok += ordered && ( nbForward == a.size() ) && ( nbBackward == a.size() ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << nbForward << " points forward, " << nbBackward
+               << " points backward" << std::endl;
+  Z3i::Point lower, upper, refLower, refUpper;
+  a.computeBoundingBox( lower, upper );
+  refA.computeBoundingBox( refLower, refUpper );
+  nbok += ( lower == refLower ) && ( upper == refUpper ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "bounding box " << lower << " " << upper << std::endl;
+  trace.endBlock();
+
+  trace.beginBlock ( "Union, intersection, difference, complement..." );
+  RunSet b( domain );
+  Z3i::DigitalSet refB( domain );
+  randomBoxes( b, refB, 60 );
+  RunSet u( a ), i( a ), d( a ), c( domain );
+  u += b;
+  i *= b;
+  d -= b;
+  c.assignFromComplement( a );
+  Z3i::DigitalSet refU( refA ), refI( domain ), refD( domain ), refC( domain );
+  refU += refB;
+  for ( Z3i::Domain::ConstIterator itp = domain.begin(); itp != domain.end(); ++itp )
+    {
+      bool inA = refA.find( *itp ) != refA.end();
+      bool inB = refB.find( *itp ) != refB.end();
+      if ( inA && inB ) refI.insert( *itp );
+      if ( inA && ! inB ) refD.insert( *itp );
+      if ( ! inA ) refC.insert( *itp );
+    }
+  nbok += sameSets( u, refU ) && u.isValid() ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") union " << u << std::endl;
+  nbok += sameSets( i, refI ) && i.isValid() ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") intersection " << i << std::endl;
+  nbok += sameSets( d, refD ) && d.isValid() ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") difference " << d << std::endl;
+  nbok += sameSets( c, refC ) && c.isValid() ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") complement " << c << std::endl;
+  Z3i::DigitalSet c2( domain );
+  DigitalSetInserter<Z3i::DigitalSet> inserter( c2 );
+  a.computeComplement( inserter );
+  nbok += sameSets( c2, refC ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") computeComplement" << std::endl;
+  trace.endBlock();
+
+  trace.beginBlock ( "Sets with different domains..." );
+  Z3i::Domain subdomain( Z3i::Point( 0, 2, 4 ), Z3i::Point( 20, 15, 12 ) );
+  RunSet e( subdomain );
+  Z3i::DigitalSet refE( subdomain );
+  randomBoxes( e, refE, 20 );
+  RunSet ue( a ), ie( a );
+  ue += e;
+  ie *= e;
+  Z3i::DigitalSet refUE( refA ), refIE( domain );
+  refUE += refE;
+  for ( Z3i::DigitalSet::ConstIterator itp = refA.begin(); itp != refA.end(); ++itp )
+    if ( refE.find( *itp ) != refE.end() ) refIE.insert( *itp );
+  nbok += sameSets( ue, refUE ) && sameSets( ie, refIE ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "union and intersection, point by point" << std::endl;
+  trace.endBlock();
+
+  trace.beginBlock ( "Conversions to and from images..." );
+  typedef ImageContainerBySTLVector<Z3i::Domain, int> Image;
+  Image image( domain );
+  d.fillImage( image, 5 );
+  i.fillImage( image, 10 );
+  RunSet fromImage( domain );
+  fromImage.assignFromImage( image, 4, 10 );
+  RunSet fromImage2( domain );
+  fromImage2.assignFromImage( image, 6, 10 );
+  nbok += sameSets( fromImage, a ) && sameSets( fromImage2, i )
+    && fromImage.isValid() ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") " << fromImage
+               << " " << fromImage2 << std::endl;
+  Image subimage( subdomain );
+  a.fillImage( subimage, 1 );
+  RunSet fromSubimage( domain );
+  fromSubimage.assignFromImage( subimage, 0, 1 );
+  Z3i::DigitalSet refSub( domain );
+  for ( Z3i::DigitalSet::ConstIterator itp = refA.begin(); itp != refA.end(); ++itp )
+    if ( subdomain.isInside( *itp ) ) refSub.insert( *itp );
+  nbok += sameSets( fromSubimage, refSub ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "image on a subdomain " << fromSubimage << std::endl;
+  trace.endBlock();
+
+  return nbok == nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Testing class DigitalSetByRuns" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  bool res = testDigitalSetByRuns(); // && ... other tests
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,255 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testHybridInteger.cpp
+ * @ingroup Tests
+ * @author Jacques-Olivier Lachaud (\c jacques-olivier.lachaud@univ-savoie.fr )
+ * Laboratory of Mathematics (CNRS, UMR 5127), University of Savoie, France
+ *
+ * @date 2026/10/19
+ *
+ * Functions for testing class HybridInteger.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/kernel/CInteger.h"
+#include "DGtal/kernel/HybridInteger.h"
+#include "DGtal/arithmetic/IntegerComputer.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class HybridInteger.
+///////////////////////////////////////////////////////////////////////////////
+
+/// @return the big integer n, through its decimal writing.
+BigInteger toBig( const HybridInteger & n )
+{
+  std::ostringstream os;
+  os << n;
+  return BigInteger( os.str() );
+}
+
+/// @return 'true' iff n is the big integer m, in its normal representation.
+bool same( const HybridInteger & n, const BigInteger & m )
+{
+  return n.isValid() && ( toBig( n ) == m ) && ( n.bigValue() == m );
+}
+
+/// Values around the 64 bits limits, random ones, and big ones.
+void someValues( std::vector<BigInteger> & values )
+{
+  const BigInteger two63 = BigInteger( 1 ) << 63;
+  const BigInteger base[] = { 0, 1, 2, 3, 7, 1000, 1 << 20, 
+                              BigInteger( 1 ) << 31, BigInteger( 1 ) << 32,
+                              ( BigInteger( 1 ) << 62 ) - 1, BigInteger( 1 ) << 62,
+                              two63 - 2, two63 - 1, two63, two63 + 1,
+                              two63 * 2, two63 * two63 - 1 };
+  values.clear();
+  for ( unsigned int i = 0; i < sizeof( base ) / sizeof( BigInteger ); ++i )
+    {
+      values.push_back( base[ i ] );
+      if ( base[ i ] != 0 ) values.push_back( -base[ i ] );
+    }
+  for ( unsigned int i = 0; i < 20; ++i )
+    {
+      BigInteger r = random();
+      r = ( r << 31 ) + random();
+      r = ( r << ( random() % 20 ) ) + random();
+      values.push_back( ( i % 2 == 0 ) ? r : BigInteger( -r ) );
+    }
+}
+
+bool testConcept()
+{
+  BOOST_CONCEPT_ASSERT(( CInteger<HybridInteger> ));
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  trace.beginBlock ( "Testing block: representation and traits." );
+  HybridInteger a;
+  HybridInteger b = 17;
+  HybridInteger c( BigInteger( 1 ) << 100 );
+  HybridInteger d( ( BigInteger( 1 ) << 100 ) - ( BigInteger( 1 ) << 100 ) + 5 );
+  nbok += ( a.isSmall() && ( a.smallValue() == 0 ) ) ? 1 : 0;
+  nb++;
+  nbok += ( b.isSmall() && ( b.smallValue() == 17 ) ) ? 1 : 0;
+  nb++;
+  nbok += ( ! c.isSmall() && same( c, BigInteger( 1 ) << 100 ) ) ? 1 : 0;
+  nb++;
+  nbok += ( d.isSmall() && ( d == 5 ) ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "a=" << a << " b=" << b << " c=" << c << " d=" << d << std::endl;
+  nbok += ( NumberTraits<HybridInteger>::ZERO == 0 ) 
+    && ( NumberTraits<HybridInteger>::ONE == 1 ) ? 1 : 0;
+  nb++;
+  nbok += ( NumberTraits<HybridInteger>::odd( b ) 
+            && NumberTraits<HybridInteger>::even( c )
+            && NumberTraits<HybridInteger>::odd( c + 1 ) ) ? 1 : 0;
+  nb++;
+  nbok += ( ( NumberTraits<HybridInteger>::castToInt64_t( b ) == 17 )
+            && ( NumberTraits<HybridInteger>::castToDouble( c ) == ldexp( 1.0, 100 ) ) ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "NumberTraits<HybridInteger>" << std::endl;
+  std::istringstream is( "-123456789012345678901234567890 42" );
+  is >> a >> b;
+  nbok += ( same( a, BigInteger( "-123456789012345678901234567890" ) ) 
+            && b.isSmall() && ( b == 42 ) ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "read " << a << " " << b << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+
+bool testArithmetic()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  trace.beginBlock ( "Testing block: arithmetic against BigInteger." );
+  std::vector<BigInteger> values;
+  someValues( values );
+  unsigned int nbErrors = 0;
+  unsigned int nbOperations = 0;
+  for ( unsigned int i = 0; i < values.size(); ++i )
+    for ( unsigned int j = 0; j < values.size(); ++j )
+      {
+        const BigInteger & x = values[ i ];
+        const BigInteger & y = values[ j ];
+        const HybridInteger a( x ), b( y );
+        unsigned int e = nbErrors;
+        if ( ! same( a + b, x + y ) ) ++nbErrors;
+        if ( ! same( a - b, x - y ) ) ++nbErrors;
+        if ( ! same( a * b, x * y ) ) ++nbErrors;
+        if ( y != 0 )
+          {
+            if ( ! same( a / b, x / y ) ) ++nbErrors;
+            if ( ! same( a % b, x % y ) ) ++nbErrors;
+          }
+        HybridInteger c( a );
+        c += b; c -= a; c *= a;
+        if ( ! same( c, y * x ) ) ++nbErrors;
+        if ( ( ( a < b ) != ( x < y ) ) || ( ( a <= b ) != ( x <= y ) )
+             || ( ( a > b ) != ( x > y ) ) || ( ( a >= b ) != ( x >= y ) )
+             || ( ( a == b ) != ( x == y ) ) || ( ( a != b ) != ( x != y ) ) )
+          ++nbErrors;
+        nbOperations += 10;
+        if ( ( e != nbErrors ) && ( e == 0 ) )
+          trace.warning() << "Error with " << x << " and " << y << std::endl;
+      }
+  for ( unsigned int i = 0; i < values.size(); ++i )
+    {
+      const BigInteger & x = values[ i ];
+      HybridInteger a( x );
+      HybridInteger b = a++;
+      if ( ! same( a, x + 1 ) || ! same( b, x ) ) ++nbErrors;
+      --a; --a;
+      if ( ! same( a, x - 1 ) || ! same( -a, 1 - x ) ) ++nbErrors;
+      if ( ! same( ++a, x ) || ! same( a--, x ) || ! same( a, x - 1 ) ) ++nbErrors;
+      nbOperations += 8;
+    }
+  nbok += ( nbErrors == 0 ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << nbOperations << " operations, nbErrors=" << nbErrors << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+
+bool testIntegerComputer()
+{
+  typedef IntegerComputer<HybridInteger> HIC;
+  typedef IntegerComputer<BigInteger> BIC;
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  trace.beginBlock ( "Testing block: IntegerComputer<HybridInteger>." );
+  HIC hic;
+  BIC bic;
+  std::vector<BigInteger> values;
+  someValues( values );
+  unsigned int nbErrors = 0;
+  for ( unsigned int i = 0; i < values.size(); ++i )
+    for ( unsigned int j = 0; j < values.size(); ++j )
+      {
+        const BigInteger & x = values[ i ];
+        const BigInteger & y = values[ j ];
+        const HybridInteger a( x ), b( y );
+        if ( ! same( hic.gcd( a, b ), bic.gcd( x, y ) ) ) ++nbErrors;
+        if ( y == 0 ) continue;
+        HybridInteger q, r, fl, ce;
+        BigInteger bq, br, bfl, bce;
+        hic.getEuclideanDiv( q, r, a, b );
+        bic.getEuclideanDiv( bq, br, x, y );
+        if ( ! same( q, bq ) || ! same( r, br ) ) ++nbErrors;
+        if ( ! same( hic.floorDiv( a, b ), bic.floorDiv( x, y ) ) ) ++nbErrors;
+        if ( ! same( hic.ceilDiv( a, b ), bic.ceilDiv( x, y ) ) ) ++nbErrors;
+        hic.getFloorCeilDiv( fl, ce, a, b );
+        bic.getFloorCeilDiv( bfl, bce, x, y );
+        if ( ! same( fl, bfl ) || ! same( ce, bce ) ) ++nbErrors;
+        if ( ( x > 0 ) && ( y > 0 ) )
+          {
+            std::vector<HybridInteger> hq;
+            std::vector<BigInteger> bq2;
+            hic.getCFrac( hq, a, b );
+            bic.getCFrac( bq2, x, y );
+            bool sameCFrac = hq.size() == bq2.size();
+            for ( unsigned int k = 0; sameCFrac && ( k < hq.size() ); ++k )
+              sameCFrac = same( hq[ k ], bq2[ k ] );
+            if ( ! sameCFrac ) ++nbErrors;
+            HIC::Vector2I hv = hic.extendedEuclid( a, b, 1 );
+            BIC::Vector2I bv = bic.extendedEuclid( x, y, 1 );
+            if ( ! same( hv[ 0 ], bv[ 0 ] ) || ! same( hv[ 1 ], bv[ 1 ] ) ) 
+              ++nbErrors;
+          }
+      }
+  nbok += ( nbErrors == 0 ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "same results as IntegerComputer<BigInteger>, nbErrors="
+               << nbErrors << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Testing class HybridInteger" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  bool res = testConcept() && testArithmetic() && testIntegerComputer();
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -102,6 +102,148 @@ bool testAngleLinearMinimizer()
 
 
 
+/**
+ * Fills a closed curve of [n] noisy tangent directions turning once,
+ * with bounds around them.
+ */
+void fillClosedCurve( AngleLinearMinimizer & alm, unsigned int n )
+{
+  alm.init( n );
+  alm.setIsCurveOpen( false );
+  unsigned int seed = 17;
+  for ( unsigned int i = 0; i < n; ++i )
+    {
+      seed = seed * 1103515245u + 12345u;
+      double r1 = ( ( seed >> 8 ) & 0xffff ) / 65536.0;
+      seed = seed * 1103515245u + 12345u;
+      double r2 = ( ( seed >> 8 ) & 0xffff ) / 65536.0;
+      AngleLinearMinimizer::ValueInfo & vi = alm.rw( i );
+      double val = 2.0 * M_PI * i / n + 0.3 * ( r1 - 0.5 );
+      vi.value = AngleComputer::cast( val );
+      vi.oldValue = vi.value;
+      vi.min = AngleComputer::cast( val - 0.02 - 0.1 * r2 );
+      vi.max = AngleComputer::cast( val + 0.02 + 0.1 * ( 1.0 - r2 ) );
+      vi.distToNext = 0.5 + r2;
+    }
+}
+
+/// @return the max deviation between the values of two minimizers.
+double maxDeviation( const AngleLinearMinimizer & alm1, 
+                     const AngleLinearMinimizer & alm2 )
+{
+  double d = 0.0;
+  for ( unsigned int i = 0; i < alm1.size(); ++i )
+    d = std::max( d, fabs( AngleComputer::deviation( alm1.ro( i ).value,
+                                                     alm2.ro( i ).value ) ) );
+  return d;
+}
+
+/**
+ * Checks the direct solver against the relaxation, and the
+ * incremental update against a complete solve.
+ */
+bool testAngleLinearMinimizerByDirectSolver()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  
+  trace.beginBlock ( "Testing AngleLinearMinimizerByDirectSolver ." );
+  // Same open curve as above.
+  AngleLinearMinimizerByDirectSolver alm;
+  alm.init(10);
+  alm.setIsCurveOpen(true);
+  double valDec [10] = {0.8, 0.3, -0.2, -0.2, -0.1, -0.3, -3.0, -6.0,  -7.0, -8.0};
+  double valDecMin [10] = {-0.5, -0.2, -0.5, -0.2, -0.1, -1.0, -1.2, -0.5,  -0.3, -0.2};
+  double valDecMax [10] = {0.9, 0.3, 0.2, 1.2, 0.4, 1.0, 0.5, 0.2,  0.1, 0.3};
+  for(unsigned int i=0; i<10; i++){
+    AngleLinearMinimizer::ValueInfo &vi= alm.rw(i);
+    double val = i + valDec[i];
+    vi.value = val;
+    vi.oldValue = val;
+    vi.min = val + valDecMin[i];
+    vi.max = val + valDecMax[i];
+    vi.distToNext = 4.0;    
+  }
+  alm.optimize();
+  double delta = alm.optimize();
+  nbok += ( delta < 1e-12 ) && (abs(1.6-alm.ro(0).value)<1e-9) 
+    && (abs(1.6-alm.ro(1).value)<1e-9) && (abs(2.45-alm.ro(6).value)<1e-9) ? 1 : 0; 
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+	       << "open curve, " << alm.nbIterations() << " iterations, delta=" 
+               << delta << std::endl;
+
+  // Closed curve: the relaxation converges to the same values.
+  const unsigned int n = 200;
+  AngleLinearMinimizerByRelaxation relax;
+  AngleLinearMinimizerByDirectSolver direct;
+  fillClosedCurve( relax, n );
+  fillClosedCurve( direct, n );
+  unsigned int nbSweeps = 0;
+  while ( ( relax.optimize() > 1e-12 ) && ( nbSweeps < 100000 ) ) 
+    ++nbSweeps;
+  direct.optimize();
+  unsigned int nbActive = 0;
+  for ( unsigned int i = 0; i < n; ++i ) 
+    nbActive += direct.isActive( i ) ? 1 : 0;
+  double d = maxDeviation( relax, direct );
+  nbok += ( d < 1e-6 ) && ( nbActive > 0 ) && ( nbActive < n ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+	       << "closed curve, " << nbSweeps << " sweeps, " 
+               << direct.nbIterations() << " iterations, " << nbActive << " active, max deviation=" << d 
+               << " energy=" << direct.getEnergy( 0, 0 ) << std::endl;
+
+  // Incremental update after a local change of the bounds.
+  AngleLinearMinimizerByDirectSolver full;
+  fillClosedCurve( full, n );
+  for ( unsigned int i = 100; i < 106; ++i )
+    {
+      AngleLinearMinimizer::ValueInfo & vi = direct.rw( i );
+      vi.min = AngleComputer::cast( vi.min + 0.2 );
+      vi.max = AngleComputer::cast( vi.max + 0.2 );
+      full.rw( i ).min = vi.min;
+      full.rw( i ).max = vi.max;
+    }
+  direct.update( 100, 106 );
+  full.optimize();
+  d = maxDeviation( full, direct );
+  nbok += ( d < 1e-9 ) && ( direct.nbSolvedValues() < n ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+	       << "update of " << direct.nbSolvedValues() << " values, "
+               << "max deviation=" << d << std::endl;
+
+  // Bounds active nowhere: the values turn regularly.
+  for ( unsigned int i = 0; i < n; ++i )
+    {
+      full.rw( i ).min = AngleComputer::cast( full.ro( i ).value - 1.0 );
+      full.rw( i ).max = AngleComputer::cast( full.ro( i ).value + 1.0 );
+    }
+  full.optimize();
+  nbActive = 0;
+  for ( unsigned int i = 0; i < n; ++i ) 
+    nbActive += full.isActive( i ) ? 1 : 0;
+  d = 0.0;
+  const double flux0 = AngleComputer::deviation( full.ro( 1 ).value, full.ro( 0 ).value )
+    / full.ro( 0 ).distToNext;
+  for ( unsigned int i = 0; i < n; ++i )
+    {
+      const double flux = AngleComputer::deviation( full.ro( ( i + 1 ) % n ).value,
+                                                    full.ro( i ).value )
+        / full.ro( i ).distToNext;
+      d = std::max( d, fabs( flux - flux0 ) );
+    }
+  // (AngleComputer::cast rounds 2pi to a float)
+  nbok += ( nbActive == 0 ) && ( d < 1e-6 ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+	       << "no active bound (" << nbActive << "), flux deviation=" << d << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+
+
 ///////////////////////////////////////////////////////////////////////////////
 // Standard services - public :
 
@@ -113,7 +255,8 @@ int main( int argc, char** argv )
     trace.info() << " " << argv[ i ];
   trace.info() << endl;
 
-  bool res = testAngleLinearMinimizer(); // && ... other tests
+  bool res = testAngleLinearMinimizer()
+    && testAngleLinearMinimizerByDirectSolver(); // && ... other tests
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
   trace.endBlock();
   return res ? 0 : 1;
@@ -0,0 +1,236 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testCompiledMPolynomial.cpp
+ * @ingroup Tests
+ * @author Jacques-Olivier Lachaud (\c jacques-olivier.lachaud@univ-savoie.fr )
+ * Laboratory of Mathematics (CNRS, UMR 5807), University of Savoie, France
+ *
+ * @date 2026/10/19
+ *
+ * Functions for testing class CompiledMPolynomial.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <cmath>
+#include <cstdlib>
+#include <string>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/math/MPolynomial.h"
+#include "DGtal/math/CompiledMPolynomial.h"
+#include "DGtal/io/readers/MPolynomialReader.h"
+#include "DGtal/shapes/implicit/ImplicitPolynomial3Shape.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class CompiledMPolynomial.
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @return 'true' if a and b are equal up to a relative error.
+ */
+bool close( double a, double b )
+{
+  return std::fabs( a - b ) <= 1e-9 * ( 1.0 + std::fabs( a ) + std::fabs( b ) );
+}
+
+/**
+ * Compares the compiled evaluation (point by point and by batch)
+ * with MPolynomial evaluation at random points.
+ */
+bool checkPolynomial( const std::string & str, unsigned int nbPoints )
+{
+  MPolynomial<3, double> P;
+  MPolynomialReader<3, double> reader;
+  reader.read( P, str.begin(), str.end() );
+  CompiledMPolynomial<3, double> CP( P );
+  std::vector<double> x( nbPoints ), y( nbPoints ), z( nbPoints ), v( nbPoints );
+  for ( unsigned int i = 0; i < nbPoints; ++i )
+    {
+      x[ i ] = 4.0 * rand() / RAND_MAX - 2.0;
+      y[ i ] = 4.0 * rand() / RAND_MAX - 2.0;
+      z[ i ] = 4.0 * rand() / RAND_MAX - 2.0;
+    }
+  const double* coordinates[ 3 ] = { &x[ 0 ], &y[ 0 ], &z[ 0 ] };
+  CP.evaluate( nbPoints, coordinates, &v[ 0 ] );
+  unsigned int nbErrors = 0;
+  for ( unsigned int i = 0; i < nbPoints; ++i )
+    {
+      double p[ 3 ] = { x[ i ], y[ i ], z[ i ] };
+      double ref = P( x[ i ] )( y[ i ] )( z[ i ] );
+      if ( ! close( ref, CP.evaluate( p ) ) || ! close( ref, v[ i ] ) )
+        ++nbErrors;
+    }
+  trace.info() << "P=" << P << " " << CP << " "
+               << nbErrors << " errors" << std::endl;
+  return nbErrors == 0;
+}
+
+bool testCompiledMPolynomial()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Compiled evaluation versus MPolynomial evaluation..." );
+  srand( 0 );
+  const char* polynomials[] = {
+    "x^3y+xz^3+y^3z+z^3+5z",
+    "16*(x^2+y^2)-(x^2+y^2+z^2+3)^2",
+    "1-x^2-y^2-z^2",
+    "z^5-2",
+    "x^4",
+    "3",
+    "0" };
+  for ( unsigned int i = 0; i < 7; ++i )
+    {
+      nbok += checkPolynomial( polynomials[ i ], 1000 ) ? 1 : 0;
+      nb++;
+    }
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "same values" << std::endl;
+
+  CompiledMPolynomial<1, double> C1( mmonomial<double>( 2 ) - 3 * mmonomial<double>( 0 ) );
+  CompiledMPolynomial<2, double> C2( mmonomial<double>( 1, 2 ) );
+  double x[ 2 ] = { 2.0, 3.0 };
+  nbok += ( close( C1.evaluate( x ), 1.0 ) && close( C2.evaluate( x ), 18.0 ) ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "1 and 2 indeterminates" << std::endl;
+  trace.endBlock();
+
+  trace.beginBlock ( "Batch evaluation of ImplicitPolynomial3Shape..." );
+  typedef ImplicitPolynomial3Shape<Z3i::Space> Shape;
+  MPolynomial<3, double> P;
+  MPolynomialReader<3, double> reader;
+  std::string str = "x^3y+xz^3+y^3z+z^3+5z";
+  reader.read( P, str.begin(), str.end() );
+  Shape shape( P );
+  const unsigned int nbPoints = 500;
+  std::vector<double> px( nbPoints ), py( nbPoints ), pz( nbPoints );
+  std::vector<double> v( nbPoints ), gx( nbPoints ), gy( nbPoints ), gz( nbPoints );
+  for ( unsigned int i = 0; i < nbPoints; ++i )
+    {
+      px[ i ] = 0.01 * i - 2.5;
+      py[ i ] = 0.5 - 0.003 * i;
+      pz[ i ] = std::sin( 0.1 * i );
+    }
+  shape.evaluate( nbPoints, &px[ 0 ], &py[ 0 ], &pz[ 0 ], &v[ 0 ] );
+  shape.gradients( nbPoints, &px[ 0 ], &py[ 0 ], &pz[ 0 ], &gx[ 0 ], &gy[ 0 ], &gz[ 0 ] );
+  unsigned int nbErrors = 0;
+  for ( unsigned int i = 0; i < nbPoints; ++i )
+    {
+      Z3i::RealPoint p( px[ i ], py[ i ], pz[ i ] );
+      Z3i::RealPoint g = shape.gradient( p );
+      double gref[ 3 ] = { 3*p[0]*p[0]*p[1] + p[2]*p[2]*p[2],
+                           p[0]*p[0]*p[0] + 3*p[1]*p[1]*p[2],
+                           3*p[0]*p[2]*p[2] + p[1]*p[1]*p[1] + 3*p[2]*p[2] + 5 };
+      if ( ! close( v[ i ], P( p[ 0 ] )( p[ 1 ] )( p[ 2 ] ) )
+           || ! close( v[ i ], shape( p ) )
+           || ! close( gx[ i ], gref[ 0 ] ) || ! close( gy[ i ], gref[ 1 ] )
+           || ! close( gz[ i ], gref[ 2 ] )
+           || ! close( g[ 0 ], gref[ 0 ] ) || ! close( g[ 1 ], gref[ 1 ] )
+           || ! close( g[ 2 ], gref[ 2 ] ) )
+        ++nbErrors;
+    }
+  nbok += ( nbErrors == 0 ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << nbErrors << " errors on values and gradients" << std::endl;
+  trace.endBlock();
+
+  return nbok == nb;
+}
+
+/**
+ * Evaluation speed: MPolynomial versus CompiledMPolynomial.
+ */
+bool testCompiledMPolynomialSpeed( double step = 0.02 )
+{
+  MPolynomial<3, double> P;
+  MPolynomialReader<3, double> reader;
+  std::string str = "x^3y+xz^3+y^3z+z^3+5z";
+  reader.read( P, str.begin(), str.end() );
+  CompiledMPolynomial<3, double> CP( P );
+
+  trace.beginBlock ( "Evaluation speed of MPolynomial" );
+  double sum1 = 0.0;
+  for ( double x = -1.0; x < 1.0; x += step )
+    for ( double y = -1.0; y < 1.0; y += step )
+      for ( double z = -1.0; z < 1.0; z += step )
+        sum1 += P( x )( y )( z );
+  trace.info() << "sum=" << sum1 << std::endl;
+  trace.endBlock();
+
+  trace.beginBlock ( "Evaluation speed of CompiledMPolynomial (point by point)" );
+  double sum2 = 0.0;
+  double p[ 3 ];
+  for ( p[ 0 ] = -1.0; p[ 0 ] < 1.0; p[ 0 ] += step )
+    for ( p[ 1 ] = -1.0; p[ 1 ] < 1.0; p[ 1 ] += step )
+      for ( p[ 2 ] = -1.0; p[ 2 ] < 1.0; p[ 2 ] += step )
+        sum2 += CP.evaluate( p );
+  trace.info() << "sum=" << sum2 << std::endl;
+  trace.endBlock();
+
+  trace.beginBlock ( "Evaluation speed of CompiledMPolynomial (batch along z)" );
+  double sum3 = 0.0;
+  std::vector<double> xs, ys, zs, vs;
+  for ( double z = -1.0; z < 1.0; z += step )
+    zs.push_back( z );
+  xs.resize( zs.size() ); ys.resize( zs.size() ); vs.resize( zs.size() );
+  const double* coordinates[ 3 ] = { &xs[ 0 ], &ys[ 0 ], &zs[ 0 ] };
+  for ( double x = -1.0; x < 1.0; x += step )
+    for ( double y = -1.0; y < 1.0; y += step )
+      {
+        std::fill( xs.begin(), xs.end(), x );
+        std::fill( ys.begin(), ys.end(), y );
+        CP.evaluate( zs.size(), coordinates, &vs[ 0 ] );
+        for ( unsigned int i = 0; i < vs.size(); ++i )
+          sum3 += vs[ i ];
+      }
+  trace.info() << "sum=" << sum3 << std::endl;
+  trace.endBlock();
+
+  return close( sum1, sum2 ) && close( sum1, sum3 );
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Testing class CompiledMPolynomial" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  bool res = testCompiledMPolynomial()
+    && testCompiledMPolynomialSpeed(); // && ... other tests
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -29,6 +29,8 @@
 
 ///////////////////////////////////////////////////////////////////////////////
 #include <iostream>
+#include <cmath>
+#include <cstdlib>
 #include "DGtal/base/Common.h"
 #include "DGtal/math/Signal.h"
 ///////////////////////////////////////////////////////////////////////////////
@@ -79,6 +81,95 @@ bool testSignal()
 }
 
 
+/**
+ * Convolution by its definition, F*G( a ) = sum F(a-i)G(i), with the
+ * access operators of the signals.
+ */
+Signal<double> referenceConvolution( const Signal<double> & F, int Fzero,
+                                     bool periodic, double def,
+                                     const Signal<double> & G, int Gzero )
+{
+  const unsigned int m = G.size();
+  const unsigned int size = periodic ? F.size() : F.size() + m - 1;
+  const int zero = periodic ? Fzero : Fzero + Gzero;
+  Signal<double> FG( size, zero, periodic, def );
+  for ( int a = 0; a < (int) size; ++a )
+    {
+      double sum = 0.0;
+      for ( unsigned int i = 0; i < m; ++i )
+        sum += F[ a - zero - ( (int) i - Gzero ) ] * G[ (int) i - Gzero ];
+      FG[ a - zero ] = sum;
+    }
+  return FG;
+}
+
+bool testConvolutionMethods()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  trace.beginBlock ( "Testing block: direct and FFT convolutions." );
+  srand( 7 );
+  double maxError = 0.0;
+  unsigned int nbExact = 0;
+  unsigned int nbCases = 0;
+  const unsigned int sizes[] = { 1, 5, 37, 200 };
+  const unsigned int kernels[] = { 1, 3, 12, 65, 301 };
+  for ( unsigned int s = 0; s < 4; ++s )
+    for ( unsigned int k = 0; k < 5; ++k )
+      for ( unsigned int p = 0; p < 2; ++p )
+        {
+          const unsigned int n = sizes[ s ];
+          const unsigned int m = kernels[ k ];
+          const bool periodic = ( p == 1 );
+          const int Fzero = (int) ( n / 3 );
+          const int Gzero = (int) ( m / 2 );
+          const double def = periodic ? 0.0 : 0.5;
+          std::vector<double> f( n ), g( m );
+          for ( unsigned int i = 0; i < n; ++i ) f[ i ] = rand() / (double) RAND_MAX - 0.5;
+          for ( unsigned int i = 0; i < m; ++i ) g[ i ] = rand() / (double) RAND_MAX;
+          Signal<double> F( &f[ 0 ], n, Fzero, periodic, def );
+          Signal<double> G( &g[ 0 ], m, Gzero, false, 0.0 );
+          Signal<double> R = referenceConvolution( F, Fzero, periodic, def, G, Gzero );
+          Signal<double> D = F.convolve( G, Signal<double>::DIRECT );
+          Signal<double> T = F.convolve( G, Signal<double>::FFT );
+          bool exact = ( D.size() == R.size() ) && ( T.size() == R.size() );
+          for ( unsigned int i = 0; exact && ( i < R.size() ); ++i )
+            {
+              const int a = (int) i - ( periodic ? Fzero : Fzero + Gzero );
+              exact = ( D[ a ] == R[ a ] );
+              maxError = std::max( maxError, std::fabs( T[ a ] - R[ a ] ) );
+            }
+          // The default value (outside the signal) is unchanged.
+          exact = exact && ( D[ 100000 ] == R[ 100000 ] );
+          nbExact += exact ? 1 : 0;
+          ++nbCases;
+        }
+  nbok += ( nbExact == nbCases ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "direct == definition in " << nbExact << "/" << nbCases 
+               << " cases" << std::endl;
+  nbok += ( maxError < 1e-9 ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "FFT max error = " << maxError << std::endl;
+
+  // Integer signals never use the FFT.
+  int values[] = { 1, 2, 3, 4, 5, 6, 7 };
+  Signal<int> I( values, 7, 0, true, 0 );
+  Signal<int> H = Signal<int>::H2n( 10 );
+  Signal<int> IH = I.convolve( H, Signal<int>::FFT );
+  Signal<int> IH2 = I * H;
+  bool same = true;
+  for ( int i = 0; i < 7; ++i ) same = same && ( IH[ i ] == IH2[ i ] );
+  nbok += same ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "integer convolution " << IH << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // Standard services - public :
 
@@ -90,7 +181,7 @@ int main( int argc, char** argv )
     trace.info() << " " << argv[ i ];
   trace.info() << endl;
 
-  bool res = testSignal();
+  bool res = testSignal() && testConvolutionMethods();
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
   trace.endBlock();
   return res ? 0 : 1;
@@ -0,0 +1,163 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testOctreeDigitizer.cpp
+ * @ingroup Tests
+ * @author Jacques-Olivier Lachaud (\c jacques-olivier.lachaud@univ-savoie.fr )
+ * Laboratory of Mathematics (CNRS, UMR 5807), University of Savoie, France
+ *
+ * @date 2026/10/19
+ *
+ * Functions for testing class OctreeDigitizer.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <string>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/math/MPolynomial.h"
+#include "DGtal/io/readers/MPolynomialReader.h"
+#include "DGtal/shapes/ShapeFactory.h"
+#include "DGtal/shapes/OctreeDigitizer.h"
+#include "DGtal/shapes/parametric/Ball3D.h"
+#include "DGtal/shapes/implicit/ImplicitPolynomial3Shape.h"
+#include "DGtal/shapes/implicit/LipschitzBlockBound.h"
+#include "DGtal/shapes/implicit/MPolynomialBlockBound.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+using namespace DGtal::Z3i;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class OctreeDigitizer.
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @return the number of points of the domain of [dig] whose
+ * orientation differs from their membership to [aSet].
+ */
+template <typename TDigitizer>
+unsigned int nbErrors( const TDigitizer & dig, const DigitalSet & aSet )
+{
+  unsigned int nb = 0;
+  Domain domain = dig.getDomain();
+  for ( Domain::ConstIterator it = domain.begin(); it != domain.end(); ++it )
+    if ( ( dig.orientation( *it ) == INSIDE ) != ( aSet.find( *it ) != aSet.end() ) )
+      ++nb;
+  return nb;
+}
+
+bool testOctreeDigitizer()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Ball with a Lipschitz bound..." );
+  typedef ImplicitBall<Space> Ball;
+  Ball ball( RealPoint( 0.1, -0.2, 0.3 ), 1.0 );
+  GaussDigitizer<Space,Ball> digBall;
+  digBall.attach( ball );
+  digBall.init( RealPoint( -1.5, -1.5, -1.5 ), RealPoint( 1.5, 1.5, 1.5 ), 0.05 );
+  LipschitzBlockBound<Ball> ballBound( ball, 1.0 );
+  OctreeDigitizer<Space,Ball,LipschitzBlockBound<Ball> > octreeBall( digBall, ballBound, 4, 16 );
+  DigitalSet s1( digBall.getDomain() );
+  octreeBall.digitize( s1 );
+  trace.info() << octreeBall << std::endl;
+  nbok += ( nbErrors( digBall, s1 ) == 0 ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << s1.size() << " points, same as point by point" << std::endl;
+  nbok += ( octreeBall.nbSampledPoints() < digBall.getDomain().size() / 2 ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "less than half of the points are sampled" << std::endl;
+  trace.endBlock();
+
+  trace.beginBlock ( "Torus with an interval bound..." );
+  typedef ImplicitPolynomial3Shape<Space> Shape;
+  typedef Shape::Polynomial3 Polynomial3;
+  Polynomial3 P;
+  MPolynomialReader<3, Shape::Ring> reader;
+  std::string str = "16*(x^2+y^2)-(x^2+y^2+z^2+3)^2";
+  reader.read( P, str.begin(), str.end() );
+  Shape torus( P );
+  GaussDigitizer<Space,Shape> digTorus;
+  digTorus.attach( torus );
+  digTorus.init( RealPoint( -3.5, -3.5, -1.5 ), RealPoint( 3.5, 3.5, 1.5 ), 0.07 );
+  MPolynomialBlockBound<Space> torusBound( P );
+  OctreeDigitizer<Space,Shape,MPolynomialBlockBound<Space> > octreeTorus( digTorus, torusBound );
+  DigitalSet s2( digTorus.getDomain() );
+  octreeTorus.digitize( s2 );
+  trace.info() << octreeTorus << std::endl;
+  nbok += ( nbErrors( digTorus, s2 ) == 0 ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << s2.size() << " points, same as point by point" << std::endl;
+  nbok += ( octreeTorus.nbSampledPoints() < digTorus.getDomain().size() / 2 ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "less than half of the points are sampled" << std::endl;
+  trace.endBlock();
+
+  trace.beginBlock ( "Trivial bound and image output..." );
+  typedef Ball3D<Space> Ball3;
+  Ball3 ball3( RealPoint( 0.0, 0.4, 0.0 ), 1.2 );
+  GaussDigitizer<Space,Ball3> digBall3;
+  digBall3.attach( ball3 );
+  digBall3.init( ball3.getLowerBound(), ball3.getUpperBound(), 0.1 );
+  OctreeDigitizer<Space,Ball3> octreeBall3( digBall3 );
+  ImageContainerBySTLVector<Domain,int> image( digBall3.getDomain() );
+  octreeBall3.digitize( image, 1 );
+  DigitalSet s3( digBall3.getDomain() );
+  octreeBall3.digitize( s3 );
+  unsigned int nbImageErrors = 0;
+  Domain domain3 = digBall3.getDomain();
+  for ( Domain::ConstIterator it = domain3.begin(); it != domain3.end(); ++it )
+    if ( ( image( *it ) == 1 ) != ( s3.find( *it ) != s3.end() ) )
+      ++nbImageErrors;
+  nbok += ( ( nbErrors( digBall3, s3 ) == 0 ) && ( nbImageErrors == 0 ) ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << s3.size() << " points, same as point by point" << std::endl;
+  trace.endBlock();
+
+  return nbok == nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Testing class OctreeDigitizer" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  bool res = testOctreeDigitizer(); // && ... other tests
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,111 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testShapes-benchmark.cpp
+ * @ingroup Tests
+ * @author Jacques-Olivier Lachaud (\c jacques-olivier.lachaud@univ-savoie.fr )
+ * Laboratory of Mathematics (CNRS, UMR 5807), University of Savoie, France
+ *
+ * @date 2026/10/19
+ *
+ * Benchmark of the digitization of a 3D ball: point by point versus
+ * span by span (generic, convex and analytic scanlines).
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <cstdlib>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/shapes/Shapes.h"
+#include "DGtal/shapes/ShapeFactory.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+using namespace DGtal::Z3i;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for benchmarking class Shapes.
+///////////////////////////////////////////////////////////////////////////////
+
+bool benchmarkBall( int radius )
+{
+  typedef ImplicitBall<Space> Shape;
+  typedef GaussDigitizer<Space,Shape> Digitizer;
+  Shape ball( RealPoint( 0.0, 0.0, 0.0 ), radius );
+  Digitizer dig;
+  dig.attach( ball );
+  dig.init( ball.getLowerBound(), ball.getUpperBound(), 1.0 );
+  Domain domain( dig.getLowerBound(), dig.getUpperBound() );
+
+  trace.beginBlock ( "Point by point" );
+  DigitalSet s0( domain );
+  for ( Domain::ConstIterator it = domain.begin(); it != domain.end(); ++it )
+    if ( dig.orientation( *it ) == INSIDE )
+      s0.insert( *it );
+  trace.info() << s0.size() << " points" << std::endl;
+  trace.endBlock();
+
+  trace.beginBlock ( "digitalShaper (generic scanlines)" );
+  DigitalSet s1( domain );
+  Shapes<Domain>::digitalShaper( s1, dig );
+  trace.info() << s1.size() << " points" << std::endl;
+  trace.endBlock();
+
+  trace.beginBlock ( "convexDigitalShaper (exponential search)" );
+  DigitalSet s2( domain );
+  Shapes<Domain>::convexDigitalShaper( s2, dig );
+  trace.info() << s2.size() << " points" << std::endl;
+  trace.endBlock();
+
+  trace.beginBlock ( "convexDigitalSpans (spans only)" );
+  std::vector<Shapes<Domain>::Span> spans;
+  Shapes<Domain>::convexDigitalSpans( spans, dig );
+  trace.info() << spans.size() << " spans" << std::endl;
+  trace.endBlock();
+
+  trace.beginBlock ( "addNorm2Ball (analytic scanlines)" );
+  DigitalSet s3( domain );
+  Shapes<Domain>::addNorm2Ball( s3, Point( 0, 0, 0 ), radius );
+  trace.info() << s3.size() << " points" << std::endl;
+  trace.endBlock();
+
+  return ( s0.size() == s1.size() ) && ( s0.size() == s2.size() );
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Benchmarking the digitization of shapes" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  int radius = ( argc > 1 ) ? atoi( argv[ 1 ] ) : 60;
+  bool res = benchmarkBall( radius );
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,235 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testShapes.cpp
+ * @ingroup Tests
+ * @author Jacques-Olivier Lachaud (\c jacques-olivier.lachaud@univ-savoie.fr )
+ * Laboratory of Mathematics (CNRS, UMR 5807), University of Savoie, France
+ *
+ * @date 2026/10/19
+ *
+ * Functions for testing class Shapes: the span-based digitization is
+ * compared with a point by point digitization.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/shapes/Shapes.h"
+#include "DGtal/shapes/ShapeFactory.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DigitalSetTestHelpers.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class Shapes.
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Point by point digitization of a Euclidean shape, as a reference.
+ */
+template <typename TDigitalSet, typename TShape>
+void referenceShaper( TDigitalSet & aSet, const TShape & aShape, double h )
+{
+  typedef typename TDigitalSet::Domain::Space Space;
+  GaussDigitizer<Space,TShape> dig;
+  dig.attach( aShape );
+  dig.init( aShape.getLowerBound(), aShape.getUpperBound(), h );
+  HyperRectDomain<Space> box( dig.getLowerBound(), dig.getUpperBound() );
+  for ( typename HyperRectDomain<Space>::ConstIterator it = box.begin();
+        it != box.end(); ++it )
+    if ( dig.orientation( *it ) == INSIDE )
+      aSet.insert( *it );
+}
+
+/**
+ * Point by point digitization of a ball, as a reference.
+ */
+template <typename TDigitalSet, typename TPoint>
+void referenceBall( TDigitalSet & aSet, const TPoint & c, int r, bool norm1 )
+{
+  typedef typename TDigitalSet::Domain Domain;
+  Domain box( c - TPoint::diagonal( r ), c + TPoint::diagonal( r ) );
+  for ( typename Domain::ConstIterator it = box.begin(); it != box.end(); ++it )
+    if ( aSet.domain().isInside( *it )
+         && ( norm1 ? ( (*it - c).norm1() <= (unsigned int) r )
+              : ( (*it - c).norm() <= r ) ) )
+      aSet.insert( *it );
+}
+
+bool testBalls()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Norm-1 and norm-2 balls in 2D and 3D..." );
+  Z2i::Domain domain2( Z2i::Point( 0, 0 ), Z2i::Point( 40, 30 ) );
+  Z3i::Domain domain3( Z3i::Point( 0, 0, 0 ), Z3i::Point( 20, 25, 15 ) );
+  // Balls inside the domain and balls clipped by the domain.
+  for ( int k = 0; k < 4; ++k )
+    {
+      bool norm1 = ( k % 2 == 0 );
+      Z2i::Point c2( ( k < 2 ) ? 20 : 3, ( k < 2 ) ? 15 : 28 );
+      Z3i::Point c3( ( k < 2 ) ? 10 : 1, ( k < 2 ) ? 12 : 24, 7 );
+      for ( int r = 0; r < 13; r += 3 )
+        {
+          Z2i::DigitalSet s2( domain2 ), ref2( domain2 );
+          Z3i::DigitalSet s3( domain3 ), ref3( domain3 );
+          if ( norm1 )
+            {
+              Shapes<Z2i::Domain>::addNorm1Ball( s2, c2, r );
+              Shapes<Z3i::Domain>::addNorm1Ball( s3, c3, r );
+            }
+          else
+            {
+              Shapes<Z2i::Domain>::addNorm2Ball( s2, c2, r );
+              Shapes<Z3i::Domain>::addNorm2Ball( s3, c3, r );
+            }
+          referenceBall( ref2, c2, r, norm1 );
+          referenceBall( ref3, c3, r, norm1 );
+          nbok += ( sameSets( s2, ref2 ) && sameSets( s3, ref3 ) ) ? 1 : 0;
+          nb++;
+        }
+    }
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "same balls as point by point" << std::endl;
+
+  Z3i::DigitalSet s3( domain3 );
+  Shapes<Z3i::Domain>::addNorm2Ball( s3, Z3i::Point( 10, 12, 7 ), 6 );
+  Shapes<Z3i::Domain>::removeNorm2Ball( s3, Z3i::Point( 10, 12, 7 ), 4 );
+  Shapes<Z3i::Domain>::removeNorm1Ball( s3, Z3i::Point( 10, 12, 13 ), 3 );
+  unsigned int nbErrors = 0;
+  for ( Z3i::Domain::ConstIterator it = domain3.begin(); it != domain3.end(); ++it )
+    {
+      Z3i::Point p = *it;
+      bool in = ( ( p - Z3i::Point( 10, 12, 7 ) ).norm() <= 6 )
+        && ! ( ( p - Z3i::Point( 10, 12, 7 ) ).norm() <= 4 )
+        && ! ( ( p - Z3i::Point( 10, 12, 13 ) ).norm1() <= 3 );
+      if ( in != ( s3.find( p ) != s3.end() ) ) ++nbErrors;
+    }
+  nbok += ( nbErrors == 0 ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << nbErrors << " errors after removing balls" << std::endl;
+  trace.endBlock();
+
+  return nbok == nb;
+}
+
+bool testShapers()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Digitization of Euclidean shapes..." );
+  Z2i::Domain domain2( Z2i::Point( -100, -100 ), Z2i::Point( 100, 100 ) );
+  Z3i::Domain domain3( Z3i::Point( -30, -30, -30 ), Z3i::Point( 30, 30, 30 ) );
+  double h = 0.37;
+
+  Flower2D<Z2i::Space> flower( 0.5, -0.2, 15.0, 5.0, 5, 0.3 );
+  Z2i::DigitalSet s2( domain2 ), ref2( domain2 );
+  Shapes<Z2i::Domain>::euclideanShaper( s2, flower, h );
+  referenceShaper( ref2, flower, h );
+  nbok += sameSets( s2, ref2 ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "flower (" << s2.size() << " points)" << std::endl;
+
+  Ball2D<Z2i::Space> disk( Z2i::RealPoint( 0.3, 0.1 ), 20.0 );
+  s2.clear(); ref2.clear();
+  Shapes<Z2i::Domain>::convexEuclideanShaper( s2, disk, h );
+  referenceShaper( ref2, disk, h );
+  nbok += sameSets( s2, ref2 ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "convex disk (" << s2.size() << " points)" << std::endl;
+
+  ImplicitBall<Z3i::Space> ball( Z3i::RealPoint( 0.2, -0.4, 0.7 ), 8.0 );
+  Z3i::DigitalSet s3( domain3 ), ref3( domain3 );
+  Shapes<Z3i::Domain>::convexEuclideanShaper( s3, ball, h );
+  referenceShaper( ref3, ball, h );
+  nbok += sameSets( s3, ref3 ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "convex ball (" << s3.size() << " points)" << std::endl;
+
+  ImplicitHyperCube<Z3i::Space> cube( Z3i::RealPoint( 1.1, 0.0, -0.3 ), 6.5 );
+  s3.clear(); ref3.clear();
+  Shapes<Z3i::Domain>::convexEuclideanShaper( s3, cube, h );
+  referenceShaper( ref3, cube, h );
+  nbok += sameSets( s3, ref3 ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "convex cube (" << s3.size() << " points)" << std::endl;
+
+  ImplicitRoundedHyperCube<Z3i::Space> rounded( Z3i::RealPoint( 0.0, 0.5, 0.0 ), 7.0, 2.5 );
+  s3.clear(); ref3.clear();
+  Shapes<Z3i::Domain>::euclideanShaper( s3, rounded, h );
+  referenceShaper( ref3, rounded, h );
+  nbok += sameSets( s3, ref3 ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "rounded cube (" << s3.size() << " points)" << std::endl;
+  trace.endBlock();
+
+  trace.beginBlock ( "Filling an image with spans..." );
+  typedef ImageContainerBySTLVector<Z2i::Domain, int> Image;
+  Image image( domain2 );
+  std::vector<Shapes<Z2i::Domain>::Span> spans;
+  GaussDigitizer<Z2i::Space, Ball2D<Z2i::Space> > dig;
+  dig.attach( disk );
+  dig.init( disk.getLowerBound(), disk.getUpperBound(), h );
+  Shapes<Z2i::Domain>::convexDigitalSpans( spans, dig );
+  Shapes<Z2i::Domain>::fillSpans( image, spans, 1 );
+  unsigned int nbErrors = 0;
+  for ( Z2i::Domain::ConstIterator it = domain2.begin(); it != domain2.end(); ++it )
+    if ( ( image( *it ) == 1 ) != ( ref2.find( *it ) != ref2.end() ) )
+      ++nbErrors;
+  nbok += ( nbErrors == 0 ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << spans.size() << " spans, " << nbErrors << " errors" << std::endl;
+  trace.endBlock();
+
+  return nbok == nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Testing class Shapes" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  bool res = testBalls() && testShapers(); // && ... other tests
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
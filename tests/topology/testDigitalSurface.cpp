@@ -251,6 +251,64 @@ bool testLightImplicitDigitalSurface()
   return nbok == nb;
 }
 
+//-----------------------------------------------------------------------------
+// Testing Surfaces::parallelTrackBoundary
+//-----------------------------------------------------------------------------
+bool testParallelTracking()
+{
+  using namespace Z3i;
+  typedef ImplicitDigitalEllipse3<Point> ImplicitDigitalEllipse;
+  typedef LightImplicitDigitalSurface<KSpace,ImplicitDigitalEllipse> Boundary;
+  typedef KSpace::Surfel Surfel;
+  typedef KSpace::SCellSet SCellSet;
+
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  trace.beginBlock ( "Testing block ... parallel tracking of surfaces" );
+  KSpace K;
+  K.init( Point( -10, -10, -10 ), Point( 10, 10, 10 ), true );
+  SurfelAdjacency<KSpace::dimension> SAdj( true );
+  // A closed surface, then a surface cut by the bounds of the space.
+  ImplicitDigitalEllipse ellipse( 6.0, 4.5, 3.4 );
+  ImplicitDigitalEllipse cutEllipse( 14.0, 4.5, 3.4 );
+  Surfel bel = Surfaces<KSpace>::findABel( K, ellipse, 10000 );
+  SCellSet ref, surface;
+  Surfaces<KSpace>::trackClosedBoundary( ref, K, SAdj, ellipse, bel );
+  Surfaces<KSpace>::TrackingTimings timings;
+  Surfaces<KSpace>::parallelTrackBoundary( surface, K, SAdj, ellipse, bel,
+                                           true, &timings );
+  nb++, nbok += ( surface == ref ) ? 1 : 0;
+  std::ostream & out = trace.info();
+  out << "(" << nbok << "/" << nb << ") "
+      << surface.size() << " surfels on closed surface, ";
+  timings.selfDisplay( out );
+  out << std::endl;
+  Surfaces<KSpace>::parallelTrackBoundary( surface, K, SAdj, ellipse, bel );
+  nb++, nbok += ( surface == ref ) ? 1 : 0;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "same surface when tracked as open" << std::endl;
+
+  bel = Surfaces<KSpace>::findABel( K, cutEllipse, 10000 );
+  Surfaces<KSpace>::trackBoundary( ref, K, SAdj, cutEllipse, bel );
+  Surfaces<KSpace>::parallelTrackBoundary( surface, K, SAdj, cutEllipse, bel );
+  nb++, nbok += ( surface == ref ) ? 1 : 0;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << surface.size() << " surfels on open surface" << std::endl;
+
+  Boundary boundary( K, cutEllipse, SAdj, bel );
+  boundary.computeSurfels( surface );
+  unsigned int nbsurfels = 0;
+  for ( Boundary::SurfelConstIterator it = boundary.begin(),
+          it_end = boundary.end(); it != it_end; ++it )
+    if ( surface.find( *it ) != surface.end() )
+      ++nbsurfels;
+  nb++, nbok += ( nbsurfels == surface.size() ) && ( surface == ref ) ? 1 : 0;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "LightImplicitDigitalSurface::computeSurfels" << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+
 template <typename Image3D>
 void fillImage3D( Image3D & img, 
                   typename Image3D::Point low, 
@@ -601,6 +659,7 @@ int main( int argc, char** argv )
   bool res = testDigitalSetBoundary()
     && testImplicitDigitalSurface()
     && testLightImplicitDigitalSurface()
+    && testParallelTracking()
     && testExplicitDigitalSurface()
     && testLightExplicitDigitalSurface()
     && testDigitalSurface<KhalimskySpaceND<2> >()
@@ -0,0 +1,217 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testImageContoursTracker.cpp
+ * @ingroup Tests
+ * @author Jacques-Olivier Lachaud (\c jacques-olivier.lachaud@univ-savoie.fr )
+ * Laboratory of Mathematics (CNRS, UMR 5807), University of Savoie, France
+ *
+ * @date 2026/10/19
+ *
+ * Functions for testing class ImageContoursTracker.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <deque>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/topology/helpers/Surfaces.h"
+#include "DGtal/topology/helpers/ImageContoursTracker.h"
+#include "DGtal/geometry/curves/GridCurve.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+using namespace DGtal::Z2i;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class ImageContoursTracker.
+///////////////////////////////////////////////////////////////////////////////
+
+typedef ImageContainerBySTLVector<Domain, int> Image;
+typedef ImageContoursTracker<KSpace, Image> Tracker;
+
+/**
+ * Visitor counting the contours and their surfels.
+ */
+struct CountingVisitor
+{
+  CountingVisitor() : myNbContours( 0 ), myNbSurfels( 0 ) {}
+  void beginContour( const int & ) { ++myNbContours; }
+  void addSurfel( const KSpace::SCell & ) { ++myNbSurfels; }
+  void endContour() {}
+  unsigned int myNbContours;
+  unsigned int myNbSurfels;
+};
+
+/**
+ * Visitor pushing the surfels of one contour into a curve.
+ */
+struct CurveBuilder
+{
+  CurveBuilder( GridCurve<KSpace> & aCurve ) : myCurve( &aCurve ) {}
+  void beginContour( const int & ) {}
+  void addSurfel( const KSpace::SCell & s ) { myCurve->pushBack( s ); }
+  void endContour() {}
+  GridCurve<KSpace>* myCurve;
+};
+
+/**
+ * Fills a box of the image with a label.
+ */
+void fillBox( Image & image, const Point & low, const Point & up, int label )
+{
+  Domain box( low, up );
+  for ( Domain::ConstIterator it = box.begin(), itE = box.end();
+        it != itE; ++it )
+    image.setValue( *it, label );
+}
+
+/**
+ * Image with a square (label 1), a ring (label 2) whose hole
+ * contains a single pixel (label 3), on a background of label 0.
+ */
+void makeImage( Image & image )
+{
+  fillBox( image, image.domain().lowerBound(), image.domain().upperBound(), 0 );
+  fillBox( image, Point( 2, 2 ), Point( 5, 5 ), 1 );
+  fillBox( image, Point( 8, 2 ), Point( 14, 9 ), 2 );
+  fillBox( image, Point( 10, 4 ), Point( 12, 7 ), 0 );
+  fillBox( image, Point( 11, 5 ), Point( 11, 5 ), 3 );
+}
+
+/**
+ * Compares the contours of the labelled regions with the ones given
+ * by Surfaces::extractAll2DSCellContours.
+ */
+bool testImageContoursTracker()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  Domain domain( Point( 0, 0 ), Point( 19, 13 ) );
+  Image image( domain );
+  makeImage( image );
+  KSpace K;
+  K.init( domain.lowerBound() - Point::diagonal( 1 ),
+          domain.upperBound() + Point::diagonal( 1 ), true );
+  SurfelAdjacency<2> SAdj( true );
+
+  trace.beginBlock ( "Contours of the foreground regions..." );
+  Tracker tracker( K, image, SAdj );
+  tracker.setBackground( 0 );
+  trace.info() << tracker << std::endl;
+  std::deque< GridCurve<KSpace> > curves;
+  std::vector<int> labels;
+  unsigned int n = tracker.extractCurves( curves, labels );
+  nbok += ( ( n == 4 ) && ( curves.size() == 4 ) && ( labels.size() == 4 ) )
+    ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << n << " contours (4 expected)" << std::endl;
+  unsigned int nbClosed = 0;
+  unsigned int length[ 4 ] = { 0, 0, 0, 0 };
+  for ( unsigned int i = 0; i < curves.size(); ++i )
+    {
+      if ( curves[ i ].isClosed() ) ++nbClosed;
+      length[ labels[ i ] ] += curves[ i ].size();
+    }
+  nbok += ( nbClosed == n ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << nbClosed << " closed curves" << std::endl;
+  nbok += ( ( length[ 1 ] == 16 ) && ( length[ 2 ] == 30 + 14 )
+            && ( length[ 3 ] == 4 ) ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") lengths "
+               << length[ 1 ] << " " << length[ 2 ] << " " << length[ 3 ]
+               << " (16 44 4 expected)" << std::endl;
+  trace.endBlock();
+
+  trace.beginBlock ( "Comparison with Surfaces::extractAll2DSCellContours..." );
+  tracker.unsetBackground();
+  CountingVisitor visitor;
+  tracker.extract( visitor );
+  unsigned int nbContours = 0;
+  unsigned int nbSurfels = 0;
+  for ( int label = 0; label < 4; ++label )
+    {
+      std::vector< std::vector<SCell> > contours;
+      Surfaces<KSpace>::extractAll2DSCellContours
+        ( contours, K, SAdj, Tracker::LabelPredicate( image, label ) );
+      nbContours += contours.size();
+      for ( unsigned int i = 0; i < contours.size(); ++i )
+        nbSurfels += contours[ i ].size();
+    }
+  nbok += ( visitor.myNbContours == nbContours ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << visitor.myNbContours << " == " << nbContours
+               << " contours" << std::endl;
+  nbok += ( visitor.myNbSurfels == nbSurfels ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << visitor.myNbSurfels << " == " << nbSurfels
+               << " surfels" << std::endl;
+  trace.endBlock();
+
+  trace.beginBlock ( "Two-phase extraction..." );
+  std::vector<int> labels2;
+  std::vector<SCell> starts;
+  tracker.setBackground( 0 );
+  tracker.findContours( labels2, starts );
+  bool same = ( labels2 == labels );
+  for ( unsigned int i = 0; same && ( i < starts.size() ); ++i )
+    {
+      GridCurve<KSpace> c( K );
+      CurveBuilder cv( c );
+      tracker.track( cv, labels2[ i ], starts[ i ] );
+      same = ( c.size() == curves[ i ].size() )
+        && ( *c.begin() == *curves[ i ].begin() );
+    }
+  nbok += same ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "same contours as extractCurves" << std::endl;
+  trace.endBlock();
+
+  return nbok == nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Testing class ImageContoursTracker" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  bool res = testImageContoursTracker(); // && ... other tests
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -60,9 +60,23 @@ namespace DGtal {
     unsigned int nb = 0;
     trace.beginBlock ( "Testing block ... ImplicitDigitalSurface" );
     trace.beginBlock ( "ImplicitDigitalSurface instanciation" );
+    typename Boundary::TrackingTimings timings;
     Boundary boundary( K, pp,
                        SurfelAdjacency<KSpace::dimension>( true ), bel,
-                       true );
+                       true, &timings );
+    std::ostream & out = trace.info();
+    timings.selfDisplay( out );
+    out << std::endl;
+    trace.endBlock();
+    trace.beginBlock ( "Sequential tracking (Surfaces::trackClosedBoundary)" );
+    typename KSpace::SCellSet surface;
+    Surfaces<KSpace>::trackClosedBoundary( surface, K,
+                                           SurfelAdjacency<KSpace::dimension>( true ),
+                                           pp, bel );
+    nb++, nbok += surface.size() == boundary.nbSurfels() ? 1 : 0;
+    trace.info() << "(" << nbok << "/" << nb << ") "
+                 << surface.size() << " surfels, as in ImplicitDigitalSurface"
+                 << std::endl;
     trace.endBlock();
     trace.beginBlock ( "Counting the number of surfels (breadth first traversal)" );
     unsigned int nbsurfels = 0;